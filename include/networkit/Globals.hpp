@@ -13,7 +13,14 @@
 #include <utility>
 
 namespace NetworKit {
+/// Node ids, edge ids and array indices are 64 bit wide unless NetworKit is built with
+/// NETWORKIT_INDEX_32BIT, which limits graphs to less than 2^32 - 1 nodes and edges but halves
+/// the memory footprint of adjacency arrays and per-node data.
+#ifdef NETWORKIT_INDEX_32BIT
+using index = uint32_t; ///< more expressive name for an index into an array
+#else
 using index = uint64_t; ///< more expressive name for an index into an array
+#endif // NETWORKIT_INDEX_32BIT
 
 /// Should be used in OpenMP parallel for-loops and is associated with unsigned semantics.
 /// On MSVC it falls back to being signed, as MSVC does not support unsigned parallel fors.
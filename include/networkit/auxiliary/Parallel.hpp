@@ -21,9 +21,11 @@ namespace Parallel {
 #ifdef NETWORKIT_NO_PARALLEL_STL
 using std::max_element;
 using std::sort;
+using std::stable_sort;
 #else
 using __gnu_parallel::max_element;
 using __gnu_parallel::sort;
+using __gnu_parallel::stable_sort;
 #endif // NETWORKIT_NO_PARALLEL_STL
 
 template <typename ValueType, typename Comp>
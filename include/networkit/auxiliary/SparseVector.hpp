@@ -132,10 +132,10 @@ template <typename T>
 SparseVector<T>::SparseVector() : emptyValue(T{}) {}
 
 template <typename T>
-SparseVector<T>::SparseVector(count size) : SparseVector(size, T{}) {}
+SparseVector<T>::SparseVector(index size) : SparseVector(size, T{}) {}
 
 template <typename T>
-SparseVector<T>::SparseVector(count size, T emptyValue)
+SparseVector<T>::SparseVector(index size, T emptyValue)
     : data(size, emptyValue), emptyValue(emptyValue) {}
 
 template <typename T>
@@ -8,7 +8,15 @@
 #ifndef NETWORKIT_CENTRALITY_BETWEENNESS_HPP_
 #define NETWORKIT_CENTRALITY_BETWEENNESS_HPP_
 
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #include <networkit/centrality/Centrality.hpp>
+#include <networkit/distance/SSSP.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 
 namespace NetworKit {
 
@@ -21,6 +29,9 @@ public:
      * Constructs the Betweenness class for the given Graph @a G. If the betweenness scores should
      * be normalized, then set @a normalized to <code>true</code>. The run() method takes O(nm)
      * time, where n is the number of nodes and m is the number of edges of the graph.
+     * The numbers of shortest paths are counted with doubles; only sources with more shortest
+     * paths than a double can represent (and graphs with non-positive edge weights) use
+     * arbitrary precision arithmetic.
      *
      * @param G The graph.
      * @param normalized Set this parameter to <code>true</code> if scores should be normalized in
@@ -30,6 +41,19 @@ public:
      */
     Betweenness(const Graph &G, bool normalized = false, bool computeEdgeCentrality = false);
 
+    /**
+     * Constructs the Betweenness class for the CSR snapshot @a G. The searches traverse the
+     * snapshot in the same way as on a Graph. Sources whose path counts need arbitrary precision
+     * (see above) run on a Graph that is created from the snapshot on demand.
+     *
+     * @param G The graph.
+     * @param normalized Set this parameter to <code>true</code> if scores should be normalized in
+     * the interval [0,1].
+     * @param computeEdgeCentrality Set this parameter to <code>true</code> if edge betweenness
+     * should be computed as well; requires a snapshot with edge ids.
+     */
+    Betweenness(const CSRGraph &G, bool normalized = false, bool computeEdgeCentrality = false);
+
     /**
      * Computes betweenness scores on the graph passed in constructor.
      */
@@ -40,6 +64,54 @@ public:
      * nodes (=a star)
      */
     double maximum() override;
+
+    /**
+     * Restricts run() to the sources in one of @a numberOfShards shards: node u belongs to shard
+     * u % numberOfShards. The scores of all shards sum up to the scores of an unrestricted run,
+     * so an exact computation can be split across several processes or machines, see
+     * writePartialScores() and mergePartialScores().
+     *
+     * @param shard The shard whose sources are processed, in [0, numberOfShards).
+     * @param numberOfShards The number of shards.
+     */
+    void setSourceShard(index shard, count numberOfShards);
+
+    /**
+     * Writes the (partial) node and edge scores of the last run to a binary file at @a path,
+     * together with the shard of its sources. The file uses the native byte order.
+     *
+     * @param path The path of the file.
+     */
+    void writePartialScores(std::string_view path) const;
+
+    /**
+     * Sums up the partial scores written by writePartialScores(). Throws if the files do not
+     * contain exactly one run per shard on graphs of the same size with the same settings.
+     *
+     * @param paths The files written by the runs of the individual shards.
+     * @return The node scores and the edge scores (empty if they were not computed).
+     */
+    static std::pair<std::vector<double>, std::vector<double>>
+    mergePartialScores(const std::vector<std::string> &paths);
+
+    /**
+     * On unweighted graphs, run() processes batches of up to 64 sources with bit-parallel BFSs.
+     * The path counts and dependencies of a batch take 16 bytes per node and source; the batch
+     * size is bounded such that they take at most maxBatchMemory bytes over all threads. If this
+     * does not allow batches of at least two sources, run() uses one BFS per source instead.
+     */
+    count maxBatchMemory = count{1} << 30;
+
+private:
+    index shard = 0;
+    count numberOfShards = 1;
+
+    template <class GraphType>
+    void runImpl(const GraphType &G);
+
+    // Accumulates the dependencies of source s, counting the shortest paths with bigfloat.
+    void computeDependenciesWithBigfloat(const Graph &G, node s, std::unique_ptr<SSSP> &sssp,
+                                         std::vector<double> &dependency);
 };
 
 } /* namespace NetworKit */
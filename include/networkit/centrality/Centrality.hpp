@@ -9,6 +9,7 @@
 #define NETWORKIT_CENTRALITY_CENTRALITY_HPP_
 
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -86,11 +87,29 @@ public:
     virtual double centralization();
 
 protected:
+    /**
+     * Constructs the Centrality class for the CSR snapshot @a G. For subclasses that traverse
+     * the snapshot themselves; see csr.
+     */
+    Centrality(const CSRGraph &G, bool normalized = false, bool computeEdgeCentrality = false);
+
+    //!< an empty graph if the centrality has been constructed for a CSRGraph
     const Graph &G;
+    //!< the snapshot if the centrality has been constructed for a CSRGraph, nullptr otherwise
+    const CSRGraph *csr = nullptr;
     std::vector<double> scoreData;
     std::vector<double> edgeScoreData;
     bool normalized; // true if scores should be normalized in the interval [0,1]
     bool computeEdgeCentrality;
+
+private:
+    template <typename L>
+    void forInputNodes(L handle) const {
+        if (csr)
+            csr->forNodes(handle);
+        else
+            G.forNodes(handle);
+    }
 };
 
 } /* namespace NetworKit */
@@ -42,9 +42,9 @@ public:
      * cores is stored and can later be returned using getNodeOrder(). Enforces the sequential
      * bucket priority queue algorithm.
      *
-     * The algorithm runs in parallel if the usage of a bucket priority queue is not enforced and
-     * if the node ids of the input graph are continuous (i.e., numberOfNodes() =
-     * upperNodeIdBound()).
+     * The algorithm runs in parallel if the graph is undirected and the usage of a bucket priority
+     * queue is not enforced. Like PKC, each level only scans the nodes that have not been peeled
+     * yet, and levels without any node are skipped.
      */
     CoreDecomposition(const Graph &G, bool normalized = false,
                       bool enforceBucketQueueAlgorithm = false, bool storeNodeOrder = false);
@@ -96,8 +96,6 @@ private:
 
     bool enforceBucketQueueAlgorithm; // in case one wants to switch to the alternative algorithm
 
-    bool canRunInParallel; // signifies if a parallel algorithm can be used
-
     bool storeNodeOrder; // signifies if the node order shall be stored
 
     std::vector<node> nodeOrder; // Stores the node order, i.e., all nodes sorted by core number
@@ -117,21 +115,24 @@ private:
     void runWithBucketQueues();
 
     /**
-     * Determines nodes whose remaining degree equals @a level.
-     * @param[in] level Shell number (= level) currently processed.
+     * Removes the nodes that have already been peeled from @a remaining and returns the minimum
+     * remaining degree of the other nodes, i.e., the next nonempty level.
      * @param[in] degrees Remaining degree for each node.
-     * @param[inout] curr Nodes to be processed in current level.
+     * @param[inout] remaining Nodes that have not been peeled before the last scan.
+     * @param[in] active Whether a node has not been peeled yet.
      */
-    void scan(index level, const std::vector<count> &degrees, std::vector<node> &curr);
+    count compactRemaining(const std::vector<count> &degrees, std::vector<node> &remaining,
+                           const std::vector<char> &active) const;
 
     /**
-     * Determines in parallel the nodes whose remaining degree equals @a level.
+     * Determines the nodes in @a remaining whose remaining degree equals @a level.
      * @param[in] level Shell number (= level) currently processed.
      * @param[in] degrees Remaining degree for each node.
+     * @param[in] remaining Nodes that have not been peeled yet.
      * @param[inout] curr Nodes to be processed in current level.
      */
-    void scanParallel(index level, const std::vector<count> &degrees, std::vector<node> &curr,
-                      std::vector<char> &active);
+    void scan(index level, const std::vector<count> &degrees, const std::vector<node> &remaining,
+              std::vector<node> &curr) const;
 
     /**
      * Processes nodes (and their neighbors) identified by previous scan.
@@ -142,7 +143,7 @@ private:
      * curr).
      */
     void processSublevel(index level, std::vector<count> &degrees, const std::vector<node> &curr,
-                         std::vector<node> &next);
+                         std::vector<node> &next, std::vector<char> &active);
 
     /**
      * Processes in parallel nodes (and their neighbors) identified by previous scan.
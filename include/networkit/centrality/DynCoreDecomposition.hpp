@@ -0,0 +1,102 @@
+/*
+ * DynCoreDecomposition.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
+#define NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/centrality/Centrality.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Maintains the core numbers of an undirected graph without self-loops under edge insertions and
+ * removals. The initial decomposition is computed with the parallel CoreDecomposition.
+ *
+ * Updates use the traversal algorithm of Sariyuece et al., "Streaming algorithms for k-core
+ * decomposition" (VLDB 2013): inserting or removing the edge {u, v} changes core numbers by at
+ * most one, and only within the subcore of the endpoint(s) with smaller core number K, i.e., the
+ * nodes with core number K that are reachable from it via nodes with core number K. An update
+ * explores this subcore and peels it locally.
+ */
+class DynCoreDecomposition final : public Centrality, public DynAlgorithm {
+
+public:
+    /**
+     * Constructs the DynCoreDecomposition class for the Graph @a G.
+     *
+     * @param[in] G Undirected graph without self-loops.
+     */
+    DynCoreDecomposition(const Graph &G);
+
+    /**
+     * Computes the core numbers from scratch.
+     */
+    void run() override;
+
+    /**
+     * Updates the core numbers after a batch of edge insertions and removals. The graph must
+     * already reflect all changes of the batch; the events are processed in the given order.
+     * Nodes that have been added to the graph since the last update must be isolated.
+     *
+     * @param events The edge insertions and removals.
+     */
+    void updateBatch(const std::vector<GraphEvent> &events) override;
+
+    void update(GraphEvent singleEvent) override {
+        std::vector<GraphEvent> events{singleEvent};
+        updateBatch(events);
+    }
+
+    /**
+     * Returns the maximum core number.
+     */
+    index maxCoreNumber() const;
+
+    /**
+     * Returns the number of nodes explored by the last call to updateBatch().
+     */
+    count numberOfVisitedNodes() const {
+        assureFinished();
+        return visited;
+    }
+
+    double maximum() override { return static_cast<double>(G.numberOfNodes() - 1); }
+
+private:
+    count visited = 0;
+
+    // Per-node state of the traversals; reset after each traversal.
+    std::vector<count> support;
+    std::vector<uint8_t> status;
+    std::vector<node> subcore, evicted;
+
+    // Edges of the batch whose events have not been processed yet: insertions that are already
+    // in the graph and removals that are no longer in the graph.
+    std::unordered_map<node, std::vector<node>> pendingInsertions, pendingRemovals;
+
+    // Iterates over the neighbors of u in the graph after the events processed so far.
+    template <typename L>
+    void forNeighborsOf(node u, L handle) const;
+
+    // Collects the subcores of the roots with core number K and counts for each of their nodes
+    // the neighbors with core number at least K.
+    void exploreSubcore(index K, node u, node v);
+
+    void insertEdge(node u, node v);
+
+    void removeEdge(node u, node v);
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_CENTRALITY_DYN_CORE_DECOMPOSITION_HPP_
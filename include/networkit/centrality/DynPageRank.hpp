@@ -0,0 +1,90 @@
+/*
+ * DynPageRank.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_DYN_PAGE_RANK_HPP_
+#define NETWORKIT_CENTRALITY_DYN_PAGE_RANK_HPP_
+
+#include <vector>
+
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/centrality/Centrality.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Maintains PageRank under batches of node insertions and edge insertions, removals and weight
+ * increments. The scores are those of PageRank with uniform random jumps and without sink
+ * handling (i.e., normalized to sum 1 on directed graphs).
+ *
+ * The algorithm maintains the scores together with residuals such that the exact PageRank vector
+ * is the current one plus the PageRank of the residuals; nodes whose residual exceeds a threshold
+ * push it to their out-neighbors. An edge update only changes the contributions of its source
+ * node, so updateBatch() corrects the residuals of the out-neighbors of the endpoints and pushes
+ * from there. After run() and after every update the L1 error of the (unnormalized) scores is at
+ * most @a tol.
+ */
+class DynPageRank final : public Centrality, public DynAlgorithm {
+
+public:
+    /**
+     * Constructs the DynPageRank class for the Graph @a G.
+     *
+     * @param[in] G Graph to be processed.
+     * @param[in] damp Damping factor of the PageRank algorithm.
+     * @param[in] tol Bound on the L1 error of the scores.
+     */
+    DynPageRank(const Graph &G, double damp = 0.85, double tol = 1e-8);
+
+    /**
+     * Computes PageRank from scratch.
+     */
+    void run() override;
+
+    /**
+     * Updates the scores after a batch of node insertions and edge insertions, removals or weight
+     * increments. The graph must already reflect the changes. The events of removed edges of
+     * weighted graphs must carry the weight of the removed edge.
+     *
+     * @param events The node insertions and edge insertions, removals or weight increments.
+     */
+    void updateBatch(const std::vector<GraphEvent> &events) override;
+
+    void update(GraphEvent singleEvent) override {
+        std::vector<GraphEvent> events{singleEvent};
+        updateBatch(events);
+    }
+
+    /**
+     * Returns the number of residual pushes done by the last call to run() or updateBatch().
+     */
+    count numberOfPushes() const {
+        assureFinished();
+        return pushes;
+    }
+
+private:
+    double damp;
+    double tol;
+    count pushes = 0;
+    // Number of nodes the residuals refer to
+    count numberOfNodes = 0;
+
+    // Unnormalized scores, residuals and weighted out-degrees of the current graph
+    std::vector<double> pr, residual, deg;
+
+    double threshold() const;
+
+    // Pushes until all residuals are at most threshold() in absolute value.
+    void pushResiduals(std::vector<node> active);
+
+    void updateScores();
+};
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_CENTRALITY_DYN_PAGE_RANK_HPP_
@@ -21,6 +21,14 @@ class EigenvectorCentrality final : public Centrality {
     const double tol; // error tolerance
 
 public:
+    enum Strategy {
+        // Power iteration starting from the all-ones vector
+        POWER_ITERATION,
+        // Thick-restart Lanczos method (see LanczosEigensolver); converges much faster than the
+        // power iteration on graphs with a small spectral gap. Undirected graphs only.
+        LANCZOS
+    };
+
     /**
      * Constructs an EigenvectorCentrality object for the given Graph @a G. @a tol defines the
      * tolerance for convergence.
@@ -35,6 +43,12 @@ public:
      * Computes eigenvector centrality on the graph passed in constructor.
      */
     void run() override;
+
+    // Eigensolver used by run()
+    Strategy strategy = Strategy::POWER_ITERATION;
+
+private:
+    void runLanczos();
 };
 
 } /* namespace NetworKit */
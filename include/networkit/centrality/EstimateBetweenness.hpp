@@ -31,7 +31,9 @@ public:
      * @param	graph		input graph
      * @param	nSamples	 user defined number of samples
      * @param	normalized   normalize centrality values in interval [0,1] ?
-     * @param	parallel_flag	if true, run in parallel with additional memory cost z + 3z * t
+     * @param	parallel_flag	if true, run in parallel with additional memory cost z + 3z * t;
+     * on unweighted graphs with fewer samples than threads, all threads process one sample at a
+     * time (see FrontierParallelBrandes)
      */
     EstimateBetweenness(const Graph &G, count nSamples, bool normalized = false,
                         bool parallel_flag = false);
@@ -0,0 +1,94 @@
+/*
+ * FrontierParallelBrandes.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CENTRALITY_FRONTIER_PARALLEL_BRANDES_HPP_
+#define NETWORKIT_CENTRALITY_FRONTIER_PARALLEL_BRANDES_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup centrality
+ * Computes the dependencies of a single source on all other nodes of an unweighted graph, i.e.,
+ * one iteration of Brandes' betweenness algorithm, using all threads. The shortest paths are
+ * counted by a level-synchronous parallel BFS and the dependencies are propagated back one BFS
+ * level at a time. Both phases pull the values of a node from its neighbors in the adjacent
+ * level, so every node is written by a single thread and no atomics are needed.
+ *
+ * Use this class when only a few sources are processed, e.g., by sampling algorithms; with many
+ * sources, processing the sources in parallel is faster.
+ */
+class FrontierParallelBrandes final {
+public:
+    /**
+     * @param G The graph; edge weights are ignored.
+     * @param scaleByDistance If true, the contribution of a node v to the dependency of its
+     * predecessor u is scaled by dist(u) / dist(v) as in the linear scaling of Geisberger et al.
+     */
+    FrontierParallelBrandes(const Graph &G, bool scaleByDistance = false);
+
+    /**
+     * Computes the dependencies of @a source on all nodes.
+     *
+     * @return False if the number of shortest paths to some node overflows a double; the
+     * dependencies are not valid in this case.
+     */
+    bool run(node source);
+
+    /**
+     * Returns the number of BFS levels of the last run.
+     */
+    count numberOfLevels() const noexcept { return levelBegin.size() - 1; }
+
+    /**
+     * Returns the distance from the source to @a u, or none if @a u is not reachable.
+     */
+    count distance(node u) const { return dist[u]; }
+
+    /**
+     * Returns the number of shortest paths from the source to @a u.
+     */
+    double numberOfPaths(node u) const { return sigma[u]; }
+
+    /**
+     * Returns the dependency of the source on @a u.
+     */
+    double dependency(node u) const { return delta[u]; }
+
+    /**
+     * Calls @a handle(node u, double dependency) in parallel for every node u reached from the
+     * source, including the source itself. Every node is passed to exactly one call.
+     */
+    template <typename L>
+    void parallelForReachedNodes(L handle) const {
+#pragma omp parallel for schedule(static)
+        for (omp_index i = 0; i < static_cast<omp_index>(sorted.size()); ++i)
+            handle(sorted[i], delta[sorted[i]]);
+    }
+
+private:
+    const Graph *G;
+    const bool scaleByDistance;
+
+    std::vector<count> dist;
+    std::vector<double> sigma, delta;
+    std::vector<uint8_t> visited;
+
+    // Reached nodes in increasing distance, split into levels
+    std::vector<node> sorted;
+    std::vector<index> levelBegin;
+
+    // Per-thread buffers for the nodes discovered in the current level
+    std::vector<std::vector<node>> discovered;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CENTRALITY_FRONTIER_PARALLEL_BRANDES_HPP_
@@ -36,6 +36,15 @@ protected:
     static double defaultAlpha(const Graph &G);
 
 public:
+    enum Strategy {
+        // Fixed-point iteration x = alpha * A^T (x + 1) + beta
+        POWER_ITERATION,
+        // Solves (I - alpha * A) x = alpha * A * 1 + beta * 1 with the conjugate gradient method
+        // (i.e., Lanczos for this symmetric positive definite system); needs far fewer
+        // matrix-vector products when alpha is close to 1 / lambda_max. Undirected graphs only.
+        CONJUGATE_GRADIENT
+    };
+
     /**
      * Constructs a KatzCentrality object for the given Graph @a G. @a tol defines the tolerance for
      * convergence. Each iteration of the algorithm requires O(m) time. The number of iterations
@@ -56,6 +65,12 @@ public:
 
     // Whether to count in-edges or out-edges
     EdgeDirection edgeDirection = EdgeDirection::IN_EDGES;
+
+    // Solver used by run()
+    Strategy strategy = Strategy::POWER_ITERATION;
+
+private:
+    void runConjugateGradient();
 };
 
 } /* namespace NetworKit */
@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_CENTRALITY_TOP_CLOSENESS_HPP_
 #define NETWORKIT_CENTRALITY_TOP_CLOSENESS_HPP_
 
+#include <atomic>
 #include <memory>
 
 #include <networkit/base/Algorithm.hpp>
@@ -102,8 +103,9 @@ private:
     std::unique_ptr<StronglyConnectedComponents> sccsPtr;
 
     void init();
-    double BFScut(node v, double x, std::vector<bool> &visited, std::vector<count> &distances,
-                  std::vector<node> &pred, count &visEdges);
+    double BFScut(node v, const std::atomic<double> &x, std::vector<bool> &visited,
+                  std::vector<count> &distances, std::vector<node> &pred,
+                  std::vector<node> &queue, count &visEdges);
     void computelBound1(std::vector<double> &S);
     void BFSbound(node x, std::vector<double> &S, count &visEdges,
                   const std::vector<bool> &toAnalyze);
@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_CENTRALITY_TOP_HARMONIC_CLOSENESS_HPP_
 #define NETWORKIT_CENTRALITY_TOP_HARMONIC_CLOSENESS_HPP_
 
+#include <atomic>
 #include <memory>
 
 #include <networkit/auxiliary/VectorComparator.hpp>
@@ -125,6 +126,8 @@ private:
     std::vector<tlx::d_ary_addressable_int_heap<node, 2, Aux::LessInVector<edgeweight>>>
         dijkstraHeaps;
     std::vector<std::vector<edgeweight>> distanceGlobal;
+    // Nodes whose distance has been set by the current search, one vector per thread
+    std::vector<std::vector<node>> reachedGlobal;
     edgeweight minEdgeWeight;
 
     omp_lock_t lock;
@@ -132,8 +135,9 @@ private:
     void init();
     void runNBcut();
     void runNBbound();
-    bool bfscutUnweighted(node source, double kthCloseness);
-    bool bfscutWeighted(node source, double kthCloseness);
+    // The searches prune with the latest k-th closeness published by any thread.
+    bool bfscutUnweighted(node source, const std::atomic<double> &kthCloseness);
+    bool bfscutWeighted(node source, const std::atomic<double> &kthCloseness);
     void bfsbound(node source);
     void computeReachableNodes();
     void computeReachableNodesBounds();
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/structures/Partition.hpp>
 
@@ -31,6 +32,13 @@ public:
      */
     ComponentDecomposition(const Graph &G);
 
+    /**
+     * Constructs the ComponentDecomposition class for the given CSRGraph @a G.
+     *
+     * @param G The graph.
+     */
+    ComponentDecomposition(const CSRGraph &G);
+
     /**
      * Get the number of connected components.
      *
@@ -63,6 +71,7 @@ public:
     std::vector<std::vector<node>> getComponents() const;
 
 protected:
+    //!< nullptr if the decomposition has been constructed for a CSRGraph
     const Graph *G;
     Partition component;
 };
@@ -28,6 +28,12 @@ public:
      */
     ConnectedComponents(const Graph &G);
 
+    /* Creates the ConnectedComponents class for the CSR snapshot @G.
+     *
+     * @param G The graph.
+     */
+    ConnectedComponents(const CSRGraph &G);
+
     ~ConnectedComponents() override;
 
     /*
@@ -18,7 +18,8 @@ namespace NetworKit {
 
 /**
  * @ingroup distance
- * Class for all-pair shortest path algorithm.
+ * Class for all-pair shortest path algorithm. The distances are kept in memory; for larger
+ * graphs, see BlockedAPSP.
  */
 class APSP : public Algorithm {
 
@@ -38,6 +38,21 @@ public:
      * Breadth-first search from @a source.
      */
     void run() override;
+
+    enum Strategy {
+        //!< Sequential queue-based search
+        QUEUE,
+        //!< Parallel search that switches between top-down and bottom-up expansion of the
+        //!< levels, see Traversal::parallelBFSfrom(). Paths and the order of nodes sorted by
+        //!< distance are derived level by level after the search; the target is ignored, i.e.,
+        //!< the search does not stop early.
+        DIRECTION_OPTIMIZING
+    };
+
+    Strategy strategy = QUEUE;
+
+private:
+    void runDirectionOptimizing();
 };
 } /* namespace NetworKit */
 #endif // NETWORKIT_DISTANCE_BFS_HPP_
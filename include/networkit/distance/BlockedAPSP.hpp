@@ -0,0 +1,160 @@
+/*
+ * BlockedAPSP.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_BLOCKED_APSP_HPP_
+#define NETWORKIT_DISTANCE_BLOCKED_APSP_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * All-pairs shortest-path distances with bounded memory. Unlike APSP, the distance matrix is
+ * never kept in memory as a whole: the sources are processed in tiles of consecutive node ids,
+ * and each tile (the rows of its sources) is passed to a callback and/or appended to a matrix
+ * file, which can be mapped into memory afterwards. The distances are stored with a narrow type,
+ * e.g., one byte per hop count for unweighted graphs with small diameter.
+ *
+ * The rows of a tile are computed in parallel: unweighted graphs by bit-parallel BFSs from 64
+ * sources at once (see MultiSourceBFS), weighted graphs by one Dijkstra search per source.
+ * The matrix has one row and one column for every node id up to the upper node id bound;
+ * unreachable pairs (and deleted nodes) are stored as the largest value of the distance type.
+ */
+class BlockedAPSP final : public Algorithm {
+
+public:
+    /**
+     * Type of the stored distances. The integer types require an unweighted graph.
+     */
+    enum Encoding {
+        UINT8,   //!< hop counts up to 254
+        UINT16,  //!< hop counts up to 65534
+        UINT32,  //!< hop counts up to 2^32 - 2
+        FLOAT64, //!< edgeweight (double)
+        //! The smallest integer type that fits an upper bound of the distances of unweighted
+        //! graphs (twice the eccentricity of a node per component in undirected graphs, n - 1
+        //! in directed ones); FLOAT64 for weighted graphs
+        AUTO
+    };
+
+    /**
+     * The distances from the sources first, ..., first + rows - 1 to all nodes, stored row by
+     * row: the distance from first + i to v is at position i * columns + v of the data.
+     */
+    struct Tile {
+        node first;
+        count rows;
+        count columns;
+        Encoding encoding;
+        const void *data;
+
+        /**
+         * Returns the rows of the tile, where T must match the encoding (uint8_t, uint16_t,
+         * uint32_t, or edgeweight).
+         */
+        template <typename T>
+        std::span<const T> as() const {
+            return {static_cast<const T *>(data), rows * columns};
+        }
+
+        /**
+         * Returns the distance from the source @a first + @a row to @a v, or
+         * std::numeric_limits<edgeweight>::max() if @a v is not reachable.
+         */
+        edgeweight distance(index row, node v) const;
+    };
+
+    /**
+     * Creates the algorithm for the graph @a G.
+     *
+     * @param G The input graph.
+     */
+    BlockedAPSP(const Graph &G);
+
+    /**
+     * Loads a distance matrix that has been written by run(). The file is mapped into memory and
+     * used in place; it must not be modified while the object is in use. The distances can be
+     * queried right away.
+     *
+     * @param path Path of the matrix file.
+     */
+    explicit BlockedAPSP(std::string_view path);
+
+    /**
+     * Computes the distances tile by tile. Calls tileHandler (if set) for every tile in
+     * increasing order of the sources and appends the tile to the matrix file at outputPath (if
+     * set). Afterwards, the matrix file is mapped into memory.
+     */
+    void run() override;
+
+    /**
+     * Returns the distance from @a u to @a v, or std::numeric_limits<edgeweight>::max() if @a v
+     * is not reachable from @a u. Requires a matrix file, i.e., outputPath must have been set
+     * before run().
+     */
+    edgeweight getDistance(node u, node v) const;
+
+    /**
+     * Returns the encoding of the computed or loaded distances; AUTO is never returned.
+     */
+    Encoding getEncoding() const {
+        assureFinished();
+        return stored;
+    }
+
+    /**
+     * Returns the number of rows and columns of the matrix (the upper node id bound).
+     */
+    count numberOfNodes() const {
+        assureFinished();
+        return n;
+    }
+
+    //! Type of the stored distances
+    Encoding encoding = AUTO;
+
+    //! Number of sources per tile; if zero, tiles are as large as maxTileBytes allows.
+    count tileSize = 0;
+
+    //! Upper bound of the memory of a tile, used if tileSize is zero. Tiles of unweighted graphs
+    //! need 64 sources per thread to keep all threads busy.
+    count maxTileBytes = count{1} << 30;
+
+    //! If not empty, run() writes the matrix to this file.
+    std::string outputPath;
+
+    //! If set, run() calls it for every tile; the data is only valid during the call.
+    std::function<void(const Tile &)> tileHandler;
+
+private:
+    const Graph *G;
+    count n = 0;
+    Encoding stored = FLOAT64;
+
+    //!< keeps the memory referenced by matrix alive
+    std::shared_ptr<const void> storage;
+    const char *matrix = nullptr;
+
+    Encoding resolveEncoding() const;
+
+    void mapMatrix(std::string_view path);
+
+    template <typename T>
+    void computeTile(node first, count rows, T *data) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_BLOCKED_APSP_HPP_
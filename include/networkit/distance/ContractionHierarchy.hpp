@@ -0,0 +1,172 @@
+/*
+ * ContractionHierarchy.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_CONTRACTION_HIERARCHY_HPP_
+#define NETWORKIT_DISTANCE_CONTRACTION_HIERARCHY_HPP_
+
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Preprocessing-based index for point-to-point shortest-path queries on weighted graphs, based
+ * on "Exact Routing in Large Road Networks Using Contraction Hierarchies" from Geisberger et
+ * al., Transportation Science 2012. The nodes are contracted one after another; contracting a
+ * node adds shortcut edges between its neighbors unless a witness search finds a path that is
+ * at least as short. Queries then only need to search upwards in the hierarchy, see
+ * ContractionHierarchyQuery.
+ *
+ * The contraction runs in rounds: each round contracts, in parallel, all nodes whose priority
+ * (a weighted sum of edge difference and number of contracted neighbors) is smaller than the
+ * priority of all their neighbors. These nodes are pairwise non-adjacent, and their witness
+ * searches avoid the nodes of the round, so the result does not depend on the number of threads.
+ *
+ * Optionally, hub labels are extracted from the hierarchy as in "Hierarchical Hub Labelings
+ * for Shortest Paths" from Abraham et al., ESA 2012. The labels answer distance queries by a
+ * merge of two short sorted lists, see distance().
+ */
+class ContractionHierarchy final : public Algorithm {
+
+public:
+    /**
+     * Creates the index for the graph @a G. Edge weights must be non-negative.
+     *
+     * @param G The input graph.
+     * @param hubLabels If true, run() also extracts hub labels.
+     */
+    ContractionHierarchy(const Graph &G, bool hubLabels = false);
+
+    /**
+     * Loads an index that has been written by save(). The file is mapped into memory and the
+     * index is used in place, so loading takes constant time; the file must not be modified
+     * while the index is in use. The index can be queried right away.
+     *
+     * @param path Path of the index file.
+     */
+    explicit ContractionHierarchy(std::string_view path);
+
+    /**
+     * Contracts all nodes (and extracts the hub labels, if requested).
+     */
+    void run() override;
+
+    /**
+     * Returns the shortest-path distance from @a u to @a v, or
+     * std::numeric_limits<edgeweight>::max() if @a v is not reachable from @a u. Requires hub
+     * labels; queries do not modify the index, so they can be issued from multiple threads
+     * concurrently.
+     *
+     * @param u Source node.
+     * @param v Target node.
+     */
+    edgeweight distance(node u, node v) const;
+
+    /**
+     * Returns true iff the index contains hub labels.
+     */
+    bool hasHubLabels() const {
+        assureFinished();
+        return hubLabels;
+    }
+
+    /**
+     * Returns the position of node @a u in the contraction order.
+     */
+    index rank(node u) const {
+        assureFinished();
+        return ranks[u];
+    }
+
+    /**
+     * Returns the upper node id bound of the graph of the index.
+     */
+    count upperNodeIdBound() const {
+        assureFinished();
+        return ranks.size();
+    }
+
+    /**
+     * Returns the number of shortcut edges that have been added during the contraction.
+     */
+    count numberOfShortcuts() const {
+        assureFinished();
+        return shortcuts;
+    }
+
+    /**
+     * Returns the total number of hub labels of all nodes.
+     */
+    count numberOfLabels() const;
+
+    /**
+     * Writes the index to a file that can be loaded with ContractionHierarchy(path). All arrays
+     * start at page boundaries, so the file can be mapped into memory and used in place.
+     *
+     * @param path Path of the index file.
+     */
+    void save(std::string_view path) const;
+
+    /**
+     * Maximum number of nodes that a witness search settles. If the limit is reached, the
+     * remaining shortcuts are added without witness; this bounds the preprocessing time at the
+     * cost of superfluous shortcuts.
+     */
+    count witnessSearchLimit = 500;
+
+private:
+    friend class ContractionHierarchyQuery;
+
+    /**
+     * Upward edges of all nodes in CSR format: the edges of node u are stored at positions
+     * offsets[u], ..., offsets[u + 1] - 1. For shortcuts, middle is the contracted node that
+     * the shortcut bypasses; it is none for edges of the graph.
+     */
+    struct UpwardGraph {
+        std::span<const index> offsets;
+        std::span<const node> targets;
+        std::span<const edgeweight> weights;
+        std::span<const node> middles;
+    };
+
+    /**
+     * Hub labels in CSR format, sorted by the rank of the hubs. The labels of each node end
+     * with a sentinel whose hub is none.
+     */
+    struct HubLabels {
+        std::span<const index> offsets;
+        std::span<const index> hubs;
+        std::span<const edgeweight> distances;
+    };
+
+    const Graph *G;
+    bool directed;
+    bool hubLabels;
+    count shortcuts = 0;
+
+    //!< keep the memory referenced by the spans alive
+    std::shared_ptr<const void> storage, labelStorage;
+    std::span<const index> ranks;
+    // Edges to nodes of higher rank: upOut are out-edges, upIn are in-edges, i.e., the edge
+    // (x, u) is stored as (u, x) in upIn. Both views refer to the same edges in undirected
+    // graphs.
+    UpwardGraph upOut, upIn;
+    HubLabels labelsOut, labelsIn;
+
+    void extractHubLabels();
+
+    // Returns the weight and the middle node of the edge (u, v) in the hierarchy.
+    std::pair<edgeweight, node> findEdge(node u, node v) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_CONTRACTION_HIERARCHY_HPP_
@@ -0,0 +1,91 @@
+/*
+ * ContractionHierarchyQuery.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_CONTRACTION_HIERARCHY_QUERY_HPP_
+#define NETWORKIT_DISTANCE_CONTRACTION_HIERARCHY_QUERY_HPP_
+
+#include <vector>
+
+#include <networkit/auxiliary/VectorComparator.hpp>
+#include <networkit/distance/ContractionHierarchy.hpp>
+#include <networkit/distance/STSP.hpp>
+
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Source-target shortest paths with a ContractionHierarchy. Each query runs a bidirectional
+ * Dijkstra search that only relaxes edges to nodes of higher rank and stalls nodes that are
+ * reached suboptimally (stall-on-demand); the shortcuts of the resulting path are unpacked
+ * into edges of the graph. Distance-only queries use the hub labels of the index if it has
+ * them.
+ *
+ * The query object keeps its search state between runs, so repeated queries (e.g., after
+ * setSource() and setTarget()) only touch the nodes in their search spaces.
+ */
+class ContractionHierarchyQuery final : public STSP {
+
+public:
+    /**
+     * Creates the query for a graph @a G, its contraction hierarchy @a ch, source node @a
+     * source, and target node @a target.
+     *
+     * @param G The graph.
+     * @param ch Contraction hierarchy of @a G (it must have been run or loaded).
+     * @param source The source node.
+     * @param target The target node.
+     * @param storePred If true, the algorithm will also store the predecessors
+     * and reconstruct a shortest path from @a source and @a target.
+     */
+    ContractionHierarchyQuery(const Graph &G, const ContractionHierarchy &ch, node source,
+                              node target, bool storePred = true)
+        : STSP(G, source, target, storePred), ch(&ch) {
+        checkHierarchy();
+    }
+
+    /**
+     * Creates the query for a graph @a G, its contraction hierarchy @a ch, source node @a
+     * source, and multiple target nodes.
+     *
+     * @param G The graph.
+     * @param ch Contraction hierarchy of @a G (it must have been run or loaded).
+     * @param source The source node.
+     * @param targetsFirst,targetsLast Range of target nodes.
+     */
+    template <class InputIt>
+    ContractionHierarchyQuery(const Graph &G, const ContractionHierarchy &ch, node source,
+                              InputIt targetsFirst, InputIt targetsLast)
+        : STSP(G, source, targetsFirst, targetsLast), ch(&ch) {
+        checkHierarchy();
+    }
+
+    /**
+     * Runs the query.
+     */
+    void run() override;
+
+private:
+    const ContractionHierarchy *ch;
+
+    std::vector<edgeweight> distOut, distIn;
+    std::vector<node> predOut, predIn, touched;
+    tlx::d_ary_addressable_int_heap<node, 2, Aux::LessInVector<edgeweight>> heapOut{distOut},
+        heapIn{distIn};
+
+    void checkHierarchy() const;
+
+    // Returns the distance from s to t and sets meeting to the top node of a shortest path.
+    edgeweight search(node s, node t, node &meeting);
+
+    // Appends the nodes between u and v of the edge (u, v) of the hierarchy to nodes.
+    void unpackEdge(node u, node v, std::vector<node> &nodes) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_CONTRACTION_HIERARCHY_QUERY_HPP_
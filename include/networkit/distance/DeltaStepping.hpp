@@ -0,0 +1,63 @@
+/*
+ * DeltaStepping.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
+#define NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
+
+#include <networkit/distance/SSSP.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Parallel SSSP algorithm for graphs with non-negative edge weights, based on "Δ-stepping: a
+ * parallelizable shortest path algorithm" from Meyer and Sanders, Journal of Algorithms 2003.
+ * The nodes are kept in buckets of width delta according to their tentative distances. The
+ * buckets are processed in increasing order; the edges of all nodes of the current bucket are
+ * relaxed in parallel until the bucket stays empty. Small values of delta approach Dijkstra's
+ * algorithm, large values approach Bellman-Ford.
+ *
+ * Predecessors and numbers of shortest paths are derived from the final distances, so they
+ * are the same as those of Dijkstra. Unlike Dijkstra, the search does not stop as soon as the
+ * target is settled, but after the bucket of the target has been processed.
+ */
+class DeltaStepping final : public SSSP {
+
+public:
+    /**
+     * Creates the DeltaStepping class for @a G and the source node @a source.
+     *
+     * @param G The graph.
+     * @param source The source node.
+     * @param storePaths Paths are reconstructable and the number of paths is
+     *        stored.
+     * @param storeNodesSortedByDistance Store a vector of nodes ordered in
+     *        increasing distance from the source.
+     * @param target The target node.
+     */
+    DeltaStepping(const Graph &G, node source, bool storePaths = true,
+                  bool storeNodesSortedByDistance = false, node target = none);
+
+    /**
+     * Computes the distances from the source in parallel.
+     */
+    void run() override;
+
+    /**
+     * Width of the buckets. If zero, run() uses the maximum edge weight divided by the average
+     * degree (or 1 for unweighted graphs), which Meyer and Sanders suggest for random edge
+     * weights. Each thread keeps a cyclic array of maxWeight / delta + 2 buckets.
+     */
+    edgeweight delta = 0;
+
+private:
+    edgeweight maxEdgeWeight() const;
+
+    void computePaths();
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_DISTANCE_DELTA_STEPPING_HPP_
@@ -27,7 +27,9 @@ public:
      *
      * @param G The input graph.
      */
-    DynPrunedLandmarkLabeling(const Graph &G) : PrunedLandmarkLabeling(G) {}
+    DynPrunedLandmarkLabeling(const Graph &G) : PrunedLandmarkLabeling(G) {
+        keepLabelLists = true;
+    }
 
     ~DynPrunedLandmarkLabeling() override = default;
 
@@ -0,0 +1,181 @@
+/*
+ * MultiSourceBFS.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
+#define NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup distance
+ * Bit-parallel breadth-first search from up to 64 sources at once (MS-BFS). The sources that
+ * reach a node in the same level share a single scan of its neighborhood: the frontiers of all
+ * sources are stored as one 64 bit mask per node, bit i standing for the i-th source. In
+ * unweighted all-sources computations (closeness, betweenness) this amortizes the adjacency
+ * scans over a whole batch of sources.
+ *
+ * The searches follow the out-edges of directed graphs. An object can be reused for several
+ * batches of sources, but not concurrently.
+ */
+class MultiSourceBFS final {
+public:
+    using SourceMask = uint64_t;
+
+    // Maximum number of sources per batch
+    static constexpr count maxSources = 64;
+
+    /**
+     * @param G The unweighted graph; edge weights are ignored.
+     */
+    MultiSourceBFS(const Graph &G);
+
+    /**
+     * @param G The unweighted CSR snapshot; edge weights are ignored.
+     */
+    MultiSourceBFS(const CSRGraph &G);
+
+    /**
+     * Runs a breadth-first search from every node in @a sources. Calls @a handle(node u, count
+     * dist, SourceMask mask) once for every node u and every distance dist such that exactly the
+     * sources in @a mask reach u at distance dist. The nodes are visited in increasing distance.
+     *
+     * @param sources At most maxSources distinct nodes of the graph.
+     * @param handle Takes the node, the distance and the mask of the sources.
+     */
+    template <typename L>
+    void run(std::span<const node> sources, L handle) {
+        run(sources, handle, [](node, node, SourceMask) {});
+    }
+
+    /**
+     * Same as run(sources, handle), but additionally calls @a edgeHandle(node u, node v,
+     * SourceMask mask) for every edge (u, v) that lies on a shortest path from the sources in
+     * @a mask. The edges leaving the nodes at distance d are reported after @a handle has been
+     * called for all nodes at distance d and before it is called for any node at distance d + 1.
+     */
+    template <typename L, typename E>
+    void run(std::span<const node> sources, L handle, E edgeHandle);
+
+    /**
+     * Returns the number of levels of the last run, i.e., one plus the largest distance from any
+     * source to a reached node.
+     */
+    count numberOfLevels() const noexcept { return levelBegin.size() - 1; }
+
+    /**
+     * Calls @a handle(node u, SourceMask mask) for every node u that is reached at distance
+     * @a level from exactly the sources in mask during the last run.
+     */
+    template <typename L>
+    void forNodesAtLevel(count level, L handle) const {
+        for (index i = levelBegin[level]; i < levelBegin[level + 1]; ++i)
+            handle(visited[i], visitedMasks[i]);
+    }
+
+    /**
+     * Calls @a handle(node u, node v, edgeid eid, SourceMask mask) for every edge (u, v) from a
+     * node at distance @a level to a node at distance level + 1 that lies on a shortest path from
+     * the sources in mask, i.e., the shortest path DAGs of the last run restricted to one level.
+     */
+    template <typename L>
+    void forShortestPathEdgesFromLevel(count level, L handle);
+
+private:
+    // Exactly one of G and csr is set.
+    const Graph *G = nullptr;
+    const CSRGraph *csr = nullptr;
+
+    // Sources that have reached a node so far, and that reach it in the current/next level
+    std::vector<SourceMask> seen, frontier, next;
+
+    // Visited nodes with their source masks in increasing distance, split into levels
+    std::vector<node> visited;
+    std::vector<SourceMask> visitedMasks;
+    std::vector<index> levelBegin;
+
+    void initialize(std::span<const node> sources);
+
+    template <typename L>
+    void forEdgesOf(node u, L handle) const {
+        if (csr)
+            csr->forEdgesOf(u, handle);
+        else
+            G->forEdgesOf(u, handle);
+    }
+};
+
+template <typename L, typename E>
+void MultiSourceBFS::run(std::span<const node> sources, L handle, E edgeHandle) {
+    initialize(sources);
+    for (index i = 0; i < visited.size(); ++i)
+        handle(visited[i], count{0}, visitedMasks[i]);
+
+    count dist = 0;
+    while (levelBegin.back() < visited.size()) {
+        const index begin = levelBegin.back();
+        const index end = visited.size();
+        levelBegin.push_back(end);
+        ++dist;
+
+        for (index i = begin; i < end; ++i) {
+            const node u = visited[i];
+            const SourceMask mask = frontier[u];
+            forEdgesOf(u, [&](node v) {
+                const SourceMask newSources = mask & ~seen[v];
+                if (!newSources)
+                    return;
+                if (!next[v])
+                    visited.push_back(v);
+                next[v] |= newSources;
+                edgeHandle(u, v, newSources);
+            });
+        }
+
+        for (index i = begin; i < end; ++i)
+            frontier[visited[i]] = 0;
+        for (index i = end; i < visited.size(); ++i) {
+            const node v = visited[i];
+            seen[v] |= next[v];
+            frontier[v] = next[v];
+            visitedMasks.push_back(next[v]);
+            next[v] = 0;
+            handle(v, dist, frontier[v]);
+        }
+    }
+}
+
+template <typename L>
+void MultiSourceBFS::forShortestPathEdgesFromLevel(count level, L handle) {
+    if (level + 1 >= numberOfLevels())
+        return;
+
+    // Mark the nodes of the next level with the sources that reach them there.
+    for (index i = levelBegin[level + 1]; i < levelBegin[level + 2]; ++i)
+        frontier[visited[i]] = visitedMasks[i];
+
+    for (index i = levelBegin[level]; i < levelBegin[level + 1]; ++i) {
+        const SourceMask mask = visitedMasks[i];
+        forEdgesOf(visited[i], [&](node u, node v, edgeweight, edgeid eid) {
+            const SourceMask sources = mask & frontier[v];
+            if (sources)
+                handle(u, v, eid, sources);
+        });
+    }
+
+    for (index i = levelBegin[level + 1]; i < levelBegin[level + 2]; ++i)
+        frontier[visited[i]] = 0;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_DISTANCE_MULTI_SOURCE_BFS_HPP_
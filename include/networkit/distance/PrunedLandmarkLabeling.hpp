@@ -1,6 +1,10 @@
 #ifndef NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_HPP_
 #define NETWORKIT_DISTANCE_PRUNED_LANDMARK_LABELING_HPP_
 
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -19,17 +23,32 @@ public:
      * vertex. Labels are used to quickly retrieve shortest-path distances between node pairs.
      * @note this algorithm only works for unweighted graphs.
      *
+     * The labels are constructed in parallel, level by level as in "Scaling Distance Labeling on
+     * Small-World Networks" from Li et al., ACM SIGMOD 2019: the labels with distance d of a node
+     * are derived from the labels with distance d - 1 of its neighbors and pruned with the labels
+     * of smaller distance. This yields exactly the labels of the sequential pruned BFSs.
+     *
      * @param G The input graph.
      */
     PrunedLandmarkLabeling(const Graph &G);
 
+    /**
+     * Loads an index that has been written by save(). The file is mapped into memory and the
+     * labels are used in place, so loading takes constant time; the file must not be modified
+     * while the index is in use. The index can be queried right away.
+     *
+     * @param path Path of the index file.
+     */
+    explicit PrunedLandmarkLabeling(std::string_view path);
+
     /**
      * Computes distance labels. Run this function before calling 'query'.
      */
     void run() override;
 
     /**
-     * Returns the shortest-path distance between the two nodes.
+     * Returns the shortest-path distance between the two nodes. Queries do not modify the index,
+     * so they can be issued from multiple threads concurrently.
      *
      * @param u Source node.
      * @param v Target node.
@@ -38,10 +57,23 @@ public:
      */
     count query(node u, node v) const;
 
+    /**
+     * Returns the total number of labels of all nodes.
+     */
+    count numberOfLabels() const;
+
+    /**
+     * Writes the index to a file that can be loaded with PrunedLandmarkLabeling(path). All label
+     * arrays start at page boundaries, so the file can be mapped into memory and used in place.
+     *
+     * @param path Path of the index file.
+     */
+    void save(std::string_view path) const;
+
 protected:
     count queryImpl(node u, node v, node upperBound = none) const;
 
-    static constexpr count infDist = std::numeric_limits<count>::max();
+    static constexpr count infDist = none;
 
     struct Label {
         Label() : node_(none), distance_(infDist) {}
@@ -56,8 +88,9 @@ protected:
     std::vector<std::vector<Label>> labelsOut, labelsIn;
     std::vector<Label> labelsUCopy, labelsVCopy;
 
-    template <bool Reverse = false>
-    void prunedBFS(node root, node rankOfRootNode);
+    // If set, run() keeps the labels in labelsOut and labelsIn (e.g., to update them later)
+    // instead of moving them to the flattened arrays.
+    bool keepLabelLists = false;
 
     auto getSourceLabelsIterators(node u, bool reverse = false) const {
         if (reverse)
@@ -69,6 +102,45 @@ protected:
     auto getTargetLabelsIterators(node u) const {
         return std::make_pair(labelsOut[u].begin(), labelsOut[u].end());
     }
+
+private:
+    /**
+     * Flattened labels: the labels of node u are stored at positions offsets[u], ...,
+     * offsets[u + 1] - 1 of hubs (the ranks of the landmarks, increasing) and distances. The
+     * labels of each node end with a sentinel whose hub is none, which keeps the merge loop of
+     * queries free of bound checks.
+     */
+    struct FlatLabels {
+        std::span<const index> offsets;
+        std::span<const node> hubs;
+        std::span<const uint32_t> distances;
+    };
+
+    bool directed;
+    bool flattened = false;
+
+    //!< keeps the memory referenced by flatOut and flatIn alive
+    std::shared_ptr<const void> storage;
+    FlatLabels flatOut, flatIn;
+
+    // Scratch arrays of a thread in computeLevel, indexed by rank. They are reset after each
+    // node, so they are allocated once per run() and reused for all levels.
+    struct LevelBuffers {
+        std::vector<count> distances;
+        std::vector<uint8_t> isCandidate;
+        std::vector<node> candidates;
+    };
+
+    // Computes the out-labels (in-labels if Reverse is set) of distance level of the nodes in
+    // frontier and stores them in next.
+    template <bool Reverse>
+    void computeLevel(count level, const std::vector<index> &rank,
+                      const std::vector<index> &levelBegin, const std::vector<node> &frontier,
+                      std::vector<std::vector<Label>> &next, std::vector<LevelBuffers> &buffers);
+
+    void flattenLabels();
+
+    static count queryFlat(const FlatLabels &source, node u, const FlatLabels &target, node v);
 };
 
 } // namespace NetworKit
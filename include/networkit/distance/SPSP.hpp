@@ -119,6 +119,13 @@ public:
      */
     const std::unordered_map<node, index> &getTargetIndexMap() const noexcept { return targetIdx; }
 
+    /**
+     * If true and the graph is weighted, run() processes the sources one after the other, each
+     * with a parallel DeltaStepping search, instead of running one Dijkstra search per thread.
+     * This reduces the running time if there are fewer sources than threads.
+     */
+    bool useDeltaStepping = false;
+
 private:
     const Graph *G;
     std::vector<node> sources, targets;
@@ -136,6 +143,7 @@ private:
 
     void runWithTargets();
     void runWithoutTargets();
+    void runWithDeltaStepping();
 };
 
 } // namespace NetworKit
@@ -3,6 +3,9 @@
 #define NETWORKIT_GRAPH_BFS_HPP_
 
 #include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <queue>
 #include <vector>
 
@@ -31,13 +34,13 @@ auto callBFSHandle(F &f, node u, count) -> decltype(f(u)) {
 /**
  * Iterate over nodes in breadth-first search order starting from the nodes within the given range.
  *
- * @param G The input graph.
+ * @param G The input graph. Besides Graph, CSRGraph and CompressedGraph are supported.
  * @param first The first element of the range.
  * @param last The end of the range.
  * @param handle Takes a node as input parameter.
  */
-template <class InputIt, typename L>
-void BFSfrom(const Graph &G, InputIt first, InputIt last, L handle) {
+template <class GraphType, class InputIt, typename L>
+void BFSfrom(const GraphType &G, InputIt first, InputIt last, L handle) {
     std::vector<bool> marked(G.upperNodeIdBound());
     std::queue<node> q, qNext;
     count dist = 0;
@@ -71,12 +74,158 @@ void BFSfrom(const Graph &G, InputIt first, InputIt last, L handle) {
  * @param source The source node.
  * @param handle Takes a node as input parameter.
  */
-template <typename L>
-void BFSfrom(const Graph &G, node source, L handle) {
+template <class GraphType, typename L>
+void BFSfrom(const GraphType &G, node source, L handle) {
     std::array<node, 1> startNodes{{source}};
     BFSfrom(G, startNodes.begin(), startNodes.end(), handle);
 }
 
+/**
+ * Parallel, direction-optimizing breadth-first search from the nodes within the given range, as
+ * in "Direction-Optimizing Breadth-First Search" from Beamer et al., SC 2012. The levels are
+ * explored one after another. While the frontier is small, a level is expanded top-down: the
+ * frontier nodes visit their neighbors. Once the edges of the frontier exceed 1/alpha of the
+ * edges of the unvisited nodes, the search switches to bottom-up: each unvisited node scans its
+ * in-neighbors and stops at the first one in the frontier, which is kept as a bitmap. The search
+ * switches back when the frontier shrinks below n/beta nodes.
+ *
+ * @note The handle is called in parallel. All nodes at distance d are handled before the nodes
+ * at distance d + 1, but the nodes of a level are handled in no particular order.
+ *
+ * @param G The input graph. Besides Graph, CSRGraph and CompressedGraph are supported.
+ * @param first The first element of the range.
+ * @param last The end of the range.
+ * @param handle Takes a node and, optionally, its distance as input parameters.
+ * @param alpha,beta Parameters of the heuristic that switches between the directions.
+ */
+template <class GraphType, class InputIt, typename L>
+void parallelBFSfrom(const GraphType &G, InputIt first, InputIt last, L handle, count alpha = 15,
+                     count beta = 18) {
+    const count n = G.upperNodeIdBound();
+    const count words = (n + 63) / 64;
+    std::vector<uint64_t> visited(words), frontierBits(words);
+    std::vector<node> frontier, next;
+
+    auto isSet = [](const std::vector<uint64_t> &bits, node u) -> bool {
+        return (bits[u / 64] >> (u % 64)) & 1;
+    };
+
+    for (; first != last; ++first) {
+        if (!isSet(visited, *first)) {
+            visited[*first / 64] |= uint64_t{1} << (*first % 64);
+            frontier.push_back(*first);
+        }
+    }
+
+    // Edges of the frontier and of the unvisited nodes (counted at their sources)
+    auto edgesOf = [&](const std::vector<node> &nodes) {
+        count edges = 0;
+#pragma omp parallel for reduction(+ : edges)
+        for (omp_index i = 0; i < static_cast<omp_index>(nodes.size()); ++i)
+            edges += G.degree(nodes[i]);
+        return edges;
+    };
+    count frontierEdges = edgesOf(frontier);
+    count unvisitedEdges = (G.isDirected() ? 1 : 2) * G.numberOfEdges() - frontierEdges;
+
+    count dist = 0;
+    bool bottomUp = false;
+    while (!frontier.empty()) {
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i)
+            callBFSHandle(handle, frontier[i], dist);
+
+        const count previousSize = frontier.size();
+        if (!bottomUp && frontierEdges > unvisitedEdges / alpha) {
+            bottomUp = true;
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+#pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i)
+                std::atomic_ref<uint64_t>(frontierBits[frontier[i] / 64])
+                    .fetch_or(uint64_t{1} << (frontier[i] % 64), std::memory_order_relaxed);
+        }
+
+        next.clear();
+        if (bottomUp) {
+            auto hasParent = [&](node v) {
+                if (G.isDirected()) {
+                    for (const node u : G.inNeighborRange(v))
+                        if (isSet(frontierBits, u))
+                            return true;
+                } else {
+                    for (const node u : G.neighborRange(v))
+                        if (isSet(frontierBits, u))
+                            return true;
+                }
+                return false;
+            };
+
+            // Each thread owns whole words of the bitmaps, so no atomics are needed.
+            std::vector<uint64_t> nextBits(words);
+#pragma omp parallel
+            {
+                std::vector<node> localNext;
+#pragma omp for schedule(dynamic, 64) nowait
+                for (omp_index w = 0; w < static_cast<omp_index>(words); ++w) {
+                    for (uint64_t unvisited = ~visited[w]; unvisited; unvisited &= unvisited - 1) {
+                        const node v = w * 64 + std::countr_zero(unvisited);
+                        if (v >= n)
+                            break;
+                        if (G.hasNode(v) && hasParent(v)) {
+                            nextBits[w] |= uint64_t{1} << (v % 64);
+                            localNext.push_back(v);
+                        }
+                    }
+                    visited[w] |= nextBits[w];
+                }
+#pragma omp critical
+                next.insert(next.end(), localNext.begin(), localNext.end());
+            }
+            frontierBits.swap(nextBits);
+        } else {
+#pragma omp parallel
+            {
+                std::vector<node> localNext;
+#pragma omp for schedule(dynamic, 64) nowait
+                for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                    G.forNeighborsOf(frontier[i], [&](node v) {
+                        const uint64_t bit = uint64_t{1} << (v % 64);
+                        std::atomic_ref<uint64_t> word(visited[v / 64]);
+                        // Test first to avoid contention on the words of visited nodes
+                        if (word.load(std::memory_order_relaxed) & bit)
+                            return;
+                        if (!(word.fetch_or(bit, std::memory_order_relaxed) & bit))
+                            localNext.push_back(v);
+                    });
+                }
+#pragma omp critical
+                next.insert(next.end(), localNext.begin(), localNext.end());
+            }
+        }
+
+        frontier.swap(next);
+        frontierEdges = edgesOf(frontier);
+        unvisitedEdges -= std::min(unvisitedEdges, frontierEdges);
+        if (bottomUp && frontier.size() < previousSize && frontier.size() < n / beta)
+            bottomUp = false;
+        ++dist;
+    }
+}
+
+/**
+ * Parallel, direction-optimizing breadth-first search from the given source node, see
+ * parallelBFSfrom() with a range of start nodes.
+ *
+ * @param G The input graph.
+ * @param source The source node.
+ * @param handle Takes a node and, optionally, its distance as input parameters.
+ */
+template <class GraphType, typename L>
+void parallelBFSfrom(const GraphType &G, node source, L handle) {
+    std::array<node, 1> startNodes{{source}};
+    parallelBFSfrom(G, startNodes.begin(), startNodes.end(), handle);
+}
+
 /**
  * Iterate over edges in breadth-first search order starting from the given source node.
  *
@@ -84,8 +233,8 @@ void BFSfrom(const Graph &G, node source, L handle) {
  * @param source The source node.
  * @param handle Takes a node as input parameter.
  */
-template <typename L>
-void BFSEdgesFrom(const Graph &G, node source, L handle) {
+template <class GraphType, typename L>
+void BFSEdgesFrom(const GraphType &G, node source, L handle) {
     std::vector<bool> marked(G.upperNodeIdBound());
     std::queue<node> q;
     q.push(source); // enqueue root
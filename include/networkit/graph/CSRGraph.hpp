@@ -0,0 +1,717 @@
+/*
+ * CSRGraph.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+#define NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <omp.h>
+#include <span>
+#include <utility>
+
+#include <networkit/Globals.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Immutable snapshot of a Graph in compressed sparse row (CSR) format.
+ *
+ * Offsets, targets, weights and edge ids of all neighborhoods are packed into
+ * contiguous arrays instead of one heap-allocated vector per node. This roughly
+ * halves the memory footprint compared to Graph and improves cache locality of
+ * traversals. The node and edge iterators accept the same lambdas as their
+ * Graph counterparts and visit neighbors in the same order as the Graph the
+ * snapshot was created from. Node ids, edge ids and deleted nodes are preserved.
+ *
+ * Copies of a CSRGraph share the underlying arrays.
+ */
+class CSRGraph final {
+public:
+    /**
+     * Creates an empty snapshot without nodes.
+     */
+    CSRGraph() = default;
+
+    /**
+     * Creates a snapshot of @a G. Later modifications of @a G are not reflected.
+     *
+     * @param G The graph to snapshot.
+     */
+    explicit CSRGraph(const Graph &G);
+
+    /**
+     * Raw arrays of a CSR graph together with the graph properties that cannot
+     * be derived from them. The arrays follow the layout described at the
+     * private members of CSRGraph; the upper node id bound is
+     * <code>outOffsets.size() - 1</code>.
+     */
+    struct Arrays {
+        count numberOfNodes = 0;
+        count numberOfEdges = 0;
+        count numberOfSelfLoops = 0;
+        edgeid upperEdgeIdBound = 0;
+        bool weighted = false;
+        bool directed = false;
+        bool edgesIndexed = false;
+
+        std::span<const uint8_t> exists;
+        std::span<const index> outOffsets;
+        std::span<const node> outTargets;
+        std::span<const edgeweight> outWeights;
+        std::span<const edgeid> outIds;
+        std::span<const index> inOffsets;
+        std::span<const node> inTargets;
+        std::span<const edgeweight> inWeights;
+        std::span<const edgeid> inIds;
+    };
+
+    /**
+     * Creates a graph on top of externally owned arrays without copying them,
+     * e.g. on top of a memory-mapped file. Only the array sizes are validated;
+     * the contents are trusted.
+     *
+     * @param arrays The arrays and properties of the graph.
+     * @param owner Keeps the memory of @a arrays alive as long as any copy of
+     * the graph exists. May be empty if the caller guarantees the lifetime.
+     * @throws std::runtime_error if the sizes of the arrays are inconsistent.
+     */
+    CSRGraph(const Arrays &arrays, std::shared_ptr<const void> owner);
+
+    /**
+     * Creates a mutable Graph with the same nodes, edges, weights and edge ids
+     * as this snapshot.
+     */
+    Graph toGraph() const;
+
+    /**
+     * Returns @c true if the snapshot supports edge weights other than 1.0.
+     */
+    bool isWeighted() const noexcept { return weighted; }
+
+    /**
+     * Returns @c true if the snapshot is directed.
+     */
+    bool isDirected() const noexcept { return directed; }
+
+    /**
+     * Returns @c true if edge ids have been copied from the original graph.
+     */
+    bool hasEdgeIds() const noexcept { return edgesIndexed; }
+
+    /**
+     * Returns @c true if the snapshot contains no nodes.
+     */
+    bool isEmpty() const noexcept { return !n; }
+
+    /**
+     * Returns the number of nodes.
+     */
+    count numberOfNodes() const noexcept { return n; }
+
+    /**
+     * Returns the number of edges.
+     */
+    count numberOfEdges() const noexcept { return m; }
+
+    /**
+     * Returns the number of self-loops.
+     */
+    count numberOfSelfLoops() const noexcept { return storedNumberOfSelfLoops; }
+
+    /**
+     * Returns an upper bound for the node ids.
+     */
+    index upperNodeIdBound() const noexcept { return z; }
+
+    /**
+     * Returns an upper bound for the edge ids.
+     */
+    index upperEdgeIdBound() const noexcept { return omega; }
+
+    /**
+     * Checks if node @a v exists.
+     */
+    bool hasNode(node v) const noexcept { return v < z && (exists.empty() || exists[v]); }
+
+    /**
+     * Returns the number of outgoing neighbors of @a v.
+     */
+    count degree(node v) const {
+        assert(hasNode(v));
+        return outOffsets[v + 1] - outOffsets[v];
+    }
+
+    /**
+     * Returns the number of outgoing neighbors of @a v.
+     */
+    count degreeOut(node v) const { return degree(v); }
+
+    /**
+     * Returns the number of incoming neighbors of @a v. For undirected
+     * snapshots, the outgoing degree is returned.
+     */
+    count degreeIn(node v) const {
+        assert(hasNode(v));
+        return directed ? inOffsets[v + 1] - inOffsets[v] : degree(v);
+    }
+
+    /**
+     * Checks whether @a v is isolated, i.e. has neither in- nor out-neighbors.
+     */
+    bool isIsolated(node v) const { return degree(v) == 0 && (!directed || degreeIn(v) == 0); }
+
+    /**
+     * Returns the weighted (out-)degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegree(node u, bool countSelfLoopsTwice = false) const;
+
+    /**
+     * Returns the weighted in-degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegreeIn(node u, bool countSelfLoopsTwice = false) const;
+
+    /**
+     * Returns the sum of all edge weights.
+     */
+    edgeweight totalEdgeWeight() const noexcept;
+
+    /**
+     * Checks if the edge (@a u, @a v) exists. Running time is O(deg(u)).
+     */
+    bool hasEdge(node u, node v) const noexcept;
+
+    /**
+     * Returns the weight of the edge (@a u, @a v) or 0 if the edge does not
+     * exist. Running time is O(deg(u)).
+     */
+    edgeweight weight(node u, node v) const;
+
+    /**
+     * Returns the i-th (outgoing) neighbor of @a u.
+     */
+    node getIthNeighbor(Unsafe, node u, index i) const { return outTargets[outOffsets[u] + i]; }
+
+    /**
+     * Returns the weight of the edge to the i-th (outgoing) neighbor of @a u.
+     */
+    edgeweight getIthNeighborWeight(Unsafe, node u, index i) const {
+        return weighted ? outWeights[outOffsets[u] + i] : defaultEdgeWeight;
+    }
+
+    /**
+     * Returns the (outgoing) neighbors of @a u as a contiguous range.
+     */
+    std::span<const node> neighborRange(node u) const {
+        assert(hasNode(u));
+        return outTargets.subspan(outOffsets[u], outOffsets[u + 1] - outOffsets[u]);
+    }
+
+    /**
+     * Returns the incoming neighbors of @a u as a contiguous range.
+     */
+    std::span<const node> inNeighborRange(node u) const {
+        assert(isDirected());
+        assert(hasNode(u));
+        return inTargets.subspan(inOffsets[u], inOffsets[u + 1] - inOffsets[u]);
+    }
+
+    /**
+     * Returns the weights of the (outgoing) edges of @a u in the same order as
+     * neighborRange(u).
+     */
+    std::span<const edgeweight> neighborWeightRange(node u) const {
+        assert(isWeighted());
+        assert(hasNode(u));
+        return outWeights.subspan(outOffsets[u], outOffsets[u + 1] - outOffsets[u]);
+    }
+
+    /**
+     * Returns the weights of the incoming edges of @a u in the same order as
+     * inNeighborRange(u).
+     */
+    std::span<const edgeweight> inNeighborWeightRange(node u) const {
+        assert(isDirected());
+        assert(isWeighted());
+        assert(hasNode(u));
+        return inWeights.subspan(inOffsets[u], inOffsets[u + 1] - inOffsets[u]);
+    }
+
+    /* NODE ITERATORS */
+
+    /**
+     * Iterates over all nodes and calls @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void forNodes(L handle) const;
+
+    /**
+     * Iterates in parallel over all nodes and calls @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void parallelForNodes(L handle) const;
+
+    /**
+     * Iterates over all nodes and calls @a handle (lambda closure) as long as
+     * @a condition remains true.
+     *
+     * @param condition Returning <code>false</code> breaks the loop.
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename C, typename L>
+    void forNodesWhile(C condition, L handle) const;
+
+    /**
+     * Iterates in parallel over all nodes and calls @a handle (lambda closure).
+     * Uses schedule(guided) to remedy load imbalances due to unequal degrees.
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void balancedParallelForNodes(L handle) const;
+
+    /* EDGE ITERATORS */
+
+    /**
+     * Iterates over all edges and calls @a handle (lambda closure).
+     *
+     * @param handle Takes parameters <code>(node, node)</code>, <code>(node,
+     * node, edgweight)</code>, <code>(node, node, edgeid)</code> or
+     * <code>(node, node, edgeweight, edgeid)</code>.
+     */
+    template <typename L>
+    void forEdges(L handle) const;
+
+    /**
+     * Iterates in parallel over all edges and calls @a handle (lambda closure).
+     *
+     * @param handle Takes the same parameters as in forEdges.
+     */
+    template <typename L>
+    void parallelForEdges(L handle) const;
+
+    /* NEIGHBORHOOD ITERATORS */
+
+    /**
+     * Iterates over all (outgoing) neighbors of @a u and calls @a handle.
+     *
+     * @param handle Takes parameter <code>(node)</code> or <code>(node,
+     * edgeweight)</code> which is a neighbor of @a u.
+     */
+    template <typename L>
+    void forNeighborsOf(node u, L handle) const;
+
+    /**
+     * Iterates over all (outgoing) edges of @a u and calls @a handle.
+     *
+     * @param handle Takes the same parameters as in forEdges, where the first
+     * node is @a u.
+     */
+    template <typename L>
+    void forEdgesOf(node u, L handle) const;
+
+    /**
+     * Iterates over all incoming neighbors of @a u and calls @a handle. For
+     * undirected snapshots this is the same as forNeighborsOf.
+     */
+    template <typename L>
+    void forInNeighborsOf(node u, L handle) const;
+
+    /**
+     * Iterates over all incoming edges of @a u and calls @a handle. For
+     * undirected snapshots this is the same as forEdgesOf.
+     */
+    template <typename L>
+    void forInEdgesOf(node u, L handle) const;
+
+    /* REDUCTION ITERATORS */
+
+    /**
+     * Iterates in parallel over all nodes and sums (reduce +) the values
+     * returned by @a handle.
+     */
+    template <typename L>
+    double parallelSumForNodes(L handle) const;
+
+    /**
+     * Iterates in parallel over all edges and sums (reduce +) the values
+     * returned by @a handle.
+     */
+    template <typename L>
+    double parallelSumForEdges(L handle) const;
+
+private:
+    struct Storage;
+
+    count n = 0;
+    count m = 0;
+    count storedNumberOfSelfLoops = 0;
+    node z = 0;
+    edgeid omega = 0;
+    bool weighted = false;
+    bool directed = false;
+    bool edgesIndexed = false;
+
+    //!< keeps the memory referenced by the arrays below alive
+    std::shared_ptr<const void> storage;
+
+    //!< exists[v] is nonzero if v is a node; empty if no node has been deleted
+    std::span<const uint8_t> exists;
+
+    //!< neighbors of u are outTargets[outOffsets[u]], ..., outTargets[outOffsets[u + 1] - 1]
+    std::span<const index> outOffsets;
+    std::span<const node> outTargets;
+    //!< same schema as outTargets; empty if unweighted
+    std::span<const edgeweight> outWeights;
+    //!< same schema as outTargets; empty if edges are not indexed
+    std::span<const edgeid> outIds;
+
+    //!< only used for directed graphs, same schema as the out-arrays
+    std::span<const index> inOffsets;
+    std::span<const node> inTargets;
+    std::span<const edgeweight> inWeights;
+    std::span<const edgeid> inIds;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    inline void forOutEdgesOfImpl(node u, L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    inline void forInEdgesOfImpl(node u, L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    inline void forEdgeImpl(L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    inline void parallelForEdgesImpl(L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+    inline double parallelSumForEdgesImpl(L &handle) const;
+};
+
+/* NODE ITERATORS */
+
+template <typename L>
+void CSRGraph::forNodes(L handle) const {
+    for (node v = 0; v < z; ++v) {
+        if (hasNode(v)) {
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+void CSRGraph::parallelForNodes(L handle) const {
+#pragma omp parallel for
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (hasNode(v)) {
+            handle(v);
+        }
+    }
+}
+
+template <typename C, typename L>
+void CSRGraph::forNodesWhile(C condition, L handle) const {
+    for (node v = 0; v < z; ++v) {
+        if (hasNode(v)) {
+            if (!condition()) {
+                break;
+            }
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+void CSRGraph::balancedParallelForNodes(L handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (hasNode(v)) {
+            handle(v);
+        }
+    }
+}
+
+/* EDGE ITERATORS */
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forOutEdgesOfImpl(node u, L &handle) const {
+    const index end = outOffsets[u + 1];
+    for (index i = outOffsets[u]; i < end; ++i) {
+        const node v = outTargets[i];
+
+        // undirected: visit each edge {u, v} only once
+        if (graphIsDirected || u >= v) {
+            Graph::edgeLambda<L>(handle, u, v, hasWeights ? outWeights[i] : defaultEdgeWeight,
+                                 graphHasEdgeIds ? outIds[i] : none);
+        }
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forInEdgesOfImpl(node u, L &handle) const {
+    if (graphIsDirected) {
+        const index end = inOffsets[u + 1];
+        for (index i = inOffsets[u]; i < end; ++i) {
+            Graph::edgeLambda<L>(handle, u, inTargets[i],
+                                 hasWeights ? inWeights[i] : defaultEdgeWeight,
+                                 graphHasEdgeIds ? inIds[i] : none);
+        }
+    } else {
+        forOutEdgesOfImpl<true, hasWeights, graphHasEdgeIds, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::forEdgeImpl(L &handle) const {
+    for (node u = 0; u < z; ++u) {
+        forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline void CSRGraph::parallelForEdgesImpl(L &handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        forOutEdgesOfImpl<graphIsDirected, hasWeights, graphHasEdgeIds, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, bool graphHasEdgeIds, typename L>
+inline double CSRGraph::parallelSumForEdgesImpl(L &handle) const {
+    double sum = 0.0;
+
+#pragma omp parallel for reduction(+ : sum)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        const index end = outOffsets[u + 1];
+        for (index i = outOffsets[u]; i < end; ++i) {
+            const node v = outTargets[i];
+            if (graphIsDirected || u >= v) {
+                sum += Graph::edgeLambda<L>(handle, u, v,
+                                            hasWeights ? outWeights[i] : defaultEdgeWeight,
+                                            graphHasEdgeIds ? outIds[i] : none);
+            }
+        }
+    }
+
+    return sum;
+}
+
+template <typename L>
+void CSRGraph::forEdges(L handle) const {
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edgeIds
+        forEdgeImpl<false, false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected, no edgeIds
+        forEdgeImpl<false, true, false, L>(handle);
+        break;
+
+    case 2: // unweighted, directed, no edgeIds
+        forEdgeImpl<true, false, false, L>(handle);
+        break;
+
+    case 3: // weighted, directed, no edgeIds
+        forEdgeImpl<true, true, false, L>(handle);
+        break;
+
+    case 4: // unweighted, undirected, with edgeIds
+        forEdgeImpl<false, false, true, L>(handle);
+        break;
+
+    case 5: // weighted,   undirected, with edgeIds
+        forEdgeImpl<false, true, true, L>(handle);
+        break;
+
+    case 6: // unweighted, directed, with edgeIds
+        forEdgeImpl<true, false, true, L>(handle);
+        break;
+
+    case 7: // weighted,   directed, with edgeIds
+        forEdgeImpl<true, true, true, L>(handle);
+        break;
+    }
+}
+
+template <typename L>
+void CSRGraph::parallelForEdges(L handle) const {
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edgeIds
+        parallelForEdgesImpl<false, false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected, no edgeIds
+        parallelForEdgesImpl<false, true, false, L>(handle);
+        break;
+
+    case 2: // unweighted, directed, no edgeIds
+        parallelForEdgesImpl<true, false, false, L>(handle);
+        break;
+
+    case 3: // weighted, directed, no edgeIds
+        parallelForEdgesImpl<true, true, false, L>(handle);
+        break;
+
+    case 4: // unweighted, undirected, with edgeIds
+        parallelForEdgesImpl<false, false, true, L>(handle);
+        break;
+
+    case 5: // weighted,   undirected, with edgeIds
+        parallelForEdgesImpl<false, true, true, L>(handle);
+        break;
+
+    case 6: // unweighted, directed, with edgeIds
+        parallelForEdgesImpl<true, false, true, L>(handle);
+        break;
+
+    case 7: // weighted,   directed, with edgeIds
+        parallelForEdgesImpl<true, true, true, L>(handle);
+        break;
+    }
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template <typename L>
+void CSRGraph::forNeighborsOf(node u, L handle) const {
+    forEdgesOf(u, handle);
+}
+
+template <typename L>
+void CSRGraph::forEdgesOf(node u, L handle) const {
+    switch (weighted + 2 * edgesIndexed) {
+    case 0: // not weighted, no edge ids
+        forOutEdgesOfImpl<true, false, false, L>(u, handle);
+        break;
+
+    case 1: // weighted, no edge ids
+        forOutEdgesOfImpl<true, true, false, L>(u, handle);
+        break;
+
+    case 2: // not weighted, with edge ids
+        forOutEdgesOfImpl<true, false, true, L>(u, handle);
+        break;
+
+    case 3: // weighted, with edge ids
+        forOutEdgesOfImpl<true, true, true, L>(u, handle);
+        break;
+    }
+}
+
+template <typename L>
+void CSRGraph::forInNeighborsOf(node u, L handle) const {
+    forInEdgesOf(u, handle);
+}
+
+template <typename L>
+void CSRGraph::forInEdgesOf(node u, L handle) const {
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edge ids
+        forInEdgesOfImpl<false, false, false, L>(u, handle);
+        break;
+
+    case 1: // weighted, undirected, no edge ids
+        forInEdgesOfImpl<false, true, false, L>(u, handle);
+        break;
+
+    case 2: // unweighted, directed, no edge ids
+        forInEdgesOfImpl<true, false, false, L>(u, handle);
+        break;
+
+    case 3: // weighted, directed, no edge ids
+        forInEdgesOfImpl<true, true, false, L>(u, handle);
+        break;
+
+    case 4: // unweighted, undirected, with edge ids
+        forInEdgesOfImpl<false, false, true, L>(u, handle);
+        break;
+
+    case 5: // weighted, undirected, with edge ids
+        forInEdgesOfImpl<false, true, true, L>(u, handle);
+        break;
+
+    case 6: // unweighted, directed, with edge ids
+        forInEdgesOfImpl<true, false, true, L>(u, handle);
+        break;
+
+    case 7: // weighted, directed, with edge ids
+        forInEdgesOfImpl<true, true, true, L>(u, handle);
+        break;
+    }
+}
+
+/* REDUCTION ITERATORS */
+
+template <typename L>
+double CSRGraph::parallelSumForNodes(L handle) const {
+    double sum = 0.0;
+
+#pragma omp parallel for reduction(+ : sum)
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (hasNode(v)) {
+            sum += handle(v);
+        }
+    }
+
+    return sum;
+}
+
+template <typename L>
+double CSRGraph::parallelSumForEdges(L handle) const {
+    double sum = 0.0;
+
+    switch (weighted + 2 * directed + 4 * edgesIndexed) {
+    case 0: // unweighted, undirected, no edge ids
+        sum = parallelSumForEdgesImpl<false, false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected, no edge ids
+        sum = parallelSumForEdgesImpl<false, true, false, L>(handle);
+        break;
+
+    case 2: // unweighted, directed, no edge ids
+        sum = parallelSumForEdgesImpl<true, false, false, L>(handle);
+        break;
+
+    case 3: // weighted,   directed, no edge ids
+        sum = parallelSumForEdgesImpl<true, true, false, L>(handle);
+        break;
+
+    case 4: // unweighted, undirected, with edge ids
+        sum = parallelSumForEdgesImpl<false, false, true, L>(handle);
+        break;
+
+    case 5: // weighted,   undirected, with edge ids
+        sum = parallelSumForEdgesImpl<false, true, true, L>(handle);
+        break;
+
+    case 6: // unweighted, directed, with edge ids
+        sum = parallelSumForEdgesImpl<true, false, true, L>(handle);
+        break;
+
+    case 7: // weighted,   directed, with edge ids
+        sum = parallelSumForEdgesImpl<true, true, true, L>(handle);
+        break;
+    }
+
+    return sum;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_CSR_GRAPH_HPP_
@@ -0,0 +1,714 @@
+/*
+ * CompressedGraph.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_GRAPH_COMPRESSED_GRAPH_HPP_
+#define NETWORKIT_GRAPH_COMPRESSED_GRAPH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <omp.h>
+#include <span>
+
+#include <networkit/Globals.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup graph
+ * Immutable, compressed snapshot of a Graph for memory-bound traversal workloads.
+ *
+ * The neighborhood of every node is sorted and stored as a sequence of gaps between consecutive
+ * neighbors, each encoded as a byte-aligned variable-length integer (7 bits per byte). The first
+ * neighbor is encoded relative to the node itself, so neighborhoods with good locality need one
+ * or two bytes per neighbor instead of eight. Neighbors are decoded on the fly by the iterators,
+ * which accept the same lambdas as their Graph counterparts. Edge weights are stored uncompressed
+ * in the order of the sorted neighbors.
+ *
+ * A CompressedGraph is created either from a Graph or, to avoid holding the uncompressed graph
+ * in memory, from a stream of edges (see StreamingGraphReader::readCompressed).
+ *
+ * In contrast to Graph and CSRGraph, neighbors are visited in ascending order of their ids and
+ * random access to the i-th neighbor is not supported. Edge ids are not preserved. Copies of a
+ * CompressedGraph share the underlying arrays.
+ */
+class CompressedGraph final {
+public:
+    /**
+     * Forward iterator decoding the neighbors of a node in ascending order.
+     */
+    class NeighborIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = node;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const node *;
+        using reference = node;
+
+        NeighborIterator() = default;
+
+        NeighborIterator(const uint8_t *next, count remaining, node current)
+            : next(next), remaining(remaining), current(current) {}
+
+        node operator*() const noexcept { return current; }
+
+        NeighborIterator &operator++() noexcept {
+            if (--remaining)
+                current += decodeVarInt(next);
+            return *this;
+        }
+
+        NeighborIterator operator++(int) noexcept {
+            const NeighborIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        // Iterators are only compared within the same neighborhood.
+        bool operator==(const NeighborIterator &other) const noexcept {
+            return remaining == other.remaining;
+        }
+
+        bool operator!=(const NeighborIterator &other) const noexcept { return !(*this == other); }
+
+    private:
+        const uint8_t *next = nullptr;
+        count remaining = 0;
+        node current = none;
+    };
+
+    /**
+     * The (sorted) neighbors of a node, decoded while iterating.
+     */
+    class NeighborRange {
+    public:
+        NeighborRange(const uint8_t *data, node u) {
+            if (data) {
+                numNeighbors = decodeVarInt(data);
+                first = static_cast<node>(static_cast<int64_t>(u) + zigzagDecode(data));
+                next = data;
+            }
+        }
+
+        NeighborIterator begin() const noexcept { return {next, numNeighbors, first}; }
+
+        NeighborIterator end() const noexcept { return {}; }
+
+        count size() const noexcept { return numNeighbors; }
+
+    private:
+        const uint8_t *next = nullptr;
+        count numNeighbors = 0;
+        node first = none;
+    };
+
+    /**
+     * Creates an empty snapshot without nodes.
+     */
+    CompressedGraph() = default;
+
+    /**
+     * Creates a compressed snapshot of @a G. Later modifications of @a G are not reflected.
+     *
+     * @param G The graph to compress.
+     */
+    explicit CompressedGraph(const Graph &G);
+
+    //! Receives a batch of edges of a stream.
+    using EdgeBatchHandler = std::function<void(std::span<const WeightedEdge>)>;
+
+    //! Properties of a graph given as a stream of edges, known after the stream has ended.
+    struct StreamProperties {
+        count numberOfNodes = 0;
+        bool weighted = false;
+        bool directed = false;
+        //! Weight of a repeated edge, given the weight so far and the weight of the repetition.
+        //! If empty, the weight of the first occurrence is kept.
+        std::function<edgeweight(edgeweight, edgeweight)> mergeWeights;
+    };
+
+    //! Passes all edges of a graph to the handler and returns the properties of the graph.
+    using EdgeStream = std::function<StreamProperties(const EdgeBatchHandler &)>;
+
+    static constexpr count defaultMaxBufferedNeighbors = count{1} << 24;
+
+    /**
+     * Creates a compressed graph from a stream of edges (e.g., from a StreamingGraphReader)
+     * without materializing a Graph. The stream is consumed once to count the degrees and then
+     * once per block of consecutive nodes whose neighborhoods fit into @a maxBufferedNeighbors
+     * entries (twice as many blocks for directed graphs, which also store the in-neighborhoods).
+     * Apart from the compressed arrays, only the degrees and one block are held in memory.
+     * Repeated edges are merged into one edge, see StreamProperties::mergeWeights.
+     *
+     * @param edges Stream of the edges; must pass the same edges every time it is called.
+     * @param maxBufferedNeighbors Maximum number of uncompressed neighbors held in memory; a
+     *        single node of higher degree forms a block of its own.
+     */
+    explicit CompressedGraph(const EdgeStream &edges,
+                             count maxBufferedNeighbors = defaultMaxBufferedNeighbors);
+
+    /**
+     * Creates a mutable Graph with the same nodes, edges and weights as this snapshot. The
+     * neighborhoods of the result are sorted.
+     */
+    Graph toGraph() const;
+
+    /**
+     * Returns @c true if the snapshot supports edge weights other than 1.0.
+     */
+    bool isWeighted() const noexcept { return weighted; }
+
+    /**
+     * Returns @c true if the snapshot is directed.
+     */
+    bool isDirected() const noexcept { return directed; }
+
+    /**
+     * Returns @c true if the snapshot contains no nodes.
+     */
+    bool isEmpty() const noexcept { return !n; }
+
+    /**
+     * Returns the number of nodes.
+     */
+    count numberOfNodes() const noexcept { return n; }
+
+    /**
+     * Returns the number of edges.
+     */
+    count numberOfEdges() const noexcept { return m; }
+
+    /**
+     * Returns the number of self-loops.
+     */
+    count numberOfSelfLoops() const noexcept { return storedNumberOfSelfLoops; }
+
+    /**
+     * Returns an upper bound for the node ids.
+     */
+    index upperNodeIdBound() const noexcept { return z; }
+
+    /**
+     * Checks if node @a v exists.
+     */
+    bool hasNode(node v) const noexcept { return v < z && (exists.empty() || exists[v]); }
+
+    /**
+     * Returns the number of bytes occupied by the arrays of the snapshot.
+     */
+    count memoryUsage() const noexcept;
+
+    /**
+     * Returns the number of outgoing neighbors of @a v.
+     */
+    count degree(node v) const {
+        assert(hasNode(v));
+        return decodeDegree(outOffsets, outBytes, v);
+    }
+
+    /**
+     * Returns the number of outgoing neighbors of @a v.
+     */
+    count degreeOut(node v) const { return degree(v); }
+
+    /**
+     * Returns the number of incoming neighbors of @a v. For undirected snapshots, the outgoing
+     * degree is returned.
+     */
+    count degreeIn(node v) const {
+        assert(hasNode(v));
+        return directed ? decodeDegree(inOffsets, inBytes, v) : degree(v);
+    }
+
+    /**
+     * Checks whether @a v is isolated, i.e. has neither in- nor out-neighbors.
+     */
+    bool isIsolated(node v) const { return degree(v) == 0 && (!directed || degreeIn(v) == 0); }
+
+    /**
+     * Returns the weighted (out-)degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegree(node u, bool countSelfLoopsTwice = false) const;
+
+    /**
+     * Returns the weighted in-degree of @a u.
+     *
+     * @param u Node.
+     * @param countSelfLoopsTwice If set to true, self-loops will be counted twice.
+     */
+    edgeweight weightedDegreeIn(node u, bool countSelfLoopsTwice = false) const;
+
+    /**
+     * Returns the sum of all edge weights.
+     */
+    edgeweight totalEdgeWeight() const noexcept;
+
+    /**
+     * Checks if the edge (@a u, @a v) exists. Running time is O(deg(u)), but decoding stops at
+     * the first neighbor larger than @a v.
+     */
+    bool hasEdge(node u, node v) const noexcept;
+
+    /**
+     * Returns the weight of the edge (@a u, @a v) or 0 if the edge does not exist. Running time
+     * is O(deg(u)).
+     */
+    edgeweight weight(node u, node v) const;
+
+    /**
+     * Returns the (outgoing) neighbors of @a u in ascending order.
+     */
+    NeighborRange neighborRange(node u) const {
+        assert(hasNode(u));
+        return {adjacencyData(outOffsets, outBytes, u), u};
+    }
+
+    /**
+     * Returns the incoming neighbors of @a u in ascending order.
+     */
+    NeighborRange inNeighborRange(node u) const {
+        assert(isDirected());
+        assert(hasNode(u));
+        return {adjacencyData(inOffsets, inBytes, u), u};
+    }
+
+    /* NODE ITERATORS */
+
+    /**
+     * Iterates over all nodes and calls @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void forNodes(L handle) const;
+
+    /**
+     * Iterates in parallel over all nodes and calls @a handle (lambda closure).
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void parallelForNodes(L handle) const;
+
+    /**
+     * Iterates over all nodes and calls @a handle (lambda closure) as long as @a condition
+     * remains true.
+     *
+     * @param condition Returning <code>false</code> breaks the loop.
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename C, typename L>
+    void forNodesWhile(C condition, L handle) const;
+
+    /**
+     * Iterates in parallel over all nodes and calls @a handle (lambda closure). Uses
+     * schedule(guided) to remedy load imbalances due to unequal degrees.
+     *
+     * @param handle Takes parameter <code>(node)</code>.
+     */
+    template <typename L>
+    void balancedParallelForNodes(L handle) const;
+
+    /* EDGE ITERATORS */
+
+    /**
+     * Iterates over all edges and calls @a handle (lambda closure).
+     *
+     * @param handle Takes parameters <code>(node, node)</code>, <code>(node, node,
+     * edgweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node, edgeweight,
+     * edgeid)</code>. The edge id is always @c none.
+     */
+    template <typename L>
+    void forEdges(L handle) const;
+
+    /**
+     * Iterates in parallel over all edges and calls @a handle (lambda closure).
+     *
+     * @param handle Takes the same parameters as in forEdges.
+     */
+    template <typename L>
+    void parallelForEdges(L handle) const;
+
+    /* NEIGHBORHOOD ITERATORS */
+
+    /**
+     * Iterates over all (outgoing) neighbors of @a u in ascending order and calls @a handle.
+     *
+     * @param handle Takes parameter <code>(node)</code> or <code>(node, edgeweight)</code> which
+     * is a neighbor of @a u.
+     */
+    template <typename L>
+    void forNeighborsOf(node u, L handle) const;
+
+    /**
+     * Iterates over all (outgoing) edges of @a u and calls @a handle.
+     *
+     * @param handle Takes the same parameters as in forEdges, where the first node is @a u.
+     */
+    template <typename L>
+    void forEdgesOf(node u, L handle) const;
+
+    /**
+     * Iterates over all incoming neighbors of @a u and calls @a handle. For undirected snapshots
+     * this is the same as forNeighborsOf.
+     */
+    template <typename L>
+    void forInNeighborsOf(node u, L handle) const;
+
+    /**
+     * Iterates over all incoming edges of @a u and calls @a handle. For undirected snapshots this
+     * is the same as forEdgesOf.
+     */
+    template <typename L>
+    void forInEdgesOf(node u, L handle) const;
+
+    /* REDUCTION ITERATORS */
+
+    /**
+     * Iterates in parallel over all nodes and sums (reduce +) the values returned by @a handle.
+     */
+    template <typename L>
+    double parallelSumForNodes(L handle) const;
+
+    /**
+     * Iterates in parallel over all edges and sums (reduce +) the values returned by @a handle.
+     */
+    template <typename L>
+    double parallelSumForEdges(L handle) const;
+
+private:
+    struct Storage;
+
+    // Points the arrays to those of @a data, which is kept alive by the snapshot.
+    void setStorage(std::shared_ptr<Storage> data);
+
+    count n = 0;
+    count m = 0;
+    count storedNumberOfSelfLoops = 0;
+    node z = 0;
+    bool weighted = false;
+    bool directed = false;
+
+    //!< keeps the memory referenced by the arrays below alive
+    std::shared_ptr<const void> storage;
+
+    //!< exists[v] is nonzero if v is a node; empty if no node has been deleted
+    std::span<const uint8_t> exists;
+
+    //!< the encoded neighborhood of u is outBytes[outOffsets[u]], ..., outBytes[outOffsets[u + 1]
+    //!< - 1]: the degree, the zigzag-encoded difference between the first neighbor and u and the
+    //!< gaps between consecutive neighbors, all as varints. Empty if u has no neighbors.
+    std::span<const index> outOffsets;
+    std::span<const uint8_t> outBytes;
+    //!< weights of the neighbors of u start at outWeights[outWeightOffsets[u]]; empty if
+    //!< unweighted
+    std::span<const index> outWeightOffsets;
+    std::span<const edgeweight> outWeights;
+
+    //!< only used for directed graphs, same schema as the out-arrays
+    std::span<const index> inOffsets;
+    std::span<const uint8_t> inBytes;
+    std::span<const index> inWeightOffsets;
+    std::span<const edgeweight> inWeights;
+
+    static uint64_t decodeVarInt(const uint8_t *&data) noexcept {
+        uint64_t value = 0;
+        unsigned shift = 0;
+        uint8_t byte;
+        do {
+            byte = *data++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        return value;
+    }
+
+    static int64_t zigzagDecode(const uint8_t *&data) noexcept {
+        const uint64_t value = decodeVarInt(data);
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    static const uint8_t *adjacencyData(std::span<const index> offsets,
+                                        std::span<const uint8_t> bytes, node u) noexcept {
+        return offsets[u] == offsets[u + 1] ? nullptr : bytes.data() + offsets[u];
+    }
+
+    static count decodeDegree(std::span<const index> offsets, std::span<const uint8_t> bytes,
+                              node u) noexcept {
+        const uint8_t *data = adjacencyData(offsets, bytes, u);
+        return data ? decodeVarInt(data) : 0;
+    }
+
+    template <bool graphIsDirected, bool hasWeights, typename L>
+    inline void forAdjacencyImpl(node u, std::span<const index> offsets,
+                                 std::span<const uint8_t> bytes,
+                                 std::span<const index> weightOffsets,
+                                 std::span<const edgeweight> weights, L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, typename L>
+    inline void forOutEdgesOfImpl(node u, L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, typename L>
+    inline void forInEdgesOfImpl(node u, L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, typename L>
+    inline void forEdgeImpl(L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, typename L>
+    inline void parallelForEdgesImpl(L &handle) const;
+
+    template <bool graphIsDirected, bool hasWeights, typename L>
+    inline double parallelSumForEdgesImpl(L &handle) const;
+};
+
+/* NODE ITERATORS */
+
+template <typename L>
+void CompressedGraph::forNodes(L handle) const {
+    for (node v = 0; v < z; ++v) {
+        if (hasNode(v)) {
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+void CompressedGraph::parallelForNodes(L handle) const {
+#pragma omp parallel for
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (hasNode(v)) {
+            handle(v);
+        }
+    }
+}
+
+template <typename C, typename L>
+void CompressedGraph::forNodesWhile(C condition, L handle) const {
+    for (node v = 0; v < z; ++v) {
+        if (hasNode(v)) {
+            if (!condition()) {
+                break;
+            }
+            handle(v);
+        }
+    }
+}
+
+template <typename L>
+void CompressedGraph::balancedParallelForNodes(L handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (hasNode(v)) {
+            handle(v);
+        }
+    }
+}
+
+/* EDGE ITERATORS */
+
+template <bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::forAdjacencyImpl(node u, std::span<const index> offsets,
+                                              std::span<const uint8_t> bytes,
+                                              std::span<const index> weightOffsets,
+                                              std::span<const edgeweight> weights,
+                                              L &handle) const {
+    const uint8_t *data = adjacencyData(offsets, bytes, u);
+    if (!data)
+        return;
+
+    const count deg = decodeVarInt(data);
+    node v = static_cast<node>(static_cast<int64_t>(u) + zigzagDecode(data));
+    const edgeweight *w = hasWeights ? weights.data() + weightOffsets[u] : nullptr;
+    for (index i = 0; i < deg; ++i) {
+        if (i)
+            v += decodeVarInt(data);
+
+        // undirected: visit each edge {u, v} only once; neighbors are sorted, so stop at v > u
+        if (!graphIsDirected && v > u)
+            break;
+        Graph::edgeLambda<L>(handle, u, v, hasWeights ? w[i] : defaultEdgeWeight, none);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::forOutEdgesOfImpl(node u, L &handle) const {
+    forAdjacencyImpl<graphIsDirected, hasWeights, L>(u, outOffsets, outBytes, outWeightOffsets,
+                                                     outWeights, handle);
+}
+
+template <bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::forInEdgesOfImpl(node u, L &handle) const {
+    if (graphIsDirected) {
+        forAdjacencyImpl<true, hasWeights, L>(u, inOffsets, inBytes, inWeightOffsets, inWeights,
+                                              handle);
+    } else {
+        forOutEdgesOfImpl<true, hasWeights, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::forEdgeImpl(L &handle) const {
+    for (node u = 0; u < z; ++u) {
+        forOutEdgesOfImpl<graphIsDirected, hasWeights, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, typename L>
+inline void CompressedGraph::parallelForEdgesImpl(L &handle) const {
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        forOutEdgesOfImpl<graphIsDirected, hasWeights, L>(u, handle);
+    }
+}
+
+template <bool graphIsDirected, bool hasWeights, typename L>
+inline double CompressedGraph::parallelSumForEdgesImpl(L &handle) const {
+    double sum = 0.0;
+
+#pragma omp parallel for schedule(guided) reduction(+ : sum)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        auto accumulate = [&](node x, node y, edgeweight ew) {
+            sum += Graph::edgeLambda<L>(handle, x, y, ew, none);
+        };
+        forOutEdgesOfImpl<graphIsDirected, hasWeights>(u, accumulate);
+    }
+
+    return sum;
+}
+
+template <typename L>
+void CompressedGraph::forEdges(L handle) const {
+    switch (weighted + 2 * directed) {
+    case 0: // unweighted, undirected
+        forEdgeImpl<false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected
+        forEdgeImpl<false, true, L>(handle);
+        break;
+
+    case 2: // unweighted, directed
+        forEdgeImpl<true, false, L>(handle);
+        break;
+
+    case 3: // weighted,   directed
+        forEdgeImpl<true, true, L>(handle);
+        break;
+    }
+}
+
+template <typename L>
+void CompressedGraph::parallelForEdges(L handle) const {
+    switch (weighted + 2 * directed) {
+    case 0: // unweighted, undirected
+        parallelForEdgesImpl<false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected
+        parallelForEdgesImpl<false, true, L>(handle);
+        break;
+
+    case 2: // unweighted, directed
+        parallelForEdgesImpl<true, false, L>(handle);
+        break;
+
+    case 3: // weighted,   directed
+        parallelForEdgesImpl<true, true, L>(handle);
+        break;
+    }
+}
+
+/* NEIGHBORHOOD ITERATORS */
+
+template <typename L>
+void CompressedGraph::forNeighborsOf(node u, L handle) const {
+    forEdgesOf(u, handle);
+}
+
+template <typename L>
+void CompressedGraph::forEdgesOf(node u, L handle) const {
+    if (weighted)
+        forOutEdgesOfImpl<true, true, L>(u, handle);
+    else
+        forOutEdgesOfImpl<true, false, L>(u, handle);
+}
+
+template <typename L>
+void CompressedGraph::forInNeighborsOf(node u, L handle) const {
+    forInEdgesOf(u, handle);
+}
+
+template <typename L>
+void CompressedGraph::forInEdgesOf(node u, L handle) const {
+    switch (weighted + 2 * directed) {
+    case 0: // unweighted, undirected
+        forInEdgesOfImpl<false, false, L>(u, handle);
+        break;
+
+    case 1: // weighted,   undirected
+        forInEdgesOfImpl<false, true, L>(u, handle);
+        break;
+
+    case 2: // unweighted, directed
+        forInEdgesOfImpl<true, false, L>(u, handle);
+        break;
+
+    case 3: // weighted,   directed
+        forInEdgesOfImpl<true, true, L>(u, handle);
+        break;
+    }
+}
+
+/* REDUCTION ITERATORS */
+
+template <typename L>
+double CompressedGraph::parallelSumForNodes(L handle) const {
+    double sum = 0.0;
+
+#pragma omp parallel for reduction(+ : sum)
+    for (omp_index v = 0; v < static_cast<omp_index>(z); ++v) {
+        if (hasNode(v)) {
+            sum += handle(v);
+        }
+    }
+
+    return sum;
+}
+
+template <typename L>
+double CompressedGraph::parallelSumForEdges(L handle) const {
+    double sum = 0.0;
+
+    switch (weighted + 2 * directed) {
+    case 0: // unweighted, undirected
+        sum = parallelSumForEdgesImpl<false, false, L>(handle);
+        break;
+
+    case 1: // weighted,   undirected
+        sum = parallelSumForEdgesImpl<false, true, L>(handle);
+        break;
+
+    case 2: // unweighted, directed
+        sum = parallelSumForEdgesImpl<true, false, L>(handle);
+        break;
+
+    case 3: // weighted,   directed
+        sum = parallelSumForEdgesImpl<true, true, L>(handle);
+        break;
+    }
+
+    return sum;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_COMPRESSED_GRAPH_HPP_
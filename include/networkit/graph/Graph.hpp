@@ -18,6 +18,7 @@
 #include <omp.h>
 #include <queue>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
@@ -100,12 +101,22 @@ namespace CurveballDetails {
 class CurveballMaterialization;
 }
 
+// forward declaration to graph/CSRGraph.hpp
+class CSRGraph;
+
+// forward declaration to graph/CompressedGraph.hpp
+class CompressedGraph;
+
 /**
  * @ingroup graph
  * A graph (with optional weights) and parallel iterator methods.
  */
 class Graph final {
 
+    // CSRGraph and CompressedGraph reuse the lambda dispatch of the edge iterators
+    friend class CSRGraph;
+    friend class CompressedGraph;
+
     // graph attributes
     //!< current number of nodes
     count n;
@@ -275,6 +286,20 @@ private:
     edgeweight computeWeightedDegree(node u, bool inDegree = false,
                                      bool countSelfLoopsTwice = false) const;
 
+    /**
+     * Removes the entries of the out- or in-adjacency array of node @a u for which @a remove
+     * returns true, keeping the order of the remaining entries. @a remove is called with the
+     * positions of the entries in increasing order.
+     */
+    template <typename Remove>
+    void compactAdjacency(node u, bool incoming, Remove remove);
+
+    /**
+     * Invalidates the edge attributes of the removed edge ids. If maintainCompactEdges is set,
+     * the remaining edge ids are shifted such that no gaps exist.
+     */
+    void removeEdgeIds(std::vector<edgeid> removedIds);
+
     /**
      * Returns the edge weight of the outgoing edge of index i in the outgoing
      * edges of node u
@@ -409,7 +434,7 @@ private:
      * template substitution error messages from the other declarations.
      */
     template <class F, void * = (void *)0>
-    typename Aux::FunctionTraits<F>::result_type edgeLambda(F &, ...) const {
+    static typename Aux::FunctionTraits<F>::result_type edgeLambda(F &, ...) {
         // the strange condition is used in order to delay the evaluation of the
         // static assert to the moment when this function is actually used
         static_assert(!std::is_same<F, F>::value,
@@ -432,7 +457,7 @@ private:
                                   typename Aux::FunctionTraits<F>::template arg<2>::type>::value
                   && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::
                       value>::type * = (void *)0>
-    auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id) const
+    static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id)
         -> decltype(f(u, v, ew, id)) {
         return f(u, v, ew, id);
     }
@@ -451,7 +476,7 @@ private:
                 value /* prevent f(v, weight, eid)
                        */
             >::type * = (void *)0>
-    auto edgeLambda(F &f, node u, node v, edgeweight, edgeid id) const -> decltype(f(u, v, id)) {
+    static auto edgeLambda(F &f, node u, node v, edgeweight, edgeid id) -> decltype(f(u, v, id)) {
         return f(u, v, id);
     }
 
@@ -465,7 +490,7 @@ private:
                   (Aux::FunctionTraits<F>::arity >= 2)
                   && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
                                                   2>::type>::value>::type * = (void *)0>
-    auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid /*id*/) const
+    static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid /*id*/)
         -> decltype(f(u, v, ew)) {
         return f(u, v, ew);
     }
@@ -479,7 +504,7 @@ private:
                            (Aux::FunctionTraits<F>::arity >= 1)
                            && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<
                                                      1>::type>::value>::type * = (void *)0>
-    auto edgeLambda(F &f, node u, node v, edgeweight /*ew*/, edgeid /*id*/) const
+    static auto edgeLambda(F &f, node u, node v, edgeweight /*ew*/, edgeid /*id*/)
         -> decltype(f(u, v)) {
         return f(u, v);
     }
@@ -495,7 +520,7 @@ private:
                   (Aux::FunctionTraits<F>::arity >= 1)
                   && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
                                                   1>::type>::value>::type * = (void *)0>
-    auto edgeLambda(F &f, node, node v, edgeweight ew, edgeid /*id*/) const -> decltype(f(v, ew)) {
+    static auto edgeLambda(F &f, node, node v, edgeweight ew, edgeid /*id*/) -> decltype(f(v, ew)) {
         return f(v, ew);
     }
 
@@ -504,7 +529,7 @@ private:
      * first node id, the edge weight and the edge id
      */
     template <class F, void * = (void *)0>
-    auto edgeLambda(F &f, node, node v, edgeweight, edgeid) const -> decltype(f(v)) {
+    static auto edgeLambda(F &f, node, node v, edgeweight, edgeid) -> decltype(f(v)) {
         return f(v);
     }
 
@@ -986,6 +1011,28 @@ public:
      */
     void shrinkToFit();
 
+    /**
+     * Creates an immutable snapshot of the graph in compressed sparse row
+     * format. The snapshot offers the same node and edge iterators as Graph
+     * but stores all neighborhoods in contiguous arrays. Later modifications
+     * of the graph are not reflected in the snapshot. ConnectedComponents and
+     * Betweenness accept the snapshot as input; PageRank creates one internally.
+     *
+     * @note Include networkit/graph/CSRGraph.hpp to use the result.
+     * @return CSR snapshot of the graph.
+     */
+    CSRGraph freeze() const;
+
+    /**
+     * Creates an immutable snapshot of the graph with sorted, delta and varint
+     * encoded neighborhoods. Traversals on the snapshot need considerably less
+     * memory than on the graph itself. Edge ids are not preserved.
+     *
+     * @note Include networkit/graph/CompressedGraph.hpp to use the result.
+     * @return Compressed snapshot of the graph.
+     */
+    CompressedGraph compress() const;
+
     /**
      * DEPRECATED: this function will no longer be supported in later releases.
      * Compacts the adjacency arrays by re-using no longer needed slots from
@@ -1063,6 +1110,15 @@ public:
      */
     void removeNode(node v);
 
+    /**
+     * Removes a batch of nodes and all their incident edges in parallel. Faster than calling
+     * removeNode() for every node if many nodes or nodes with many edges are removed. The
+     * neighborhoods of the remaining nodes keep their order.
+     *
+     * @param nodes Nodes to remove, every node must exist and occur at most once.
+     */
+    void removeNodes(std::span<const node> nodes);
+
     /**
      * Removes out-going edges from node @u. If the graph is weighted and/or has edge ids, weights
      * and/or edge ids will also be removed.
@@ -1204,6 +1260,19 @@ public:
      */
     bool addEdge(node u, node v, edgeweight ew = defaultEdgeWeight, bool checkMultiEdge = false);
 
+    /**
+     * Inserts a batch of edges in parallel. The result is the same as calling addEdge() for every
+     * edge of the batch in order: the i-th edge gets the i-th new edge id (if edges are indexed)
+     * and the neighbors of each node are appended in the order of the batch. Multi-edges are not
+     * checked for.
+     *
+     * @param edges Edges to insert, both endpoints of every edge must exist.
+     * @param weights Either empty (all edges get defaultEdgeWeight) or the weight of every edge.
+     * Ignored if the graph is unweighted.
+     */
+    void addEdges(std::span<const std::pair<node, node>> edges,
+                  std::span<const edgeweight> weights = {});
+
     /**
      * Insert an edge between the nodes @a u and @a v. Unline the addEdge function, this function
      * does not not add any information to v. If the graph is weighted you can optionally set a
@@ -1296,6 +1365,19 @@ public:
      */
     void removeEdge(node u, node v);
 
+    /**
+     * Removes a batch of edges in parallel. The positions of the removed edges are determined
+     * first, then each affected neighborhood is compacted once, keeping the order of the remaining
+     * neighbors. This avoids the cost of calling removeEdge() for every edge, which is quadratic
+     * for nodes that lose many edges. Every pair removes one edge, i.e., a multi-edge has to be
+     * listed as often as it should be removed. If maintainCompactEdges is set, the remaining edge
+     * ids are shifted once for the whole batch.
+     *
+     * @param edges Edges to remove. An exception is thrown and the graph is not modified if one
+     * of the edges does not exist.
+     */
+    void removeEdges(std::span<const std::pair<node, node>> edges);
+
     /**
      * Removes all the edges in the graph.
      */
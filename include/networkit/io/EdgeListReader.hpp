@@ -11,7 +11,7 @@
 #include <map>
 #include <string>
 
-#include <networkit/io/GraphReader.hpp>
+#include <networkit/io/StreamingGraphReader.hpp>
 
 namespace NetworKit {
 
@@ -20,8 +20,12 @@ namespace NetworKit {
  * A reader for various edge list formats, in which each line contains an edge as
  * two node ids.
  *
+ * The file is split into chunks at line boundaries which are parsed in parallel.
+ * Repeated edges are ignored; only the first occurrence (and its weight) is kept. The neighbors
+ * of each node are stored in file order, as if the edges were added one by one. Malformed lines
+ * and node ids that do not fit into a node raise std::runtime_error with the line number.
  */
-class EdgeListReader final : public GraphReader {
+class EdgeListReader final : public StreamingGraphReader {
 
 public:
     EdgeListReader() = default; // nullary constructor for Python shell
@@ -43,6 +47,13 @@ public:
      */
     Graph read(std::string_view path) override;
 
+    /**
+     * Streams the edges of the file in file order, see StreamingGraphReader. The node map is
+     * available once the stream has ended.
+     */
+    StreamProperties forEdgeBatches(std::string_view path, const EdgeBatchCallback &callback,
+                                    count batchSize = defaultBatchSize) override;
+
     /**
      * Return the node map, in case node ids are not continuous
      */
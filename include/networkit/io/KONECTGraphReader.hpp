@@ -11,10 +11,10 @@
 #include <unordered_map>
 
 #include <networkit/graph/Graph.hpp>
-#include <networkit/io/GraphReader.hpp>
+#include <networkit/io/StreamingGraphReader.hpp>
 
 namespace NetworKit {
-class KONECTGraphReader final : public GraphReader {
+class KONECTGraphReader final : public StreamingGraphReader {
 
 public:
     /*
@@ -36,6 +36,12 @@ public:
      */
     Graph read(std::string_view path) override;
 
+    /**
+     * Streams the edges of the file in file order, see StreamingGraphReader.
+     */
+    StreamProperties forEdgeBatches(std::string_view path, const EdgeBatchCallback &callback,
+                                    count batchSize = defaultBatchSize) override;
+
 private:
     bool remapNodes;
     MultipleEdgesHandling multipleEdgesHandlingMethod;
@@ -8,7 +8,10 @@
 #ifndef NETWORKIT_IO_MEMORY_MAPPED_FILE_HPP_
 #define NETWORKIT_IO_MEMORY_MAPPED_FILE_HPP_
 
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
 
 namespace NetworKit {
@@ -76,5 +79,33 @@ private:
     std::unique_ptr<MemoryMappedFileState> state;
 };
 
+/**
+ * Returns the section of @a count elements of type T at byte @a offset of the mapped @a data of
+ * @a size bytes, or an empty span if the section is absent (offset zero). Throws if the section
+ * is misaligned or exceeds the data.
+ */
+template <typename T>
+std::span<const T> mappedSection(const char *data, size_t size, uint64_t offset, uint64_t count) {
+    if (!offset)
+        return {};
+    if (offset % alignof(T) || offset > size || count > (size - offset) / sizeof(T))
+        throw std::runtime_error("Section exceeds the mapped file");
+    return {reinterpret_cast<const T *>(data + offset), count};
+}
+
+/**
+ * Returns true iff @a offsets are valid CSR offsets of lists of @a entries elements in total,
+ * i.e., they start at zero, never decrease, and end at @a entries.
+ */
+template <typename T>
+bool validOffsets(std::span<const T> offsets, uint64_t entries) {
+    if (offsets.empty() || offsets.front() != 0 || offsets.back() != entries)
+        return false;
+    for (size_t i = 1; i < offsets.size(); ++i)
+        if (offsets[i] < offsets[i - 1])
+            return false;
+    return true;
+}
+
 } // namespace NetworKit
 #endif // NETWORKIT_IO_MEMORY_MAPPED_FILE_HPP_
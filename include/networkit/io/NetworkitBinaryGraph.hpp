@@ -32,6 +32,33 @@ struct Header {
     uint64_t offsetAdjIdTranspose;
 };
 
+/**
+ * Header of the uncompressed CSR variant (magic "nkbgcsr"). All sections start at a multiple of
+ * CSR_ALIGNMENT, so they can be used in place after mapping the file into memory. An offset of
+ * zero marks an absent section.
+ */
+struct CSRHeader {
+    char magic[8];
+    uint64_t checksum;
+    uint64_t features;
+    uint64_t nodes;
+    uint64_t numberOfNodes;
+    uint64_t numberOfEdges;
+    uint64_t numberOfSelfLoops;
+    uint64_t upperEdgeIdBound;
+    uint64_t offsetNodeFlags;
+    uint64_t offsetOutOffsets;
+    uint64_t offsetOutTargets;
+    uint64_t offsetOutWeights;
+    uint64_t offsetOutIds;
+    uint64_t offsetInOffsets;
+    uint64_t offsetInTargets;
+    uint64_t offsetInWeights;
+    uint64_t offsetInIds;
+};
+
+static constexpr uint64_t CSR_ALIGNMENT = 4096;
+
 enum class WeightFormat : int { NONE = 0, VARINT = 1, SIGNED_VARINT = 2, DOUBLE = 3, FLOAT = 4 };
 
 using WEIGHT_FORMAT = WeightFormat; // enum alias for backwards compatibility
@@ -42,6 +69,7 @@ static constexpr uint64_t WGHT_MASK = 0xE;  // bit 1-3
 static constexpr uint64_t WGHT_SHIFT = 0x1;
 static constexpr uint64_t INDEX_MASK = 0x10; // bit 4
 static constexpr uint64_t INDEX_SHIFT = 0x4;
+static constexpr uint64_t INDEX_32BIT_MASK = 0x20; // bit 5, CSR variant only
 
 /**
  * Serializes value into a buffer and returns the number of bytes written.
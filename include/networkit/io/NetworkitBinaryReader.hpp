@@ -9,6 +9,7 @@
 
 #include <cstring>
 #include <string>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/io/GraphReader.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
@@ -20,7 +21,8 @@ namespace NetworKit {
  *
  * Reads a graph written in the custom Networkit binary format.
  * Note that there are multiple versions of the Networkit binary format.
- * This Reader can read files that are written with format version 2 and 3.
+ * This Reader can read files that are written with format version 2 and 3 as well as the
+ * uncompressed CSR variant written by NetworkitBinaryWriter::writeCSR.
  * Format version 3 was released with Networkit 9.1 (December 2021).
  * Further information can be found here:
  * https://github.com/networkit/networkit/blob/master/networkit/cpp/io/NetworkitBinaryGraph.md
@@ -34,6 +36,18 @@ public:
     Graph read(std::string_view path) override;
     Graph readFromBuffer(const std::vector<uint8_t> &data);
 
+    /**
+     * Maps a file written by NetworkitBinaryWriter::writeCSR into memory and returns a read-only
+     * view on it. The adjacency data is neither decoded nor copied, hence loading time does not
+     * depend on the size of the graph and processes mapping the same file share its pages
+     * through the page cache. The file stays mapped as long as any copy of the returned graph
+     * exists.
+     *
+     * @param path Path of a file in the CSR variant of the format.
+     * @throws std::runtime_error if the file is not a valid file of the CSR variant.
+     */
+    CSRGraph readCSR(std::string_view path);
+
 private:
     count nodes;
     count chunks;
@@ -56,6 +56,17 @@ public:
     void write(const Graph &G, std::string_view path) override;
     std::vector<uint8_t> writeToBuffer(const Graph &G);
 
+    /**
+     * Writes @a G in the uncompressed, page-aligned CSR variant of the format. Files of this
+     * variant are larger than the default format, but NetworkitBinaryReader::readCSR maps them
+     * into memory without decoding. Weights are stored as doubles unless the weights type is
+     * NONE; edge ids are stored according to the edge id setting of the writer.
+     *
+     * @param G The graph to write.
+     * @param path Path of the output file.
+     */
+    void writeCSR(const Graph &G, std::string_view path);
+
 private:
     count chunks;
     NetworkitBinaryWeights weightsType;
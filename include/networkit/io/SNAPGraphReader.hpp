@@ -11,14 +11,14 @@
 #include <unordered_map>
 
 #include <networkit/graph/Graph.hpp>
-#include <networkit/io/GraphReader.hpp>
+#include <networkit/io/StreamingGraphReader.hpp>
 
 namespace NetworKit {
 
 /**
  * @ingroup io
  */
-class SNAPGraphReader final : public GraphReader {
+class SNAPGraphReader final : public StreamingGraphReader {
     std::unordered_map<node, node> nodeIdMap;
     bool directed;
     count nodeCount;
@@ -46,6 +46,12 @@ public:
      * @param[in]  path  input file path
      */
     Graph read(std::string_view path) override;
+
+    /**
+     * Streams the edges of the file in file order, see StreamingGraphReader.
+     */
+    StreamProperties forEdgeBatches(std::string_view path, const EdgeBatchCallback &callback,
+                                    count batchSize = defaultBatchSize) override;
 };
 
 } /* namespace NetworKit */
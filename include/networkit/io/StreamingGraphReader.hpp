@@ -0,0 +1,82 @@
+/*
+ * StreamingGraphReader.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_IO_STREAMING_GRAPH_READER_HPP_
+#define NETWORKIT_IO_STREAMING_GRAPH_READER_HPP_
+
+#include <functional>
+#include <span>
+
+#include <networkit/graph/CompressedGraph.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/io/GraphReader.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Abstract base class for readers of edge list based formats that can stream the edges of a file
+ * in batches instead of materializing the whole input.
+ */
+class StreamingGraphReader : public GraphReader {
+public:
+    //! Properties of a streamed graph, known after the whole file has been streamed.
+    struct StreamProperties {
+        count numberOfNodes = 0;
+        bool weighted = false;
+        bool directed = false;
+        //! How repeated edges are handled by read()
+        MultipleEdgesHandling multipleEdges = DISCARD_EDGES;
+    };
+
+    using EdgeBatch = std::span<const WeightedEdge>;
+    using EdgeBatchCallback = std::function<void(EdgeBatch)>;
+
+    static constexpr count defaultBatchSize = 1 << 16;
+
+    /**
+     * Streams the edges of the file to @a callback in file order, in batches of at most
+     * @a batchSize edges. Node ids are mapped in the same way as by read(), repeated edges are
+     * passed on unchanged. Apart from a node id map (if ids are remapped), only the current
+     * batch is held in memory.
+     *
+     * @param[in]  path  input file path
+     * @param[in]  callback  called for every batch of edges
+     * @param[in]  batchSize  maximum number of edges per batch
+     * @return The properties of the streamed graph.
+     */
+    virtual StreamProperties forEdgeBatches(std::string_view path,
+                                            const EdgeBatchCallback &callback,
+                                            count batchSize = defaultBatchSize) = 0;
+
+    /**
+     * Reads the graph in two passes over the file: the first pass counts the degrees of all
+     * nodes, the second one fills adjacency arrays of exactly that size. Repeated edges are
+     * handled as by read(). Peak memory stays close to the size of the resulting graph, at the
+     * cost of parsing the file twice.
+     *
+     * @param[in]  path  input file path
+     * @return The graph contained in the file.
+     */
+    Graph readStreaming(std::string_view path);
+
+    /**
+     * Reads the graph directly into a CompressedGraph without materializing a Graph. The file is
+     * parsed once to count the degrees and then once per block of nodes whose neighborhoods fit
+     * into @a maxBufferedNeighbors (twice as often for directed graphs). Repeated edges are
+     * handled as by read().
+     *
+     * @param[in]  path  input file path
+     * @param[in]  maxBufferedNeighbors  maximum number of uncompressed neighbors held in memory
+     * @return The compressed graph contained in the file.
+     */
+    CompressedGraph
+    readCompressed(std::string_view path,
+                   count maxBufferedNeighbors = CompressedGraph::defaultMaxBufferedNeighbors);
+};
+
+} /* namespace NetworKit */
+#endif // NETWORKIT_IO_STREAMING_GRAPH_READER_HPP_
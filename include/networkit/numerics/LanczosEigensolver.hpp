@@ -0,0 +1,338 @@
+/*
+ * LanczosEigensolver.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_NUMERICS_LANCZOS_EIGENSOLVER_HPP_
+#define NETWORKIT_NUMERICS_LANCZOS_EIGENSOLVER_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <omp.h>
+#include <stdexcept>
+#include <vector>
+
+#include <networkit/algebraic/Vector.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/base/Algorithm.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Computes the k largest (algebraic) eigenvalues and their eigenvectors of a symmetric matrix
+ * with the thick-restart Lanczos method. The Krylov basis is kept orthogonal by full
+ * reorthogonalization; when it reaches krylovDimension vectors, the method restarts with the k
+ * (plus a few more) best Ritz vectors of the current basis. The matrix is only accessed through
+ * (parallel) matrix-vector products.
+ *
+ * Compared to the power iteration, the convergence depends on the gaps between the wanted
+ * eigenvalues and the rest of the spectrum in a much weaker way, and eigenvalues of equal
+ * magnitude but opposite signs (e.g., in bipartite graphs) are no problem.
+ */
+template <class Matrix>
+class LanczosEigensolver final : public Algorithm {
+public:
+    /**
+     * @param A Symmetric matrix; must stay alive while the solver is used.
+     * @param k Number of wanted eigenpairs.
+     * @param tol A Ritz pair (theta, y) is accepted once ||Ay - theta y|| <= tol * |theta_1|,
+     * where theta_1 is the Ritz value of largest magnitude.
+     */
+    LanczosEigensolver(const Matrix &A, count k = 1, double tol = 1e-9);
+
+    /**
+     * Sets the start vector of the Krylov space; by default, a random vector is used. Note that
+     * only eigenvectors that are not orthogonal to the start vector can be found.
+     */
+    void setStartVector(Vector start) { this->start = std::move(start); }
+
+    void run() override;
+
+    /**
+     * Returns the k largest eigenvalues in decreasing order.
+     */
+    const std::vector<double> &eigenvalues() const {
+        assureFinished();
+        return values;
+    }
+
+    /**
+     * Returns the eigenvectors (normalized in 2-norm) corresponding to eigenvalues().
+     */
+    const std::vector<Vector> &eigenvectors() const {
+        assureFinished();
+        return vectors;
+    }
+
+    /**
+     * Returns true if all k eigenpairs have converged before maxRestarts restarts.
+     */
+    bool hasConverged() const {
+        assureFinished();
+        return converged;
+    }
+
+    /**
+     * Returns the number of restarts of the last run.
+     */
+    count numberOfRestarts() const {
+        assureFinished();
+        return restarts;
+    }
+
+    // Maximum number of basis vectors; 0 chooses max(2k + 10, 20), at most n.
+    count krylovDimension = 0;
+
+    // Maximum number of restarts
+    count maxRestarts = 1000;
+
+private:
+    const Matrix *A;
+    const count k;
+    const double tol;
+    Vector start;
+
+    std::vector<double> values;
+    std::vector<Vector> vectors;
+    bool converged = false;
+    count restarts = 0;
+
+    // Orthogonalizes w against basis[0..size) (twice, for numerical stability) and adds the
+    // projections to coefficients.
+    static void orthogonalize(const std::vector<Vector> &basis, count size, Vector &w,
+                              std::vector<double> &coefficients);
+
+    // Eigendecomposition of the symmetric m x m matrix H (row-major) with the cyclic Jacobi
+    // method. Returns the eigenvalues in decreasing order; column i of eigvecs belongs to the
+    // i-th eigenvalue.
+    static std::vector<double> symmetricEigen(std::vector<double> H, count m,
+                                              std::vector<double> &eigvecs);
+
+    // Returns basis * S[:, column] for the first m basis vectors.
+    static void combine(const std::vector<Vector> &basis, count m, const std::vector<double> &S,
+                        count columns, std::vector<Vector> &result);
+};
+
+template <class Matrix>
+LanczosEigensolver<Matrix>::LanczosEigensolver(const Matrix &A, count k, double tol)
+    : A(&A), k(k), tol(tol) {
+    if (A.numberOfRows() != A.numberOfColumns())
+        throw std::runtime_error("LanczosEigensolver requires a square matrix");
+    if (k == 0 || k > A.numberOfRows())
+        throw std::runtime_error("k must be in [1, n]");
+}
+
+template <class Matrix>
+void LanczosEigensolver<Matrix>::orthogonalize(const std::vector<Vector> &basis, count size,
+                                               Vector &w, std::vector<double> &coefficients) {
+    const count n = w.getDimension();
+    std::vector<double> projections(size);
+    for (int pass = 0; pass < 2; ++pass) {
+        std::fill(projections.begin(), projections.end(), 0.0);
+#pragma omp parallel
+        {
+            std::vector<double> local(size, 0.0);
+#pragma omp for schedule(static) nowait
+            for (omp_index r = 0; r < static_cast<omp_index>(n); ++r)
+                for (index i = 0; i < size; ++i)
+                    local[i] += basis[i][r] * w[r];
+#pragma omp critical
+            for (index i = 0; i < size; ++i)
+                projections[i] += local[i];
+        }
+
+#pragma omp parallel for schedule(static)
+        for (omp_index r = 0; r < static_cast<omp_index>(n); ++r) {
+            double value = w[r];
+            for (index i = 0; i < size; ++i)
+                value -= projections[i] * basis[i][r];
+            w[r] = value;
+        }
+
+        for (index i = 0; i < size; ++i)
+            coefficients[i] += projections[i];
+    }
+}
+
+template <class Matrix>
+std::vector<double> LanczosEigensolver<Matrix>::symmetricEigen(std::vector<double> H, count m,
+                                                               std::vector<double> &eigvecs) {
+    eigvecs.assign(m * m, 0.0);
+    for (index i = 0; i < m; ++i)
+        eigvecs[i * m + i] = 1.0;
+
+    double norm = 0.0;
+    for (const double h : H)
+        norm += h * h;
+    const double threshold = std::numeric_limits<double>::epsilon() * std::sqrt(norm);
+
+    for (count sweep = 0; sweep < 100; ++sweep) {
+        double offDiagonal = 0.0;
+        for (index p = 0; p < m; ++p)
+            for (index q = p + 1; q < m; ++q)
+                offDiagonal += H[p * m + q] * H[p * m + q];
+        if (std::sqrt(offDiagonal) <= threshold)
+            break;
+
+        for (index p = 0; p < m; ++p) {
+            for (index q = p + 1; q < m; ++q) {
+                const double hpq = H[p * m + q];
+                if (std::abs(hpq) <= threshold / static_cast<double>(m))
+                    continue;
+                // Rotation that annihilates H[p][q]
+                const double theta = (H[q * m + q] - H[p * m + p]) / (2.0 * hpq);
+                const double t = (theta >= 0 ? 1.0 : -1.0)
+                                 / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                const double c = 1.0 / std::sqrt(t * t + 1.0);
+                const double s = t * c;
+                for (index r = 0; r < m; ++r) {
+                    const double hrp = H[r * m + p], hrq = H[r * m + q];
+                    H[r * m + p] = c * hrp - s * hrq;
+                    H[r * m + q] = s * hrp + c * hrq;
+                }
+                for (index r = 0; r < m; ++r) {
+                    const double hpr = H[p * m + r], hqr = H[q * m + r];
+                    H[p * m + r] = c * hpr - s * hqr;
+                    H[q * m + r] = s * hpr + c * hqr;
+                }
+                for (index r = 0; r < m; ++r) {
+                    const double vrp = eigvecs[r * m + p], vrq = eigvecs[r * m + q];
+                    eigvecs[r * m + p] = c * vrp - s * vrq;
+                    eigvecs[r * m + q] = s * vrp + c * vrq;
+                }
+            }
+        }
+    }
+
+    // Sort the eigenpairs by decreasing eigenvalue
+    std::vector<index> order(m);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](index a, index b) { return H[a * m + a] > H[b * m + b]; });
+    std::vector<double> sortedValues(m), sortedVectors(m * m);
+    for (index i = 0; i < m; ++i) {
+        sortedValues[i] = H[order[i] * m + order[i]];
+        for (index r = 0; r < m; ++r)
+            sortedVectors[r * m + i] = eigvecs[r * m + order[i]];
+    }
+    eigvecs = std::move(sortedVectors);
+    return sortedValues;
+}
+
+template <class Matrix>
+void LanczosEigensolver<Matrix>::combine(const std::vector<Vector> &basis, count m,
+                                         const std::vector<double> &S, count columns,
+                                         std::vector<Vector> &result) {
+    const count n = basis[0].getDimension();
+    result.assign(columns, Vector(n, 0.0));
+#pragma omp parallel for schedule(static)
+    for (omp_index r = 0; r < static_cast<omp_index>(n); ++r) {
+        for (index j = 0; j < m; ++j) {
+            const double value = basis[j][r];
+            for (index i = 0; i < columns; ++i)
+                result[i][r] += value * S[j * m + i];
+        }
+    }
+}
+
+template <class Matrix>
+void LanczosEigensolver<Matrix>::run() {
+    const count n = A->numberOfRows();
+    const count m = std::min(n, krylovDimension ? std::max(krylovDimension, k + 1)
+                                                : std::max<count>(2 * k + 10, 20));
+    // Number of Ritz vectors kept at a restart
+    const count kept = std::min(m - 1, k + (m - k) / 2);
+
+    std::vector<Vector> basis(m + 1);
+
+    // Returns a random unit vector orthogonal to the first size basis vectors
+    auto randomDirection = [&](count size) {
+        Vector w(n);
+        for (index r = 0; r < n; ++r)
+            w[r] = Aux::Random::real(-1.0, 1.0);
+        std::vector<double> unused(size, 0.0);
+        orthogonalize(basis, size, w, unused);
+        return w / w.length();
+    };
+
+    if (start.getDimension() == n && start.length() > 0.0)
+        basis[0] = start / start.length();
+    else
+        basis[0] = randomDirection(0);
+
+    // Projection of A onto the basis (row-major m x m)
+    std::vector<double> H(m * m, 0.0), S;
+    std::vector<double> coefficients;
+    std::vector<double> theta;
+    std::vector<Vector> ritz;
+    index first = 0;
+    double beta = 0.0;
+    converged = false;
+    restarts = 0;
+
+    while (true) {
+        // Extend the basis to m vectors
+        for (index j = first; j < m; ++j) {
+            Vector w = (*A) * basis[j];
+            coefficients.assign(j + 1, 0.0);
+            orthogonalize(basis, j + 1, w, coefficients);
+            for (index i = 0; i <= j; ++i)
+                H[i * m + j] = H[j * m + i] = coefficients[i];
+            if (j + 1 < m)
+                H[j * m + j + 1] = H[(j + 1) * m + j] = 0.0;
+
+            beta = w.length();
+            const double scale = std::abs(H[j * m + j]) + std::abs(coefficients.front());
+            if (beta <= 1e-12 * std::max(scale, 1.0)) {
+                // The basis spans an invariant subspace; continue with a new direction.
+                beta = 0.0;
+                basis[j + 1] = j + 1 < n ? randomDirection(j + 1) : Vector(n, 0.0);
+            } else {
+                if (j + 1 < m)
+                    H[j * m + j + 1] = H[(j + 1) * m + j] = beta;
+                basis[j + 1] = w / beta;
+            }
+        }
+
+        theta = symmetricEigen(H, m, S);
+
+        // The residual norm of the i-th Ritz pair is |beta * S[m - 1][i]|.
+        const double scale =
+            std::max(std::max(std::abs(theta.front()), std::abs(theta.back())),
+                     std::numeric_limits<double>::min());
+        converged = true;
+        for (index i = 0; i < k; ++i)
+            converged = converged && std::abs(beta * S[(m - 1) * m + i]) <= tol * scale;
+
+        if (converged || restarts >= maxRestarts || m == n) {
+            combine(basis, m, S, k, ritz);
+            break;
+        }
+
+        // Thick restart: keep the best Ritz vectors and continue with the residual direction.
+        ++restarts;
+        combine(basis, m, S, kept, ritz);
+        basis[kept] = std::move(basis[m]);
+        for (index i = 0; i < kept; ++i)
+            basis[i] = std::move(ritz[i]);
+        std::fill(H.begin(), H.end(), 0.0);
+        for (index i = 0; i < kept; ++i)
+            H[i * m + i] = theta[i];
+        first = kept;
+    }
+
+    values.assign(theta.begin(), theta.begin() + k);
+    vectors = std::move(ritz);
+    for (auto &v : vectors)
+        v /= v.length();
+    converged = converged || m == n;
+    hasRun = true;
+}
+
+} /* namespace NetworKit */
+
+#endif // NETWORKIT_NUMERICS_LANCZOS_EIGENSOLVER_HPP_
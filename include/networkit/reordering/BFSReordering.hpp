@@ -0,0 +1,37 @@
+/*
+ * BFSReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_REORDERING_BFS_REORDERING_HPP_
+#define NETWORKIT_REORDERING_BFS_REORDERING_HPP_
+
+#include <networkit/reordering/NodeReordering.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup reordering
+ * Orders the nodes as they are visited by a breadth-first search, ignoring edge directions.
+ * The first search starts at @a source; every component that is not reached starts a new search
+ * at its node with the smallest id.
+ */
+class BFSReordering final : public NodeReordering {
+public:
+    /**
+     * @param G The graph.
+     * @param source The node at which the first search starts. If none, the node of maximum
+     * degree is used.
+     */
+    BFSReordering(const Graph &G, node source = none);
+
+    void run() override;
+
+private:
+    node source;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_REORDERING_BFS_REORDERING_HPP_
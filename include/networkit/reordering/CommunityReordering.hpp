@@ -0,0 +1,45 @@
+/*
+ * CommunityReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_REORDERING_COMMUNITY_REORDERING_HPP_
+#define NETWORKIT_REORDERING_COMMUNITY_REORDERING_HPP_
+
+#include <networkit/reordering/NodeReordering.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup reordering
+ * Stores the nodes of each community next to each other. Communities are ordered by their node
+ * with the smallest id; within a community, nodes keep their relative order. Nodes that are not
+ * assigned to any community are placed last.
+ */
+class CommunityReordering final : public NodeReordering {
+public:
+    /**
+     * Detects the communities with PLM. On directed graphs, PLM runs on the undirected version
+     * of the graph.
+     *
+     * @param G The graph.
+     */
+    CommunityReordering(const Graph &G);
+
+    /**
+     * @param G The graph.
+     * @param communities A partition of the nodes of @a G.
+     */
+    CommunityReordering(const Graph &G, const Partition &communities);
+
+    void run() override;
+
+private:
+    Partition communities;
+    bool detectCommunities;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_REORDERING_COMMUNITY_REORDERING_HPP_
@@ -0,0 +1,37 @@
+/*
+ * DegreeReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_REORDERING_DEGREE_REORDERING_HPP_
+#define NETWORKIT_REORDERING_DEGREE_REORDERING_HPP_
+
+#include <networkit/reordering/NodeReordering.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup reordering
+ * Orders the nodes by degree, so that the hubs, which are accessed most often, are stored next to
+ * each other. Nodes with equal degree keep their relative order. For directed graphs, the
+ * in-degree is used since it determines how often a node is accessed by pull-based algorithms.
+ */
+class DegreeReordering final : public NodeReordering {
+public:
+    /**
+     * @param G The graph.
+     * @param decreasing If true, the nodes are sorted by decreasing degree, otherwise by
+     * increasing degree.
+     */
+    DegreeReordering(const Graph &G, bool decreasing = true);
+
+    void run() override;
+
+private:
+    bool decreasing;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_REORDERING_DEGREE_REORDERING_HPP_
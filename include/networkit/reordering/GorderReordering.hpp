@@ -0,0 +1,38 @@
+/*
+ * GorderReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_REORDERING_GORDER_REORDERING_HPP_
+#define NETWORKIT_REORDERING_GORDER_REORDERING_HPP_
+
+#include <networkit/reordering/NodeReordering.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup reordering
+ * Greedy window-based ordering as proposed by Wei et al., "Speedup Graph Processing by Graph
+ * Ordering", SIGMOD 2016. Nodes are placed one after another; the next node is the one sharing
+ * the most edges and in-neighbors with the last @a windowSize placed nodes. In-neighbors with
+ * more than sqrt(n) out-neighbors are not considered as shared neighbors, as in the original
+ * algorithm.
+ */
+class GorderReordering final : public NodeReordering {
+public:
+    /**
+     * @param G The graph.
+     * @param windowSize Number of most recently placed nodes that determine the next node.
+     */
+    GorderReordering(const Graph &G, count windowSize = 5);
+
+    void run() override;
+
+private:
+    count windowSize;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_REORDERING_GORDER_REORDERING_HPP_
@@ -0,0 +1,122 @@
+/*
+ * NodeReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_REORDERING_NODE_REORDERING_HPP_
+#define NETWORKIT_REORDERING_NODE_REORDERING_HPP_
+
+#include <type_traits>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup reordering
+ * Abstract base class for algorithms that relabel the nodes of a graph to improve the cache
+ * locality of graph traversals. The new node ids are continuous, i.e., the reordered graph has
+ * no deleted nodes.
+ */
+class NodeReordering : public Algorithm {
+public:
+    /**
+     * @param G The graph whose nodes are reordered.
+     */
+    NodeReordering(const Graph &G);
+
+    /**
+     * Returns the permutation as a vector indexed by the original node ids: the new id of node
+     * u is getPermutation()[u]. Deleted nodes of the original graph are mapped to none.
+     */
+    const std::vector<node> &getPermutation() const {
+        assureFinished();
+        return permutation;
+    }
+
+    /**
+     * Returns the inverse permutation as a vector indexed by the new node ids: the original id of
+     * the new node v is getInversePermutation()[v].
+     */
+    const std::vector<node> &getInversePermutation() const {
+        assureFinished();
+        return inversePermutation;
+    }
+
+    /**
+     * Returns a copy of the graph with the nodes relabeled according to getPermutation().
+     * Weights and edge ids are preserved; the neighborhoods are sorted by the new node ids.
+     */
+    Graph getReorderedGraph() const;
+
+    /**
+     * Maps per-node values computed on the reordered graph back to the original graph.
+     *
+     * @param values Values indexed by the new node ids.
+     * @param defaultValue Value for the deleted nodes of the original graph.
+     * @return The values indexed by the original node ids.
+     */
+    template <typename T>
+    std::vector<T> mapToOriginal(const std::vector<T> &values, T defaultValue = T{}) const;
+
+    /**
+     * Maps a partition of the reordered graph (e.g., a clustering) back to the original graph.
+     * Deleted nodes of the original graph are not assigned to any subset.
+     *
+     * @param zeta A partition of the reordered graph.
+     * @return The partition of the original graph.
+     */
+    Partition mapToOriginal(const Partition &zeta) const;
+
+protected:
+    const Graph *G;
+
+    std::vector<node> permutation;
+    std::vector<node> inversePermutation;
+
+    /**
+     * Sets the permutation from the new order of the nodes, i.e., the inverse permutation.
+     * @a order must contain every node of the graph exactly once.
+     */
+    void setOrder(std::vector<node> order);
+
+    /**
+     * Calls @a handle for every neighbor of @a u, ignoring edge directions.
+     */
+    template <typename L>
+    void forUndirectedNeighborsOf(node u, L handle) const {
+        G->forNeighborsOf(u, handle);
+        if (G->isDirected())
+            G->forInNeighborsOf(u, handle);
+    }
+
+    /**
+     * Returns the degree of @a u ignoring edge directions.
+     */
+    count undirectedDegree(node u) const {
+        return G->isDirected() ? G->degreeOut(u) + G->degreeIn(u) : G->degree(u);
+    }
+};
+
+template <typename T>
+std::vector<T> NodeReordering::mapToOriginal(const std::vector<T> &values, T defaultValue) const {
+    assureFinished();
+    if (values.size() != inversePermutation.size())
+        throw std::runtime_error("Expected one value per node of the reordered graph");
+    std::vector<T> result(G->upperNodeIdBound(), defaultValue);
+    auto mapValue = [&](node u) { result[u] = values[permutation[u]]; };
+    // Concurrent writes to std::vector<bool> are not safe
+    if constexpr (std::is_same_v<T, bool>)
+        G->forNodes(mapValue);
+    else
+        G->parallelForNodes(mapValue);
+    return result;
+}
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_REORDERING_NODE_REORDERING_HPP_
@@ -0,0 +1,39 @@
+/*
+ * RCMReordering.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_REORDERING_RCM_REORDERING_HPP_
+#define NETWORKIT_REORDERING_RCM_REORDERING_HPP_
+
+#include <networkit/reordering/NodeReordering.hpp>
+
+namespace NetworKit {
+
+/**
+ * @ingroup reordering
+ * Reverse Cuthill-McKee ordering, which reduces the bandwidth of the adjacency matrix. Every
+ * component is traversed breadth-first from a pseudo-peripheral node (George-Liu heuristic),
+ * visiting the unvisited neighbors of each node by increasing degree; the resulting order is
+ * reversed. Edge directions are ignored.
+ */
+class RCMReordering final : public NodeReordering {
+public:
+    /**
+     * @param G The graph.
+     */
+    RCMReordering(const Graph &G);
+
+    void run() override;
+
+private:
+    std::vector<count> degrees;
+    std::vector<count> level;
+
+    node pseudoPeripheralNode(node start);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_REORDERING_RCM_REORDERING_HPP_
@@ -0,0 +1,63 @@
+/*
+ * BatchPersonalizedPageRank.hpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_SCD_BATCH_PERSONALIZED_PAGE_RANK_HPP_
+#define NETWORKIT_SCD_BATCH_PERSONALIZED_PAGE_RANK_HPP_
+
+#include <utility>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Computes approximate personalized PageRank vectors for many seeds at once and keeps the k nodes
+ * with the highest scores per seed. Each vector is computed by the same push procedure as
+ * ApproximatePageRank; the seeds are processed in parallel. The residuals and scores of a seed
+ * are kept in per-thread sparse vectors that are reset in time proportional to the number of
+ * touched nodes, so no dense vector is allocated or scanned per seed.
+ */
+class BatchPersonalizedPageRank final : public Algorithm {
+public:
+    /**
+     * @param G The undirected graph.
+     * @param seeds The seed nodes; the vectors of the seeds are computed independently.
+     * @param k The number of nodes with the highest scores that are kept per seed.
+     * @param alpha Loop probability of random walk.
+     * @param epsilon Error tolerance.
+     */
+    BatchPersonalizedPageRank(const Graph &G, std::vector<node> seeds, count k, double alpha,
+                              double epsilon = 1e-12);
+
+    /**
+     * Computes the personalized PageRank vectors of all seeds.
+     */
+    void run() override;
+
+    /**
+     * Returns, for every seed in the order passed to the constructor, the (at most) k nodes with
+     * the highest scores as pairs of node and score, sorted by decreasing score.
+     */
+    const std::vector<std::vector<std::pair<node, double>>> &topK() const {
+        assureFinished();
+        return results;
+    }
+
+private:
+    const Graph *G;
+    std::vector<node> seeds;
+    count k;
+    double alpha;
+    double epsilon;
+
+    std::vector<std::vector<std::pair<node, double>>> results;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_SCD_BATCH_PERSONALIZED_PAGE_RANK_HPP_
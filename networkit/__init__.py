@@ -76,6 +76,7 @@ from . import correlation
 from . import matching
 from . import coarsening
 from . import reachability
+from . import reordering
 from . import simulation
 from . import stats
 from . import viz
@@ -4,6 +4,7 @@ from libc.stdint cimport uint64_t
 from libc.stdint cimport uint8_t
 from libcpp.vector cimport vector
 from libcpp.utility cimport pair
+from libcpp.string cimport string
 from libcpp cimport bool as bool_t
 
 import math
@@ -14,6 +15,7 @@ from .dynbase import DynAlgorithm
 from .dynamics cimport _GraphEvent, GraphEvent
 from .graph cimport _Graph, Graph
 from .structures cimport _Cover, Cover, _Partition, Partition, count, index, node, edgeweight
+from .helpers import stdstring
 from networkit.algebraic import adjacencyEigenvector, PageRankMatrix, symmetricEigenvectors
 
 cdef extern from "limits.h":
@@ -136,6 +138,10 @@ cdef extern from "<networkit/centrality/Betweenness.hpp>":
 	cdef cppclass _Betweenness "NetworKit::Betweenness" (_Centrality):
 		_Betweenness(_Graph, bool_t, bool_t) except +
 		vector[double] edgeScores() except +
+		void setSourceShard(index shard, count numberOfShards) except +
+		void writePartialScores(string path) except +
+		@staticmethod
+		pair[vector[double], vector[double]] mergePartialScores(vector[string] paths) except +
 
 cdef class Betweenness(Centrality):
 	"""
@@ -174,6 +180,58 @@ cdef class Betweenness(Centrality):
 		"""
 		return (<_Betweenness*>(self._this)).edgeScores()
 
+	def setSourceShard(self, shard, numberOfShards):
+		"""
+		setSourceShard(shard, numberOfShards)
+
+		Restricts run() to the sources in one of `numberOfShards` shards: node u belongs to shard
+		u % numberOfShards. The scores of all shards sum up to the scores of an unrestricted run,
+		so an exact computation can be split across several processes or machines.
+
+		Parameters
+		----------
+		shard : int
+			The shard whose sources are processed, in [0, numberOfShards).
+		numberOfShards : int
+			The number of shards.
+		"""
+		(<_Betweenness*>(self._this)).setSourceShard(shard, numberOfShards)
+
+	def writePartialScores(self, path):
+		"""
+		writePartialScores(path)
+
+		Writes the (partial) node and edge scores of the last run to a binary file,
+		together with the shard of its sources.
+
+		Parameters
+		----------
+		path : str
+			The path of the file.
+		"""
+		(<_Betweenness*>(self._this)).writePartialScores(stdstring(path))
+
+	@staticmethod
+	def mergePartialScores(paths):
+		"""
+		mergePartialScores(paths)
+
+		Sums up the partial scores written by writePartialScores(). Raises an error if the files
+		do not contain exactly one run per shard on graphs of the same size with the same settings.
+
+		Parameters
+		----------
+		paths : list(str)
+			The files written by the runs of the individual shards.
+
+		Returns
+		-------
+		tuple(list(float), list(float))
+			The node scores and the edge scores (empty if they were not computed).
+		"""
+		cdef vector[string] cpaths = [stdstring(path) for path in paths]
+		return _Betweenness.mergePartialScores(cpaths)
+
 cdef extern from "<networkit/centrality/ApproxBetweenness.hpp>":
 
 	cdef cppclass _ApproxBetweenness "NetworKit::ApproxBetweenness" (_Centrality):
@@ -1882,15 +1940,26 @@ class EdgeDirection(object):
 	inEdges = IN_EDGES # this + following added for backwards compatibility
 	outEdges = OUT_EDGES
 
+cdef extern from "<networkit/centrality/KatzCentrality.hpp>":
+
+	cdef enum _KatzStrategy "NetworKit::KatzCentrality::Strategy":
+		KATZ_POWER_ITERATION "NetworKit::KatzCentrality::POWER_ITERATION",
+		KATZ_CONJUGATE_GRADIENT "NetworKit::KatzCentrality::CONJUGATE_GRADIENT"
+
+class KatzStrategy(object):
+	POWER_ITERATION = KATZ_POWER_ITERATION
+	CONJUGATE_GRADIENT = KATZ_CONJUGATE_GRADIENT
+
 cdef extern from "<networkit/centrality/KatzCentrality.hpp>":
 
 	cdef cppclass _KatzCentrality "NetworKit::KatzCentrality" (_Centrality):
 		_KatzCentrality(_Graph, double, double, double) except +
 		_EdgeDirection edgeDirection
+		_KatzStrategy strategy
 
 cdef class KatzCentrality(Centrality):
 	"""
-	KatzCentrality(G, alpha=0, beta=0.1, tol=1e-8)
+	KatzCentrality(G, alpha=0, beta=0.1, tol=1e-8, strategy=networkit.centrality.KatzStrategy.POWER_ITERATION)
 
 	Constructs a KatzCentrality object for the given Graph `G`.
 	Each iteration of the algorithm requires O(m) time.
@@ -1908,11 +1977,15 @@ cdef class KatzCentrality(Centrality):
 		Constant value added to the centrality of each vertex. Default: 0.1
 	tol : float, optional
 		The tolerance for convergence. Default: 1e-8
+	strategy : networkit.centrality.KatzStrategy, optional
+		Solver for the scores. CONJUGATE_GRADIENT solves the linear system of Katz centrality
+		directly and requires an undirected graph. Default: networkit.centrality.KatzStrategy.POWER_ITERATION
 	"""
 
-	def __cinit__(self, Graph G, alpha=0, beta=0.1, tol=1e-8):
+	def __cinit__(self, Graph G, alpha=0, beta=0.1, tol=1e-8, strategy=KatzStrategy.POWER_ITERATION):
 		self._G = G
 		self._this = new _KatzCentrality(G._this, alpha, beta, tol)
+		(<_KatzCentrality*>(self._this)).strategy = strategy
 
 	property edgeDirection:
 		"""
@@ -1930,6 +2003,22 @@ cdef class KatzCentrality(Centrality):
 			""" Use a different edge direction. """
 			(<_KatzCentrality*>(self._this)).edgeDirection = edgeDirection
 
+	property strategy:
+		"""
+		Property :code:`strategy` sets the solver and can be one of the following:
+
+		- networkit.centrality.KatzStrategy.POWER_ITERATION
+		- networkit.centrality.KatzStrategy.CONJUGATE_GRADIENT
+
+		Default: networkit.centrality.KatzStrategy.POWER_ITERATION
+		"""
+		def __get__(self):
+			""" Get the solver. """
+			return (<_KatzCentrality*>(self._this)).strategy
+		def __set__(self, _KatzStrategy strategy):
+			""" Set the solver. """
+			(<_KatzCentrality*>(self._this)).strategy = strategy
+
 cdef extern from "<networkit/centrality/DynKatzCentrality.hpp>":
 
 	cdef cppclass _DynKatzCentrality "NetworKit::DynKatzCentrality" (_Centrality, _DynAlgorithm):
@@ -2275,14 +2364,25 @@ cdef class CoreDecomposition(Centrality):
 		"""
 		return (<_CoreDecomposition*>(self._this)).getNodeOrder()
 
+cdef extern from "<networkit/centrality/EigenvectorCentrality.hpp>":
+
+	cdef enum _EigenvectorStrategy "NetworKit::EigenvectorCentrality::Strategy":
+		EIGENVECTOR_POWER_ITERATION "NetworKit::EigenvectorCentrality::POWER_ITERATION",
+		EIGENVECTOR_LANCZOS "NetworKit::EigenvectorCentrality::LANCZOS"
+
+class EigenvectorStrategy(object):
+	POWER_ITERATION = EIGENVECTOR_POWER_ITERATION
+	LANCZOS = EIGENVECTOR_LANCZOS
+
 cdef extern from "<networkit/centrality/EigenvectorCentrality.hpp>":
 
 	cdef cppclass _EigenvectorCentrality "NetworKit::EigenvectorCentrality" (_Centrality):
 		_EigenvectorCentrality(_Graph, double tol) except +
+		_EigenvectorStrategy strategy
 
 cdef class EigenvectorCentrality(Centrality):
 	"""	
-	EigenvectorCentrality(G, tol=1e-9)
+	EigenvectorCentrality(G, tol=1e-9, strategy=networkit.centrality.EigenvectorStrategy.POWER_ITERATION)
 	
 	Computes the leading eigenvector of the graph's adjacency matrix (normalized in 2-norm).
 	Interpreted as eigenvector centrality score.
@@ -2295,11 +2395,31 @@ cdef class EigenvectorCentrality(Centrality):
 		The input graph.
 	tol : float, optional
 		The tolerance for convergence.
+	strategy : networkit.centrality.EigenvectorStrategy, optional
+		Solver for the leading eigenvector. LANCZOS runs a Lanczos iteration and requires an
+		undirected graph. Default: networkit.centrality.EigenvectorStrategy.POWER_ITERATION
 	"""
 
-	def __cinit__(self, Graph G, double tol=1e-9):
+	def __cinit__(self, Graph G, double tol=1e-9, strategy=EigenvectorStrategy.POWER_ITERATION):
 		self._G = G
 		self._this = new _EigenvectorCentrality(G._this, tol)
+		(<_EigenvectorCentrality*>(self._this)).strategy = strategy
+
+	property strategy:
+		"""
+		Property :code:`strategy` sets the solver and can be one of the following:
+
+		- networkit.centrality.EigenvectorStrategy.POWER_ITERATION
+		- networkit.centrality.EigenvectorStrategy.LANCZOS
+
+		Default: networkit.centrality.EigenvectorStrategy.POWER_ITERATION
+		"""
+		def __get__(self):
+			""" Get the solver. """
+			return (<_EigenvectorCentrality*>(self._this)).strategy
+		def __set__(self, _EigenvectorStrategy strategy):
+			""" Set the solver. """
+			(<_EigenvectorCentrality*>(self._this)).strategy = strategy
 
 cdef extern from "<networkit/centrality/PageRank.hpp>" namespace "NetworKit::PageRank":
 
@@ -2311,6 +2431,11 @@ cdef extern from "<networkit/centrality/PageRank.hpp>" namespace "NetworKit::Pag
 		NO_SINK_HANDLING,
 		DISTRIBUTE_SINKS,
 
+	cdef enum _Strategy "NetworKit::PageRank::Strategy":
+		POWER_ITERATION,
+		GAUSS_SEIDEL,
+		RESIDUAL_PUSH
+
 class Norm(object):
 	L1_NORM = _Norm.L1_NORM
 	L2_NORM = _Norm.L2_NORM
@@ -2323,13 +2448,20 @@ class SinkHandling(object):
 	NoSinkHandling = NO_SINK_HANDLING # this + following added for backwards compatibility
 	DistributeSinks = DISTRIBUTE_SINKS
 
+class Strategy(object):
+	POWER_ITERATION = _Strategy.POWER_ITERATION
+	GAUSS_SEIDEL = _Strategy.GAUSS_SEIDEL
+	RESIDUAL_PUSH = _Strategy.RESIDUAL_PUSH
+
 cdef extern from "<networkit/centrality/PageRank.hpp>":
 
 	cdef cppclass _PageRank "NetworKit::PageRank" (_Centrality):
 		_PageRank(_Graph, double damp, double tol, bool_t normalized, _SinkHandling distributeSinks) except +
 		count numberOfIterations() except +
+		void setPersonalization(vector[double] personalization) except +
 		_Norm norm
 		count maxIterations
+		_Strategy strategy
 
 cdef class PageRank(Centrality):
 	""" 
@@ -2384,6 +2516,39 @@ cdef class PageRank(Centrality):
 		"""
 		return (<_PageRank*>(self._this)).numberOfIterations()
 
+	def setPersonalization(self, personalization):
+		"""
+		setPersonalization(personalization)
+
+		Sets the personalization vector: random jumps (and, with sink handling, the walks
+		leaving sinks) lead to node u with a probability proportional to personalization[u]
+		instead of uniformly at random. An empty list restores the uniform distribution.
+
+		Parameters
+		----------
+		personalization : list(float)
+			Non-negative values indexed by node id, with a positive sum.
+		"""
+		(<_PageRank*>(self._this)).setPersonalization(personalization)
+
+	property strategy:
+		"""
+		Property :code:`strategy` sets the iteration scheme and can be one of the following:
+
+		- networkit.centrality.Strategy.POWER_ITERATION
+		- networkit.centrality.Strategy.GAUSS_SEIDEL
+		- networkit.centrality.Strategy.RESIDUAL_PUSH
+
+		RESIDUAL_PUSH only processes nodes whose residual exceeds a threshold and stops when
+		the L1 error is below the tolerance. Default: networkit.centrality.Strategy.POWER_ITERATION
+		"""
+		def __get__(self):
+			""" Get the iteration scheme. """
+			return (<_PageRank*>(self._this)).strategy
+		def __set__(self, _Strategy strategy):
+			""" Set the iteration scheme. """
+			(<_PageRank*>(self._this)).strategy = strategy
+
 	property norm:
 		"""
 		Property :code:`norm` can be one of the following:
@@ -2416,6 +2581,102 @@ cdef class PageRank(Centrality):
 			(<_PageRank*>(self._this)).maxIterations = maxIterations
 
 
+cdef extern from "<networkit/centrality/DynPageRank.hpp>":
+
+	cdef cppclass _DynPageRank "NetworKit::DynPageRank" (_Centrality, _DynAlgorithm):
+		_DynPageRank(_Graph, double damp, double tol) except +
+		count numberOfPushes() except +
+
+cdef class DynPageRank(Centrality, DynAlgorithm):
+	"""
+	DynPageRank(G, damp=0.85, tol=1e-8)
+
+	Maintains PageRank under batches of node insertions and edge insertions, removals and
+	weight increments. The scores are those of PageRank with uniform random jumps and without
+	sink handling. Updates only push residual corrections from the endpoints of the updated
+	edges (and from all nodes if the number of nodes changes); after
+	run() and every update, the L1 error of the (unnormalized) scores is at most tol.
+	The graph must already reflect the changes when update() or updateBatch() is called.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		Graph to be processed.
+	damp : float, optional
+		Damping factor of the PageRank algorithm. Default: 0.85
+	tol : float, optional
+		Bound on the L1 error of the scores. Default: 1e-8
+	"""
+
+	def __cinit__(self, Graph G, double damp=0.85, double tol=1e-8):
+		self._G = G
+		self._this = new _DynPageRank(G._this, damp, tol)
+
+	def numberOfPushes(self):
+		"""
+		numberOfPushes()
+
+		Returns the number of residual pushes done by the last call to run() or an update.
+
+		Returns
+		-------
+		int
+			Number of residual pushes.
+		"""
+		return (<_DynPageRank*>(self._this)).numberOfPushes()
+
+cdef extern from "<networkit/centrality/DynCoreDecomposition.hpp>":
+
+	cdef cppclass _DynCoreDecomposition "NetworKit::DynCoreDecomposition" (_Centrality, _DynAlgorithm):
+		_DynCoreDecomposition(_Graph) except +
+		index maxCoreNumber() except +
+		count numberOfVisitedNodes() except +
+
+cdef class DynCoreDecomposition(Centrality, DynAlgorithm):
+	"""
+	DynCoreDecomposition(G)
+
+	Maintains the core numbers of an undirected graph without self-loops under edge
+	insertions and removals. An update only explores the nodes whose core number equals the
+	smaller core number of the endpoints and that are connected to them via such nodes.
+	The graph must already reflect the changes when update() or updateBatch() is called.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _DynCoreDecomposition(G._this)
+
+	def maxCoreNumber(self):
+		"""
+		maxCoreNumber()
+
+		Get maximum core number.
+
+		Returns
+		-------
+		int
+			The maximum core number.
+		"""
+		return (<_DynCoreDecomposition*>(self._this)).maxCoreNumber()
+
+	def numberOfVisitedNodes(self):
+		"""
+		numberOfVisitedNodes()
+
+		Returns the number of nodes explored by the last update.
+
+		Returns
+		-------
+		int
+			Number of explored nodes.
+		"""
+		return (<_DynCoreDecomposition*>(self._this)).numberOfVisitedNodes()
+
 cdef extern from "<networkit/centrality/SpanningEdgeCentrality.hpp>":
 
 	cdef cppclass _SpanningEdgeCentrality "NetworKit::SpanningEdgeCentrality"(_Algorithm):
@@ -5,21 +5,48 @@
  *      Author: cls, ebergamini
  */
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
 #include <memory>
 #include <omp.h>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/VectorComparator.hpp>
 #include <networkit/centrality/Betweenness.hpp>
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
 Betweenness::Betweenness(const Graph &G, bool normalized, bool computeEdgeCentrality)
     : Centrality(G, normalized, computeEdgeCentrality) {}
 
+Betweenness::Betweenness(const CSRGraph &G, bool normalized, bool computeEdgeCentrality)
+    : Centrality(G, normalized, computeEdgeCentrality) {}
+
 void Betweenness::run() {
+    if (csr)
+        runImpl(*csr);
+    else
+        runImpl(G);
+}
+
+template <class GraphType>
+void Betweenness::runImpl(const GraphType &G) {
+    // The SSSP classes of the bigfloat fallback require a Graph.
+    constexpr bool isGraph = std::is_same_v<GraphType, Graph>;
     Aux::SignalHandler handler;
     const count z = G.upperNodeIdBound();
     scoreData.clear();
@@ -30,57 +57,249 @@ void Betweenness::run() {
         edgeScoreData.resize(z2);
     }
 
-    std::vector<std::vector<double>> dependencies(omp_get_max_threads(), std::vector<double>(z));
-    std::vector<std::unique_ptr<SSSP>> sssps;
-    sssps.resize(omp_get_max_threads());
-#pragma omp parallel
-    {
-        omp_index i = omp_get_thread_num();
-        if (G.isWeighted())
-            sssps[i] = std::unique_ptr<SSSP>(new Dijkstra(G, 0, true, true));
-        else
-            sssps[i] = std::unique_ptr<SSSP>(new BFS(G, 0, true, true));
-    }
+    // The number of shortest paths is counted with doubles: exact up to 2^53 paths and with a
+    // relative error of about 1e-16 beyond, which is well below the error of the accumulated
+    // dependencies. Sources with more than ~1e308 shortest paths to some node fall back to the
+    // SSSP classes that count paths with bigfloat. So do graphs with non-positive edge weights,
+    // on which shortest paths are not well-defined by distances alone.
+    const bool positiveWeights =
+        !G.isWeighted()
+        || G.parallelSumForEdges([](node, node, edgeweight ew) { return ew <= 0 ? 1. : 0.; }) == 0;
 
-    auto computeDependencies = [&](node s) -> void {
-        std::vector<double> &dependency = dependencies[omp_get_thread_num()];
-        std::fill(dependency.begin(), dependency.end(), 0);
+    const auto threads = static_cast<index>(omp_get_max_threads());
+    const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+    // The per-thread vectors are allocated on first use: on unweighted graphs they are only needed
+    // for the sources whose path counts overflow.
+    std::vector<std::vector<double>> dependencies(threads);
+    std::vector<std::vector<double>> numberOfPaths(threads);
+    std::vector<std::vector<edgeweight>> distances(threads);
+    std::vector<std::vector<node>> nodesSortedByDistance(threads);
+    std::vector<tlx::d_ary_addressable_int_heap<node, 2, Aux::LessInVector<edgeweight>>> heaps;
+    heaps.reserve(threads);
+    for (index i = 0; i < threads; ++i)
+        heaps.emplace_back(Aux::LessInVector<edgeweight>{distances[i]});
+    std::vector<std::unique_ptr<SSSP>> sssps(threads);
+    std::unique_ptr<const Graph> converted;
+    auto graphForBigfloat = [&]() -> const Graph & {
+        if constexpr (isGraph) {
+            return G;
+        } else {
+#pragma omp critical(BetweennessConvertSnapshot)
+            if (!converted)
+                converted = std::make_unique<const Graph>(G.toGraph());
+            return *converted;
+        }
+    };
+
+    // Counts the shortest paths from s with doubles, returns false on overflow.
+    auto countPaths = [&](node s) -> bool {
+        const index thread = omp_get_thread_num();
+        auto &dist = distances[thread];
+        auto &sigma = numberOfPaths[thread];
+        auto &sorted = nodesSortedByDistance[thread];
+        if (dist.empty()) {
+            dist.assign(z, infDist);
+            sigma.assign(z, 0);
+        }
+
+        // Only reset the nodes reached from the previous source
+        for (const node u : sorted) {
+            dist[u] = infDist;
+            sigma[u] = 0;
+        }
+        sorted.clear();
+        dist[s] = 0;
+        sigma[s] = 1;
+
+        if (G.isWeighted()) {
+            auto &heap = heaps[thread];
+            heap.push(s);
+            while (!heap.empty()) {
+                const node u = heap.extract_top();
+                sorted.push_back(u);
+                G.forNeighborsOf(u, [&](node v, edgeweight ew) {
+                    const edgeweight newDist = dist[u] + ew;
+                    if (newDist < dist[v]) {
+                        dist[v] = newDist;
+                        sigma[v] = sigma[u];
+                        if (heap.contains(v))
+                            heap.update(v);
+                        else
+                            heap.push(v);
+                    } else if (newDist == dist[v]) {
+                        sigma[v] += sigma[u];
+                    }
+                });
+            }
+        } else {
+            // The vector of sorted nodes serves as BFS queue.
+            sorted.push_back(s);
+            for (index i = 0; i < sorted.size(); ++i) {
+                const node u = sorted[i];
+                G.forNeighborsOf(u, [&](node v) {
+                    if (dist[v] == infDist) {
+                        dist[v] = dist[u] + 1.;
+                        sorted.push_back(v);
+                    }
+                    if (dist[v] == dist[u] + 1.)
+                        sigma[v] += sigma[u];
+                });
+            }
+        }
+
+        return std::ranges::all_of(sorted, [&](node u) { return std::isfinite(sigma[u]); });
+    };
 
-        // run SSSP algorithm and keep track of everything
-        auto &sssp = *sssps[omp_get_thread_num()];
-        sssp.setSource(s);
+    auto computeDependencies = [&](node s) -> void {
+        const index thread = omp_get_thread_num();
         if (!handler.isRunning())
             return;
-        sssp.run();
-        if (!handler.isRunning())
+        if (dependencies[thread].empty())
+            dependencies[thread].resize(z);
+        if (!positiveWeights || !countPaths(s)) {
+            computeDependenciesWithBigfloat(graphForBigfloat(), s, sssps[thread],
+                                            dependencies[thread]);
             return;
-        // compute dependencies for nodes in order of decreasing distance from s
-        std::vector<node> stack = sssp.getNodesSortedByDistance();
-        while (!stack.empty()) {
-            node t = stack.back();
-            stack.pop_back();
-            for (node p : sssp.getPredecessors(t)) {
-                // workaround for integer overflow in large graphs
-                bigfloat tmp = sssp.numberOfPaths(p) / sssp.numberOfPaths(t);
-                double weight;
-                tmp.ToDouble(weight);
-                double c = weight * (1 + dependency[t]);
+        }
+
+        const auto &dist = distances[thread];
+        const auto &sigma = numberOfPaths[thread];
+        const auto &sorted = nodesSortedByDistance[thread];
+        auto &dependency = dependencies[thread];
+        for (const node u : sorted)
+            dependency[u] = 0;
+
+        // compute dependencies for nodes in order of decreasing distance from s; the predecessors
+        // of t are the in-neighbors on a shortest path, i.e., the same comparison as above.
+        for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+            const node t = *it;
+            const double factor = (1 + dependency[t]) / sigma[t];
+            G.forInEdgesOf(t, [&](node, node p, edgeweight ew, edgeid eid) {
+                if (dist[p] == infDist || dist[p] + ew != dist[t])
+                    return;
+                const double c = sigma[p] * factor;
                 dependency[p] += c;
 
                 if (computeEdgeCentrality) {
-                    const edgeid edgeId = G.edgeId(p, t);
 #pragma omp atomic
-                    edgeScoreData[edgeId] += c;
+                    edgeScoreData[eid] += c;
                 }
-            }
+            });
 
             if (t != s)
 #pragma omp atomic
                 scoreData[t] += dependency[t];
         }
     };
+
+    // Unweighted graphs are processed in batches of sources that share a bit-parallel BFS. The
+    // path counts and dependencies of a batch are stored interleaved per node, two doubles per
+    // node and source; the batch size is bounded by maxBatchMemory over all threads.
+    const count batchSize =
+        std::min(maxBatchMemory / (2 * sizeof(double) * threads * std::max<count>(z, 1)),
+                 MultiSourceBFS::maxSources);
+
     handler.assureRunning();
-    G.balancedParallelForNodes(computeDependencies);
+    if (G.isWeighted() || batchSize < 2) {
+        G.balancedParallelForNodes([&](node s) {
+            if (s % numberOfShards == shard)
+                computeDependencies(s);
+        });
+    } else {
+        using SourceMask = MultiSourceBFS::SourceMask;
+        std::vector<MultiSourceBFS> msBFSs(threads, MultiSourceBFS(G));
+        std::vector<std::vector<double>> batchPaths(threads), batchDependencies(threads);
+
+        auto forSourcesIn = [](SourceMask mask, auto handle) {
+            for (; mask; mask &= mask - 1)
+                handle(static_cast<index>(std::countr_zero(mask)));
+        };
+
+        auto computeBatchDependencies = [&](std::span<const node> batch) -> void {
+            const index thread = omp_get_thread_num();
+            auto &msBFS = msBFSs[thread];
+            auto &sigma = batchPaths[thread];
+            auto &dependency = batchDependencies[thread];
+            if (sigma.empty()) {
+                sigma.resize(z * batchSize);
+                dependency.resize(z * batchSize);
+            }
+
+            bool overflow = false;
+            msBFS.run(
+                batch,
+                [&](node u, count dist, SourceMask mask) {
+                    forSourcesIn(mask, [&](index i) {
+                        if (dist == 0)
+                            sigma[u * batchSize + i] = 1;
+                        overflow |= !std::isfinite(sigma[u * batchSize + i]);
+                    });
+                },
+                [&](node u, node v, SourceMask mask) {
+                    forSourcesIn(mask, [&](index i) {
+                        sigma[v * batchSize + i] += sigma[u * batchSize + i];
+                    });
+                });
+
+            // Nodes in the last level have no successors and thus no dependencies
+            for (count level = msBFS.numberOfLevels() - 1; level-- > 0 && !overflow;) {
+                msBFS.forShortestPathEdgesFromLevel(
+                    level, [&](node u, node v, edgeid eid, SourceMask mask) {
+                        double sum = 0;
+                        forSourcesIn(mask, [&](index i) {
+                            const double c = sigma[u * batchSize + i] / sigma[v * batchSize + i]
+                                             * (1 + dependency[v * batchSize + i]);
+                            dependency[u * batchSize + i] += c;
+                            sum += c;
+                        });
+
+                        if (computeEdgeCentrality) {
+#pragma omp atomic
+                            edgeScoreData[eid] += sum;
+                        }
+                    });
+
+                if (level == 0)
+                    break;
+                msBFS.forNodesAtLevel(level, [&](node u, SourceMask mask) {
+                    double sum = 0;
+                    forSourcesIn(mask, [&](index i) { sum += dependency[u * batchSize + i]; });
+#pragma omp atomic
+                    scoreData[u] += sum;
+                });
+            }
+
+            for (count level = 0; level < msBFS.numberOfLevels(); ++level)
+                msBFS.forNodesAtLevel(level, [&](node u, SourceMask mask) {
+                    forSourcesIn(mask, [&](index i) {
+                        sigma[u * batchSize + i] = 0;
+                        dependency[u * batchSize + i] = 0;
+                    });
+                });
+
+            if (overflow)
+                for (const node s : batch)
+                    computeDependencies(s);
+        };
+
+        std::vector<node> sources;
+        sources.reserve(G.numberOfNodes() / numberOfShards + 1);
+        G.forNodes([&](node u) {
+            if (u % numberOfShards == shard)
+                sources.push_back(u);
+        });
+        const auto numberOfBatches =
+            static_cast<omp_index>((sources.size() + batchSize - 1) / batchSize);
+
+#pragma omp parallel for schedule(dynamic)
+        for (omp_index b = 0; b < numberOfBatches; ++b) {
+            if (!handler.isRunning())
+                continue;
+            const index first = static_cast<index>(b) * batchSize;
+            computeBatchDependencies(std::span<const node>(sources).subspan(
+                first, std::min(batchSize, sources.size() - first)));
+        }
+    }
     handler.assureRunning();
 
     if (normalized) {
@@ -101,14 +320,145 @@ void Betweenness::run() {
     hasRun = true;
 }
 
+void Betweenness::computeDependenciesWithBigfloat(const Graph &G, node s,
+                                                  std::unique_ptr<SSSP> &sssp,
+                                                  std::vector<double> &dependency) {
+    std::fill(dependency.begin(), dependency.end(), 0);
+
+    // run SSSP algorithm and keep track of everything
+    if (!sssp) {
+        if (G.isWeighted())
+            sssp = std::make_unique<Dijkstra>(G, s, true, true);
+        else
+            sssp = std::make_unique<BFS>(G, s, true, true);
+    }
+    sssp->setSource(s);
+    sssp->run();
+
+    // compute dependencies for nodes in order of decreasing distance from s
+    std::vector<node> stack = sssp->getNodesSortedByDistance();
+    while (!stack.empty()) {
+        node t = stack.back();
+        stack.pop_back();
+        for (node p : sssp->getPredecessors(t)) {
+            // workaround for integer overflow in large graphs
+            bigfloat tmp = sssp->numberOfPaths(p) / sssp->numberOfPaths(t);
+            double weight;
+            tmp.ToDouble(weight);
+            double c = weight * (1 + dependency[t]);
+            dependency[p] += c;
+
+            if (computeEdgeCentrality) {
+                const edgeid edgeId = G.edgeId(p, t);
+#pragma omp atomic
+                edgeScoreData[edgeId] += c;
+            }
+        }
+
+        if (t != s)
+#pragma omp atomic
+            scoreData[t] += dependency[t];
+    }
+}
+
+namespace {
+// Header of the files written by Betweenness::writePartialScores()
+struct PartialScoresHeader {
+    std::array<char, 8> magic;
+    uint64_t shard;
+    uint64_t numberOfShards;
+    uint64_t normalized;
+    uint64_t numberOfNodeScores;
+    uint64_t numberOfEdgeScores;
+};
+
+constexpr std::array<char, 8> partialScoresMagic{'N', 'K', 'B', 'T', 'W', 'N', '0', '1'};
+} // namespace
+
+void Betweenness::setSourceShard(index shard, count numberOfShards) {
+    if (numberOfShards == 0 || shard >= numberOfShards)
+        throw std::runtime_error("The shard must be in [0, numberOfShards)");
+    this->shard = shard;
+    this->numberOfShards = numberOfShards;
+    hasRun = false;
+}
+
+void Betweenness::writePartialScores(std::string_view path) const {
+    assureFinished();
+    std::ofstream os(std::string{path}, std::ios::trunc | std::ios::binary);
+    os.exceptions(std::ofstream::badbit | std::ofstream::failbit);
+
+    const PartialScoresHeader header{partialScoresMagic, shard, numberOfShards, normalized,
+                                     scoreData.size(), edgeScoreData.size()};
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char *>(scoreData.data()),
+             static_cast<std::streamsize>(scoreData.size() * sizeof(double)));
+    os.write(reinterpret_cast<const char *>(edgeScoreData.data()),
+             static_cast<std::streamsize>(edgeScoreData.size() * sizeof(double)));
+}
+
+std::pair<std::vector<double>, std::vector<double>>
+Betweenness::mergePartialScores(const std::vector<std::string> &paths) {
+    if (paths.empty())
+        throw std::runtime_error("No partial scores to merge");
+
+    PartialScoresHeader first{};
+    std::vector<bool> seenShards;
+    std::vector<double> scores, edgeScores, buffer;
+
+    auto addScores = [&](std::ifstream &is, std::vector<double> &sum) {
+        buffer.resize(sum.size());
+        is.read(reinterpret_cast<char *>(buffer.data()),
+                static_cast<std::streamsize>(buffer.size() * sizeof(double)));
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(sum.size()); ++i)
+            sum[i] += buffer[i];
+    };
+
+    for (const auto &path : paths) {
+        std::ifstream is(path, std::ios::binary);
+        if (!is)
+            throw std::runtime_error("Cannot open partial scores file " + path);
+        is.exceptions(std::ifstream::badbit | std::ifstream::failbit);
+
+        PartialScoresHeader header;
+        is.read(reinterpret_cast<char *>(&header), sizeof(header));
+        if (header.magic != partialScoresMagic)
+            throw std::runtime_error(path + " is not a partial betweenness scores file");
+
+        if (seenShards.empty()) {
+            first = header;
+            seenShards.resize(header.numberOfShards);
+            scores.resize(header.numberOfNodeScores);
+            edgeScores.resize(header.numberOfEdgeScores);
+        } else if (header.numberOfShards != first.numberOfShards
+                   || header.normalized != first.normalized
+                   || header.numberOfNodeScores != first.numberOfNodeScores
+                   || header.numberOfEdgeScores != first.numberOfEdgeScores) {
+            throw std::runtime_error(path + " stems from a run with different settings");
+        }
+        if (header.shard >= header.numberOfShards || seenShards[header.shard])
+            throw std::runtime_error(path + " contains a duplicate or invalid shard");
+        seenShards[header.shard] = true;
+
+        addScores(is, scores);
+        addScores(is, edgeScores);
+    }
+
+    if (paths.size() != first.numberOfShards)
+        throw std::runtime_error("The partial scores of some shards are missing");
+
+    return {std::move(scores), std::move(edgeScores)};
+}
+
 double Betweenness::maximum() {
     if (normalized) {
         return 1;
     }
 
-    const double n = static_cast<double>(G.numberOfNodes());
+    const double n = static_cast<double>(csr ? csr->numberOfNodes() : G.numberOfNodes());
     double score = (n - 1) * (n - 2);
-    if (!G.isDirected())
+    if (!(csr ? csr->isDirected() : G.isDirected()))
         score /= 2.;
     return score;
 }
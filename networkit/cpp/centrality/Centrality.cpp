@@ -11,6 +11,14 @@
 
 namespace NetworKit {
 
+namespace {
+// The graph of the centralities that are constructed for a CSRGraph
+const Graph &emptyGraph() {
+    static const Graph empty;
+    return empty;
+}
+} // namespace
+
 Centrality::Centrality(const Graph &G, bool normalized, bool computeEdgeCentrality)
     : Algorithm(), G(G), normalized(normalized), computeEdgeCentrality(computeEdgeCentrality) {
     if (computeEdgeCentrality && !G.hasEdgeIds()) {
@@ -19,6 +27,15 @@ Centrality::Centrality(const Graph &G, bool normalized, bool computeEdgeCentrali
     }
 }
 
+Centrality::Centrality(const CSRGraph &G, bool normalized, bool computeEdgeCentrality)
+    : Algorithm(), G(emptyGraph()), csr(&G), normalized(normalized),
+      computeEdgeCentrality(computeEdgeCentrality) {
+    if (computeEdgeCentrality && !G.hasEdgeIds()) {
+        throw std::runtime_error("For edge centralities to be computed, the snapshot must "
+                                 "be created from a graph with indexed edges");
+    }
+}
+
 double Centrality::score(node v) {
     assureFinished();
     return scoreData.at(v);
@@ -27,7 +44,7 @@ double Centrality::score(node v) {
 std::vector<std::pair<node, double>> Centrality::ranking() {
     assureFinished();
     std::vector<std::pair<node, double>> ranking;
-    G.forNodes([&](node v) { ranking.emplace_back(v, scoreData[v]); });
+    forInputNodes([&](node v) { ranking.emplace_back(v, scoreData[v]); });
     Aux::Parallel::sort(ranking.begin(), ranking.end(),
                         [](std::pair<node, double> x, std::pair<node, double> y) {
                             if (x.second == y.second) {
@@ -56,7 +73,7 @@ double Centrality::maximum() {
 double Centrality::centralization() {
     assureFinished();
     double centerScore = 0.0;
-    G.forNodes([&](node v) {
+    forInputNodes([&](node v) {
         if (scoreData[v] > centerScore) {
             centerScore = scoreData[v];
         }
@@ -65,7 +82,7 @@ double Centrality::centralization() {
     double maxScore = maximum();
     double diff1 = 0.0;
     double diff2 = 0.0;
-    G.forNodes([&](node v) {
+    forInputNodes([&](node v) {
         diff1 += (centerScore - scoreData[v]);
         diff2 += (maxScore - scoreData[v]);
     });
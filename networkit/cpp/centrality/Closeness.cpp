@@ -6,12 +6,16 @@
  *              Eugenio Angriman <angrimae@hu-berlin.de>
  */
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <omp.h>
-#include <queue>
+#include <span>
 
 #include <networkit/centrality/Closeness.hpp>
 #include <networkit/components/ConnectedComponents.hpp>
 #include <networkit/components/StronglyConnectedComponents.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
@@ -51,12 +55,12 @@ void Closeness::run() {
 
     scoreData.clear();
     scoreData.resize(n);
-    visited.clear();
-    visited.resize(omp_get_max_threads(), std::vector<uint8_t>(n));
-    ts.clear();
-    ts.resize(omp_get_max_threads(), 0);
 
     if (G.isWeighted()) {
+        visited.clear();
+        visited.resize(omp_get_max_threads(), std::vector<uint8_t>(n));
+        ts.clear();
+        ts.resize(omp_get_max_threads(), 0);
         dDist.resize(omp_get_max_threads(), std::vector<double>(n));
         heaps.reserve(omp_get_max_threads());
         for (int i = 0; i < omp_get_max_threads(); ++i) {
@@ -65,7 +69,6 @@ void Closeness::run() {
         }
         dijkstra();
     } else {
-        uDist.resize(omp_get_max_threads(), std::vector<count>(n));
         bfs();
     }
 
@@ -73,40 +76,34 @@ void Closeness::run() {
 }
 
 void Closeness::bfs() {
-#pragma omp parallel for schedule(dynamic)
-    for (omp_index u = 0; u < static_cast<omp_index>(G.upperNodeIdBound()); ++u) {
-        uint8_t &ts_ = ts[omp_get_thread_num()];
-        auto &dist_ = uDist[omp_get_thread_num()];
-        auto &visited_ = visited[omp_get_thread_num()];
-
-        if (ts_++ == 255 && variant != ClosenessVariant::STANDARD) {
-            ts_ = 1;
-            std::fill(visited_.begin(), visited_.end(), 0);
-        }
+    // The sources are processed in batches that share a bit-parallel BFS.
+    std::vector<node> sources;
+    sources.reserve(G.numberOfNodes());
+    G.forNodes([&](node u) { sources.push_back(u); });
+    const count batchSize = MultiSourceBFS::maxSources;
+    const auto numberOfBatches =
+        static_cast<omp_index>((sources.size() + batchSize - 1) / batchSize);
+    std::vector<MultiSourceBFS> msBFSs(omp_get_max_threads(), MultiSourceBFS(G));
 
-        std::queue<node> q;
-        q.push(u);
-        dist_[u] = 0;
-        visited_[u] = ts_;
-        double sum = 0.;
-        count reached = 1;
-
-        do {
-            node x = q.front();
-            q.pop();
-            G.forNeighborsOf(x, [&](node y) {
-                if (visited_[y] != ts_) {
-                    visited_[y] = ts_;
-                    dist_[y] = dist_[x] + 1;
-                    sum += dist_[y];
-                    ++reached;
-                    q.push(y);
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index b = 0; b < numberOfBatches; ++b) {
+        const index first = static_cast<index>(b) * batchSize;
+        const auto batch = std::span<const node>(sources).subspan(
+            first, std::min(batchSize, sources.size() - first));
+
+        std::array<double, MultiSourceBFS::maxSources> sum{};
+        std::array<count, MultiSourceBFS::maxSources> reached{};
+        msBFSs[omp_get_thread_num()].run(
+            batch, [&](node, count dist, MultiSourceBFS::SourceMask mask) {
+                for (; mask; mask &= mask - 1) {
+                    const auto i = std::countr_zero(mask);
+                    sum[i] += static_cast<double>(dist);
+                    ++reached[i];
                 }
             });
 
-        } while (!q.empty());
-
-        updateScoreData(u, reached, sum);
+        for (index i = 0; i < batch.size(); ++i)
+            updateScoreData(batch[i], reached[i], sum[i]);
     }
 }
 
@@ -6,6 +6,9 @@
  *  Inplace change on Jun 26, 2015 by Henning Meyerhenke
  */
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <omp.h>
 #include <set>
 
@@ -23,8 +26,6 @@ CoreDecomposition::CoreDecomposition(const Graph &G, bool normalized,
                                  "self-loops. Call Graph.removeSelfLoops() first.");
     if (storeNodeOrder)
         this->enforceBucketQueueAlgorithm = true;
-    canRunInParallel =
-        (!enforceBucketQueueAlgorithm && (G.numberOfNodes() == G.upperNodeIdBound()));
 }
 
 void CoreDecomposition::run() {
@@ -48,14 +49,17 @@ void CoreDecomposition::runWithParK() {
     scoreData.resize(z); // TODO: move to base class
 
     count nUnprocessed = G.numberOfNodes();
-    std::vector<node> curr; // currently processed nodes
-    std::vector<node> next; // nodes to be processed next
+    std::vector<node> remaining; // nodes that have not been peeled before the last scan
+    std::vector<node> curr;      // currently processed nodes
+    std::vector<node> next;      // nodes to be processed next
     std::vector<char> active(z, 0);
     index level = 0; // current level
     count size = 0;  // number of nodes currently processed
 
     // fill in degrees
     std::vector<count> degrees(z);
+    remaining.reserve(nUnprocessed);
+    G.forNodes([&](node u) { remaining.push_back(u); });
     G.parallelForNodes([&](node u) {
         degrees[u] = G.degree(u);
         active[u] = 1;
@@ -63,25 +67,22 @@ void CoreDecomposition::runWithParK() {
 
     // main loop
     while (nUnprocessed > 0) {
-        // find nodes with degree == current level
-        if (!canRunInParallel || z <= 256) {
-            scan(level, degrees, curr);
-        } else {
-            scanParallel(level, degrees, curr, active);
-        }
+        // skip levels without nodes and find nodes with degree == current level
+        level = compactRemaining(degrees, remaining, active);
+        scan(level, degrees, remaining, curr);
 
         // process such nodes in curr
         size = curr.size();
         while (size > 0) {
             nUnprocessed -= size;
 #ifndef NETWORKIT_OMP2
-            if (!canRunInParallel || size <= 256) {
-                processSublevel(level, degrees, curr, next);
+            if (size <= 256) {
+                processSublevel(level, degrees, curr, next, active);
             } else {
                 processSublevelParallel(level, degrees, curr, next, active);
             }
 #else
-            processSublevel(level, degrees, curr, next);
+            processSublevel(level, degrees, curr, next, active);
 #endif
             std::swap(curr, next);
             size = curr.size();
@@ -94,24 +95,67 @@ void CoreDecomposition::runWithParK() {
     hasRun = true;
 }
 
-void CoreDecomposition::scan(index level, const std::vector<count> &degrees,
-                             std::vector<node> &curr) {
-    G.forNodes([&](node u) {
-        if (degrees[u] == level) {
-            curr.push_back(u);
+count CoreDecomposition::compactRemaining(const std::vector<count> &degrees,
+                                          std::vector<node> &remaining,
+                                          const std::vector<char> &active) const {
+    count minDegree = std::numeric_limits<count>::max();
+    if (remaining.size() <= 256) {
+        std::erase_if(remaining, [&](node u) { return !active[u]; });
+        for (const node u : remaining)
+            minDegree = std::min(minDegree, degrees[u]);
+        return minDegree;
+    }
+
+    // Each thread compacts a contiguous block of remaining, so the order of the nodes is kept.
+    std::vector<count> blockSize(omp_get_max_threads() + 1, 0);
+    std::vector<node> compacted;
+#pragma omp parallel
+    {
+        const auto threads = static_cast<count>(omp_get_num_threads());
+        const auto tid = static_cast<count>(omp_get_thread_num());
+        const count begin = remaining.size() * tid / threads;
+        const count end = remaining.size() * (tid + 1) / threads;
+        count localMin = std::numeric_limits<count>::max();
+        count kept = 0;
+        for (index i = begin; i < end; ++i) {
+            const node u = remaining[i];
+            if (active[u]) {
+                remaining[begin + kept++] = u;
+                localMin = std::min(localMin, degrees[u]);
+            }
         }
-    });
+        blockSize[tid + 1] = kept;
+#pragma omp critical
+        minDegree = std::min(minDegree, localMin);
+#pragma omp barrier
+#pragma omp single
+        {
+            std::partial_sum(blockSize.begin(), blockSize.begin() + threads + 1,
+                             blockSize.begin());
+            compacted.resize(blockSize[threads]);
+        }
+        std::copy(remaining.begin() + begin, remaining.begin() + begin + kept,
+                  compacted.begin() + blockSize[tid]);
+    }
+    remaining = std::move(compacted);
+    return minDegree;
 }
 
-void CoreDecomposition::scanParallel(index level, const std::vector<count> &degrees,
-                                     std::vector<node> &curr, std::vector<char> &active) {
-    const count z = G.upperNodeIdBound();
-    std::vector<std::vector<node>> next(omp_get_max_threads());
+void CoreDecomposition::scan(index level, const std::vector<count> &degrees,
+                             const std::vector<node> &remaining, std::vector<node> &curr) const {
     curr.clear();
+    if (remaining.size() <= 256) {
+        for (const node u : remaining)
+            if (degrees[u] == level)
+                curr.push_back(u);
+        return;
+    }
 
-#pragma omp parallel for schedule(guided)
-    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
-        if (active[u] && degrees[u] == level) {
+    std::vector<std::vector<node>> next(omp_get_max_threads());
+#pragma omp parallel for schedule(static)
+    for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i) {
+        const node u = remaining[i];
+        if (degrees[u] == level) {
             auto tid = omp_get_thread_num();
             next[tid].push_back(u);
         }
@@ -122,10 +166,12 @@ void CoreDecomposition::scanParallel(index level, const std::vector<count> &degr
 }
 
 void CoreDecomposition::processSublevel(index level, std::vector<count> &degrees,
-                                        const std::vector<node> &curr, std::vector<node> &next) {
+                                        const std::vector<node> &curr, std::vector<node> &next,
+                                        std::vector<char> &active) {
     // check for each neighbor of vertices in curr if their updated degree reaches level;
     // if so, process them next
     for (auto u : curr) {
+        active[u] = 0;
         scoreData[u] = level;
         G.forNeighborsOf(u, [&](node v) {
             if (degrees[v] > level) {
@@ -221,7 +267,7 @@ void CoreDecomposition::runWithBucketQueues() {
     }
 
     /* Current core and and computed scoreData values. */
-    index core = 0;
+    count core = 0;
     scoreData.clear();
     scoreData.resize(z);
 
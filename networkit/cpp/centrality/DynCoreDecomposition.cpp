@@ -0,0 +1,191 @@
+/*
+ * DynCoreDecomposition.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <networkit/centrality/CoreDecomposition.hpp>
+#include <networkit/centrality/DynCoreDecomposition.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+enum Status : uint8_t { UNSEEN = 0, IN_SUBCORE = 1, EVICTED = 2 };
+
+void removeOnce(std::unordered_map<node, std::vector<node>> &edges, node u, node v) {
+    auto &neighbors = edges.at(u);
+    neighbors.erase(std::find(neighbors.begin(), neighbors.end(), v));
+    if (neighbors.empty())
+        edges.erase(u);
+}
+
+} // namespace
+
+DynCoreDecomposition::DynCoreDecomposition(const Graph &G) : Centrality(G, false) {
+    if (G.isDirected())
+        throw std::runtime_error("DynCoreDecomposition requires an undirected graph");
+    if (G.numberOfSelfLoops())
+        throw std::runtime_error("DynCoreDecomposition does not support graphs with self-loops");
+}
+
+void DynCoreDecomposition::run() {
+    CoreDecomposition coreDec(G);
+    coreDec.run();
+    scoreData = coreDec.scores();
+    support.assign(G.upperNodeIdBound(), 0);
+    status.assign(G.upperNodeIdBound(), UNSEEN);
+    hasRun = true;
+}
+
+index DynCoreDecomposition::maxCoreNumber() const {
+    assureFinished();
+    index maxCore = 0;
+    G.forNodes([&](node u) { maxCore = std::max(maxCore, static_cast<index>(scoreData[u])); });
+    return maxCore;
+}
+
+template <typename L>
+void DynCoreDecomposition::forNeighborsOf(node u, L handle) const {
+    if (pendingInsertions.empty() && pendingRemovals.empty()) {
+        G.forNeighborsOf(u, handle);
+        return;
+    }
+
+    const auto inserted = pendingInsertions.find(u);
+    if (inserted == pendingInsertions.end()) {
+        G.forNeighborsOf(u, handle);
+    } else {
+        G.forNeighborsOf(u, [&](node v) {
+            if (std::find(inserted->second.begin(), inserted->second.end(), v)
+                == inserted->second.end())
+                handle(v);
+        });
+    }
+
+    const auto removed = pendingRemovals.find(u);
+    if (removed != pendingRemovals.end())
+        for (const node v : removed->second)
+            handle(v);
+}
+
+void DynCoreDecomposition::updateBatch(const std::vector<GraphEvent> &events) {
+    assureFinished();
+    for (const auto &e : events) {
+        if (e.type != GraphEvent::EDGE_ADDITION && e.type != GraphEvent::EDGE_REMOVAL)
+            throw std::runtime_error("Event type not allowed. Edge insertions or deletions only.");
+        if (e.u == e.v)
+            throw std::runtime_error("DynCoreDecomposition does not support self-loops");
+    }
+
+    // Nodes added since the last update are isolated, i.e., have core number 0.
+    const count z = G.upperNodeIdBound();
+    scoreData.resize(z, 0.0);
+    support.resize(z, 0);
+    status.resize(z, UNSEEN);
+
+    for (const auto &e : events) {
+        auto &pending = e.type == GraphEvent::EDGE_ADDITION ? pendingInsertions : pendingRemovals;
+        pending[e.u].push_back(e.v);
+        pending[e.v].push_back(e.u);
+    }
+
+    visited = 0;
+    for (const auto &e : events) {
+        if (e.type == GraphEvent::EDGE_ADDITION) {
+            removeOnce(pendingInsertions, e.u, e.v);
+            removeOnce(pendingInsertions, e.v, e.u);
+            insertEdge(e.u, e.v);
+        } else {
+            removeOnce(pendingRemovals, e.u, e.v);
+            removeOnce(pendingRemovals, e.v, e.u);
+            removeEdge(e.u, e.v);
+        }
+    }
+}
+
+void DynCoreDecomposition::exploreSubcore(index K, node u, node v) {
+    subcore.clear();
+    for (const node root : {u, v}) {
+        if (static_cast<index>(scoreData[root]) == K && status[root] == UNSEEN) {
+            status[root] = IN_SUBCORE;
+            subcore.push_back(root);
+        }
+    }
+
+    for (index i = 0; i < subcore.size(); ++i) {
+        const node w = subcore[i];
+        forNeighborsOf(w, [&](node x) {
+            const auto core = static_cast<index>(scoreData[x]);
+            if (core < K)
+                return;
+            ++support[w];
+            if (core == K && status[x] == UNSEEN) {
+                status[x] = IN_SUBCORE;
+                subcore.push_back(x);
+            }
+        });
+    }
+    visited += subcore.size();
+}
+
+void DynCoreDecomposition::insertEdge(node u, node v) {
+    // Only nodes of the subcore can reach core number K + 1; peel those that cannot.
+    const auto K = static_cast<index>(std::min(scoreData[u], scoreData[v]));
+    exploreSubcore(K, u, v);
+
+    evicted.clear();
+    auto evict = [&](node w) {
+        status[w] = EVICTED;
+        evicted.push_back(w);
+    };
+    for (const node w : subcore)
+        if (support[w] <= K)
+            evict(w);
+    for (index i = 0; i < evicted.size(); ++i) {
+        forNeighborsOf(evicted[i], [&](node x) {
+            if (status[x] == IN_SUBCORE && --support[x] <= K)
+                evict(x);
+        });
+    }
+
+    for (const node w : subcore) {
+        if (status[w] == IN_SUBCORE)
+            scoreData[w] = static_cast<double>(K + 1);
+        status[w] = UNSEEN;
+        support[w] = 0;
+    }
+}
+
+void DynCoreDecomposition::removeEdge(node u, node v) {
+    // Nodes of the subcores with fewer than K neighbors in the K-core drop to core number K - 1.
+    const auto K = static_cast<index>(std::min(scoreData[u], scoreData[v]));
+    exploreSubcore(K, u, v);
+
+    evicted.clear();
+    auto evict = [&](node w) {
+        status[w] = EVICTED;
+        evicted.push_back(w);
+    };
+    for (const node w : subcore)
+        if (support[w] < K)
+            evict(w);
+    for (index i = 0; i < evicted.size(); ++i) {
+        forNeighborsOf(evicted[i], [&](node x) {
+            if (status[x] == IN_SUBCORE && --support[x] < K)
+                evict(x);
+        });
+    }
+
+    for (const node w : subcore) {
+        if (status[w] == EVICTED)
+            scoreData[w] = static_cast<double>(K - 1);
+        status[w] = UNSEEN;
+        support[w] = 0;
+    }
+}
+
+} /* namespace NetworKit */
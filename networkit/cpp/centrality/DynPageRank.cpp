@@ -0,0 +1,190 @@
+/*
+ * DynPageRank.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <omp.h>
+#include <stdexcept>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/centrality/DynPageRank.hpp>
+
+namespace NetworKit {
+
+DynPageRank::DynPageRank(const Graph &G, double damp, double tol)
+    : Centrality(G, true), damp(damp), tol(tol) {}
+
+double DynPageRank::threshold() const {
+    // With all residuals below the threshold, the L1 error is at most n * threshold / (1 - damp).
+    return (1.0 - damp) * tol / static_cast<double>(G.numberOfNodes());
+}
+
+void DynPageRank::run() {
+    const count z = G.upperNodeIdBound();
+    const double teleport = (1.0 - damp) / static_cast<double>(G.numberOfNodes());
+
+    numberOfNodes = G.numberOfNodes();
+    pr.assign(z, 0.0);
+    residual.assign(z, 0.0);
+    deg.assign(z, 0.0);
+    G.parallelForNodes([&](const node u) {
+        deg[u] = G.weightedDegree(u);
+        residual[u] = teleport;
+    });
+
+    std::vector<node> active;
+    if (teleport > threshold())
+        G.forNodes([&](const node u) { active.push_back(u); });
+    pushResiduals(std::move(active));
+    updateScores();
+    hasRun = true;
+}
+
+void DynPageRank::updateBatch(const std::vector<GraphEvent> &events) {
+    assureFinished();
+    for (const auto &e : events) {
+        if (e.type != GraphEvent::NODE_ADDITION && e.type != GraphEvent::EDGE_ADDITION
+            && e.type != GraphEvent::EDGE_REMOVAL && e.type != GraphEvent::EDGE_WEIGHT_INCREMENT)
+            throw std::runtime_error("Event type not allowed. Node insertions, edge insertions, "
+                                     "deletions or weight increments only.");
+    }
+
+    const count z = G.upperNodeIdBound();
+    const count oldZ = pr.size();
+    pr.resize(z, 0.0);
+    residual.resize(z, 0.0);
+    deg.resize(z, 0.0);
+
+    // The residuals satisfy residual = (1 - damp) / n + damp * P^T pr - pr, where P is the
+    // transition matrix. An update of the edge (u, v) changes the column of u in P, i.e., the
+    // contributions of pr[u] to all out-neighbors of u, so we correct the residuals accordingly.
+    const double thresh = threshold();
+    std::vector<node> active;
+    auto addResidual = [&](const node v, const double value) {
+        const double old = residual[v];
+        residual[v] += value;
+        if (std::abs(old) <= thresh && std::abs(residual[v]) > thresh)
+            active.push_back(v);
+    };
+
+    // Nodes added since the last update have score 0, so their residual is the teleport
+    // probability. The teleport probability of the other nodes changes with the number of nodes.
+    // As the threshold shrinks, all nodes are activated (the push skips repeated activations).
+    if (G.numberOfNodes() != numberOfNodes) {
+        const double teleport = (1.0 - damp) / static_cast<double>(G.numberOfNodes());
+        const double change =
+            numberOfNodes ? teleport - (1.0 - damp) / static_cast<double>(numberOfNodes) : 0.0;
+        G.forNodes([&](const node u) {
+            residual[u] += u < oldZ ? change : teleport;
+            active.push_back(u);
+        });
+        numberOfNodes = G.numberOfNodes();
+    }
+
+    std::vector<node> sources;
+    // The contribution of u to v changes by damp * pr[u] * (w_new / deg_new - w_old / deg_old),
+    // which we split into damp * pr[u] * (w_new - w_old) / deg_old for the updated edges and
+    // damp * pr[u] * w_new * (1 / deg_new - 1 / deg_old) for all current out-edges of u.
+    auto changeWeight = [&](const node u, const node v, const edgeweight delta) {
+        sources.push_back(u);
+        if (deg[u] > 0.0)
+            addResidual(v, damp * pr[u] * delta / deg[u]);
+    };
+    for (const auto &e : events) {
+        if (e.type == GraphEvent::NODE_ADDITION)
+            continue;
+        const edgeweight w = G.isWeighted() ? e.w : defaultEdgeWeight;
+        const edgeweight delta = e.type == GraphEvent::EDGE_REMOVAL ? -w : w;
+        changeWeight(e.u, e.v, delta);
+        if (!G.isDirected() && e.u != e.v)
+            changeWeight(e.v, e.u, delta);
+    }
+
+    std::ranges::sort(sources);
+    sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+    for (const node u : sources) {
+        const double newDeg = G.weightedDegree(u);
+        const double factor =
+            (newDeg > 0.0 ? 1.0 / newDeg : 0.0) - (deg[u] > 0.0 ? 1.0 / deg[u] : 0.0);
+        deg[u] = newDeg;
+        if (factor == 0.0 || pr[u] == 0.0)
+            continue;
+        G.forNeighborsOf(u, [&](node, const node v, const edgeweight w) {
+            addResidual(v, damp * pr[u] * w * factor);
+        });
+    }
+
+    pushResiduals(std::move(active));
+    updateScores();
+}
+
+void DynPageRank::pushResiduals(std::vector<node> active) {
+    Aux::SignalHandler handler;
+    const double thresh = threshold();
+    std::vector<std::vector<node>> activated(omp_get_max_threads());
+    auto addResidual = [&](const node v, const double value, std::vector<node> &next) {
+        double old;
+#pragma omp atomic capture
+        {
+            old = residual[v];
+            residual[v] += value;
+        }
+        if (std::abs(old) <= thresh && std::abs(old + value) > thresh)
+            next.push_back(v);
+    };
+
+    // The residuals of updated graphs can be negative; pushes reduce their L1 norm nonetheless.
+    pushes = 0;
+    while (!active.empty()) {
+        handler.assureRunning();
+        count roundPushes = 0;
+
+#pragma omp parallel reduction(+ : roundPushes)
+        {
+            auto &next = activated[omp_get_thread_num()];
+            next.clear();
+#pragma omp for schedule(guided) nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+                const node u = active[i];
+                double r;
+#pragma omp atomic capture
+                {
+                    r = residual[u];
+                    residual[u] = 0.0;
+                }
+                if (r == 0.0)
+                    continue;
+                // u may be activated twice within one round
+#pragma omp atomic
+                pr[u] += r;
+                ++roundPushes;
+
+                if (deg[u] == 0.0)
+                    continue;
+                const double share = damp * r / deg[u];
+                G.forNeighborsOf(u, [&](node, const node v, const edgeweight w) {
+                    addResidual(v, share * w, next);
+                });
+            }
+        }
+
+        active.clear();
+        for (const auto &next : activated)
+            active.insert(active.end(), next.begin(), next.end());
+        pushes += roundPushes;
+    }
+}
+
+void DynPageRank::updateScores() {
+    scoreData = pr;
+    if (G.isDirected()) {
+        // As in PageRank without sink handling, make sure that |pr| == 1
+        const auto sum = G.parallelSumForNodes([&](const node u) { return pr[u]; });
+        G.parallelForNodes([&](const node u) { scoreData[u] /= sum; });
+    }
+}
+
+} /* namespace NetworKit */
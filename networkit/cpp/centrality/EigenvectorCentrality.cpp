@@ -7,8 +7,10 @@
 
 #include <cmath>
 
+#include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/centrality/EigenvectorCentrality.hpp>
+#include <networkit/numerics/LanczosEigensolver.hpp>
 
 namespace NetworKit {
 
@@ -16,6 +18,11 @@ EigenvectorCentrality::EigenvectorCentrality(const Graph &G, double tol)
     : Centrality(G, true), tol(tol) {}
 
 void EigenvectorCentrality::run() {
+    if (strategy == Strategy::LANCZOS) {
+        runLanczos();
+        return;
+    }
+
     std::vector<double> values(G.upperNodeIdBound(), 1.0);
     scoreData = values;
 
@@ -55,4 +62,25 @@ void EigenvectorCentrality::run() {
     hasRun = true;
 }
 
+void EigenvectorCentrality::runLanczos() {
+    if (G.isDirected())
+        throw std::runtime_error("The Lanczos strategy requires an undirected graph");
+
+    const CSRMatrix A = CSRMatrix::adjacencyMatrix(G);
+    LanczosEigensolver<CSRMatrix> solver(A, 1, tol);
+    // The Perron vector is nonnegative, so it is not orthogonal to the all-ones vector.
+    Vector start(G.upperNodeIdBound(), 0.0);
+    G.forNodes([&](node u) { start[u] = 1.0; });
+    solver.setStartVector(std::move(start));
+    solver.run();
+
+    const Vector &x = solver.eigenvectors().front();
+    const double sum = G.parallelSumForNodes([&](node u) { return x[u]; });
+    const double sign = sum < 0 ? -1.0 : 1.0;
+    scoreData.assign(G.upperNodeIdBound(), 0.0);
+    G.parallelForNodes([&](node u) { scoreData[u] = sign * x[u]; });
+
+    hasRun = true;
+}
+
 } /* namespace NetworKit */
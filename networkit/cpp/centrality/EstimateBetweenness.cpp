@@ -8,6 +8,7 @@
 #include <networkit/auxiliary/Parallelism.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/EstimateBetweenness.hpp>
+#include <networkit/centrality/FrontierParallelBrandes.hpp>
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/SSSP.hpp>
@@ -80,9 +81,28 @@ void EstimateBetweenness::run() {
         }
     };
 
+    if (parallel_flag && !G.isWeighted() && sampledNodes.size() < maxThreads) {
+        // Too few samples to keep all threads busy: process one source after another, each with
+        // all threads.
+        FrontierParallelBrandes brandes(G, true);
+        auto &scores = scorePerThread[0];
+        for (const node s : sampledNodes) {
+            if (!handler.isRunning())
+                break;
+            if (brandes.run(s)) {
+                brandes.parallelForReachedNodes([&](node t, double dependency) {
+                    if (t != s)
+                        scores[t] += dependency;
+                });
+            } else {
+                computeDependencies(s);
+            }
+        }
+    } else {
 #pragma omp parallel for if (parallel_flag)
-    for (omp_index i = 0; i < static_cast<omp_index>(sampledNodes.size()); ++i) {
-        computeDependencies(sampledNodes[i]);
+        for (omp_index i = 0; i < static_cast<omp_index>(sampledNodes.size()); ++i) {
+            computeDependencies(sampledNodes[i]);
+        }
     }
 
     if (parallel_flag) {
@@ -0,0 +1,120 @@
+/*
+ * FrontierParallelBrandes.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <cassert>
+#include <cmath>
+#include <omp.h>
+
+#include <networkit/centrality/FrontierParallelBrandes.hpp>
+
+namespace NetworKit {
+
+FrontierParallelBrandes::FrontierParallelBrandes(const Graph &G, bool scaleByDistance)
+    : G(&G), scaleByDistance(scaleByDistance), dist(G.upperNodeIdBound(), none),
+      sigma(G.upperNodeIdBound(), 0), delta(G.upperNodeIdBound(), 0),
+      visited(G.upperNodeIdBound(), 0), discovered(omp_get_max_threads()) {}
+
+bool FrontierParallelBrandes::run(node source) {
+    assert(G->hasNode(source));
+
+    // Only reset the nodes reached from the previous source
+#pragma omp parallel for schedule(static)
+    for (omp_index i = 0; i < static_cast<omp_index>(sorted.size()); ++i) {
+        const node u = sorted[i];
+        dist[u] = none;
+        sigma[u] = 0;
+        delta[u] = 0;
+        visited[u] = 0;
+    }
+
+    sorted.assign(1, source);
+    levelBegin.assign({0, 1});
+    dist[source] = 0;
+    sigma[source] = 1;
+    visited[source] = 1;
+    bool overflow = false;
+
+    // Forward phase: level-synchronous BFS. The discovered nodes are claimed with an atomic
+    // exchange, then each node of the new level sums up the path counts of its in-neighbors in
+    // the previous level.
+    for (count level = 0; levelBegin[level] < levelBegin[level + 1]; ++level) {
+        const index begin = levelBegin[level];
+        const index end = levelBegin[level + 1];
+
+#pragma omp parallel
+        {
+            auto &local = discovered[omp_get_thread_num()];
+            local.clear();
+#pragma omp for schedule(guided) nowait
+            for (omp_index i = static_cast<omp_index>(begin); i < static_cast<omp_index>(end);
+                 ++i) {
+                G->forNeighborsOf(sorted[i], [&](node v) {
+                    uint8_t wasVisited;
+#pragma omp atomic read
+                    wasVisited = visited[v];
+                    if (wasVisited)
+                        return;
+#pragma omp atomic capture
+                    {
+                        wasVisited = visited[v];
+                        visited[v] = 1;
+                    }
+                    if (!wasVisited)
+                        local.push_back(v);
+                });
+            }
+        }
+
+        for (const auto &local : discovered)
+            sorted.insert(sorted.end(), local.begin(), local.end());
+        levelBegin.push_back(sorted.size());
+        const index nextEnd = sorted.size();
+
+#pragma omp parallel for schedule(static)
+        for (omp_index i = static_cast<omp_index>(end); i < static_cast<omp_index>(nextEnd); ++i)
+            dist[sorted[i]] = level + 1;
+
+#pragma omp parallel for schedule(guided) reduction(|| : overflow)
+        for (omp_index i = static_cast<omp_index>(end); i < static_cast<omp_index>(nextEnd); ++i) {
+            const node v = sorted[i];
+            double paths = 0;
+            G->forInNeighborsOf(v, [&](node u) {
+                if (dist[u] == level)
+                    paths += sigma[u];
+            });
+            sigma[v] = paths;
+            overflow = overflow || !std::isfinite(paths);
+        }
+    }
+
+    // The last level is empty
+    levelBegin.pop_back();
+    if (overflow)
+        return false;
+
+    // Backward phase: each node pulls the dependencies of its successors in the next level.
+    for (count level = numberOfLevels() - 1; level-- > 0;) {
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = static_cast<omp_index>(levelBegin[level]);
+             i < static_cast<omp_index>(levelBegin[level + 1]); ++i) {
+            const node u = sorted[i];
+            double dependency = 0;
+            G->forNeighborsOf(u, [&](node v) {
+                if (dist[v] != level + 1)
+                    return;
+                double c = sigma[u] / sigma[v] * (1 + delta[v]);
+                if (scaleByDistance)
+                    c *= static_cast<double>(level) / static_cast<double>(level + 1);
+                dependency += c;
+            });
+            delta[u] = dependency;
+        }
+    }
+
+    return true;
+}
+
+} // namespace NetworKit
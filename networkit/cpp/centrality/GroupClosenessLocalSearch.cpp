@@ -195,7 +195,7 @@ count GroupClosenessLocalSearchImpl<WeightType>::estimateDiamDirected() {
 
             } while (!q1.empty());
 
-            estDiam = std::max(estDiam, dist);
+            estDiam = std::max<count>(estDiam, dist);
             ++dist;
             std::swap(q1, q2);
         } while (!q1.empty());
@@ -128,8 +128,8 @@ GroupHarmonicClosenessImpl<WeightType>::GroupHarmonicClosenessImpl(const Graph &
             dijkstraHeaps.emplace_back(curDistGlobal[i]);
             dijkstraHeaps.back().reserve(n);
         }
-        G.forEdges([&minEdgeWeight = minEdgeWeight](node, node, WeightType ew) {
-            minEdgeWeight = std::min(minEdgeWeight, ew);
+        G.forEdges([&minEdgeWeight = minEdgeWeight](node, node, edgeweight ew) {
+            minEdgeWeight = std::min(minEdgeWeight, static_cast<WeightType>(ew));
         });
     }
 
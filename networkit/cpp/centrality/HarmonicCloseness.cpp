@@ -5,12 +5,16 @@
  * 		 Author: Eugenio Angriman
  */
 
-#include <memory>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <omp.h>
+#include <span>
 
 #include <networkit/centrality/HarmonicCloseness.hpp>
-#include <networkit/distance/BFS.hpp>
 #include <networkit/distance/Dijkstra.hpp>
-#include <networkit/distance/SSSP.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 
 namespace NetworKit {
 
@@ -18,29 +22,53 @@ HarmonicCloseness::HarmonicCloseness(const Graph &G, bool normalized) : Centrali
 
 void HarmonicCloseness::run() {
     scoreData.assign(G.upperNodeIdBound(), 0.);
-    edgeweight infDist = std::numeric_limits<edgeweight>::max();
-
-    G.parallelForNodes([&](node v) {
-        std::unique_ptr<SSSP> sssp;
-        if (G.isWeighted()) {
-            sssp = std::make_unique<Dijkstra>(G, v, true, true);
-        } else {
-            sssp = std::make_unique<BFS>(G, v, true, true);
-        }
+    if (!G.isWeighted()) {
+        // The sources are processed in batches that share a bit-parallel BFS.
+        std::vector<node> sources;
+        sources.reserve(G.numberOfNodes());
+        G.forNodes([&](node u) { sources.push_back(u); });
+        const count batchSize = MultiSourceBFS::maxSources;
+        const auto numberOfBatches =
+            static_cast<omp_index>((sources.size() + batchSize - 1) / batchSize);
+        std::vector<MultiSourceBFS> msBFSs(omp_get_max_threads(), MultiSourceBFS(G));
 
-        sssp->run();
+#pragma omp parallel for schedule(dynamic)
+        for (omp_index b = 0; b < numberOfBatches; ++b) {
+            const index first = static_cast<index>(b) * batchSize;
+            const auto batch = std::span<const node>(sources).subspan(
+                first, std::min(batchSize, sources.size() - first));
 
-        std::vector<edgeweight> distances = sssp->getDistances();
+            std::array<double, MultiSourceBFS::maxSources> sum{};
+            msBFSs[omp_get_thread_num()].run(
+                batch, [&](node, count dist, MultiSourceBFS::SourceMask mask) {
+                    if (dist == 0)
+                        return;
+                    const double inverseDist = 1. / static_cast<double>(dist);
+                    for (; mask; mask &= mask - 1)
+                        sum[std::countr_zero(mask)] += inverseDist;
+                });
 
-        double sum = 0;
-        for (auto dist : distances) {
-            if (dist != infDist && dist != 0) {
-                sum += 1 / dist;
-            }
+            for (index i = 0; i < batch.size(); ++i)
+                scoreData[batch[i]] = sum[i];
         }
+    } else {
+        const edgeweight infDist = std::numeric_limits<edgeweight>::max();
+        G.parallelForNodes([&](node v) {
+            Dijkstra sssp(G, v, false, false);
+            sssp.run();
+
+            const std::vector<edgeweight> &distances = sssp.getDistances();
 
-        scoreData[v] = sum;
-    });
+            double sum = 0;
+            for (auto dist : distances) {
+                if (dist != infDist && dist != 0) {
+                    sum += 1 / dist;
+                }
+            }
+
+            scoreData[v] = sum;
+        });
+    }
     if (normalized) {
         G.forNodes([&](node w) { scoreData[w] /= static_cast<double>(G.numberOfNodes() - 1); });
     }
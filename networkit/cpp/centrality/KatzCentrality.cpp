@@ -5,10 +5,15 @@
  *      Author: Henning
  */
 
+#include <cmath>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/centrality/KatzCentrality.hpp>
 #include <networkit/graph/GraphTools.hpp>
+#include <networkit/numerics/ConjugateGradient.hpp>
+#include <networkit/numerics/Preconditioner/IdentityPreconditioner.hpp>
 
 namespace NetworKit {
 
@@ -24,6 +29,11 @@ KatzCentrality::KatzCentrality(const Graph &G, double alpha, double beta, double
 }
 
 void KatzCentrality::run() {
+    if (strategy == Strategy::CONJUGATE_GRADIENT) {
+        runConjugateGradient();
+        return;
+    }
+
     std::fill(values.begin(), values.end(), 1.0);
     values.resize(G.upperNodeIdBound(), 1.0);
     scoreData = values;
@@ -69,4 +79,42 @@ void KatzCentrality::run() {
     hasRun = true;
 }
 
+void KatzCentrality::runConjugateGradient() {
+    if (G.isDirected())
+        throw std::runtime_error("The conjugate gradient strategy requires an undirected graph");
+
+    // The fixed point of the power iteration is x = alpha * A (x + 1) + beta * 1.
+    const count z = G.upperNodeIdBound();
+    std::vector<Triplet> triplets;
+    triplets.reserve(2 * G.numberOfEdges() + G.numberOfNodes());
+    Vector rhs(z, 0.0);
+    G.forNodes([&](node u) {
+        double diagonal = 1.0;
+        G.forNeighborsOf(u, [&](node, node v, edgeweight ew) {
+            rhs[u] += alpha * ew;
+            if (u == v)
+                diagonal -= alpha * ew;
+            else
+                triplets.push_back({u, v, -alpha * ew});
+        });
+        rhs[u] += beta;
+        triplets.push_back({u, u, diagonal});
+    });
+
+    const CSRMatrix M(z, triplets);
+    ConjugateGradient<CSRMatrix, IdentityPreconditioner> cg(tol);
+    cg.setup(M);
+    Vector x(z, 0.0);
+    const auto status = cg.solve(rhs, x);
+    if (!status.converged)
+        throw std::runtime_error("The conjugate gradient method did not converge; alpha must be "
+                                 "smaller than the inverse of the largest eigenvalue");
+
+    const double length = std::sqrt(G.parallelSumForNodes([&](node u) { return x[u] * x[u]; }));
+    scoreData.assign(z, 0.0);
+    G.parallelForNodes([&](node u) { scoreData[u] = x[u] / length; });
+
+    hasRun = true;
+}
+
 } /* namespace NetworKit */
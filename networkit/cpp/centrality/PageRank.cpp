@@ -6,10 +6,17 @@
  *               Fabian Brandt-Tumescheit <brandtfa@hu-berlin.de>
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <omp.h>
+#include <stdexcept>
+
 #include <networkit/auxiliary/NumericTools.hpp>
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/centrality/PageRank.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 
 namespace NetworKit {
 
@@ -18,21 +25,41 @@ PageRank::PageRank(const Graph &G, double damp, double tol, bool normalized,
     : Centrality(G, true), damp(damp), tol(tol), normalized(normalized),
       distributeSinks(distributeSinks) {}
 
+void PageRank::setPersonalization(std::vector<double> personalization) {
+    if (std::ranges::any_of(personalization, [](double p) { return p < 0; }))
+        throw std::runtime_error("The personalization vector must not contain negative values");
+    this->personalization = std::move(personalization);
+}
+
 void PageRank::run() {
     Aux::SignalHandler handler;
     const auto n = G.numberOfNodes();
     const auto z = G.upperNodeIdBound();
 
-    const auto teleportProb = (1.0 - damp) / static_cast<double>(n);
-    const double factor = damp / static_cast<double>(n);
-    scoreData.resize(z, 1.0 / static_cast<double>(n));
-    std::vector<double> pr = scoreData;
+    // Distribution of the random jumps
+    std::vector<double> teleport(z, 0.0);
+    if (personalization.empty()) {
+        G.parallelForNodes([&](const node u) { teleport[u] = 1.0 / static_cast<double>(n); });
+    } else {
+        if (personalization.size() < z)
+            throw std::runtime_error("The personalization vector must have an entry for each node");
+        const double sum = G.parallelSumForNodes([&](const node u) { return personalization[u]; });
+        if (!(sum > 0))
+            throw std::runtime_error("The personalization vector must have a positive sum");
+        G.parallelForNodes([&](const node u) { teleport[u] = personalization[u] / sum; });
+    }
 
     std::vector<double> deg(z, 0.0);
     G.parallelForNodes([&](const node u) { deg[u] = static_cast<double>(G.weightedDegree(u)); });
 
+    // For directed graphs sink-handling is needed to fulfill |pr| == 1 in each step. Otherwise
+    // probability mass would be leaked, creating wrong results. For this, we add edges from
+    // sinks to all other nodes. This is described amongst others in "PageRank revisited."
+    // by M. Brinkmeyer et al. (2005).
+    const bool handleSinks =
+        G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized);
     std::vector<node> sinks;
-    if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
+    if (handleSinks) {
         G.forNodes([&](const node u) {
             if (G.degree(u) == 0) {
                 sinks.push_back(u);
@@ -41,59 +68,206 @@ void PageRank::run() {
     }
     count nSinks = sinks.size();
 
-    iterations = 0;
+    auto sinkContribution = [&]() {
+        double totalSinkContrib = 0.0;
+        if (handleSinks) {
+#pragma omp parallel for reduction(+ : totalSinkContrib)
+            for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
+                totalSinkContrib += damp * scoreData[sinks[i]];
+            }
+        }
+        return totalSinkContrib;
+    };
+
+    // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed graphs we
+    // follow the verbal description, which requires to sum over the incoming edges
+    auto pullContributions = [&](const node u, const auto &contrib) {
+        double sum = 0.0;
+        G.forInNeighborsOf(u, [&](const node v, const edgeweight w) { sum += contrib(v) * w; });
+        return sum;
+    };
 
-    auto sumL1Norm = [&](const node u) { return std::abs(scoreData[u] - pr[u]); };
+    // Same as pullContributions, but over the contiguous in-neighborhoods of a CSR snapshot
+    auto pullContributionsCSR = [&](const CSRGraph &csr, const node u, const auto &contrib) {
+        const auto neighbors = G.isDirected() ? csr.inNeighborRange(u) : csr.neighborRange(u);
+        double sum = 0.0;
+        if (G.isWeighted()) {
+            const auto weights =
+                G.isDirected() ? csr.inNeighborWeightRange(u) : csr.neighborWeightRange(u);
+            for (index i = 0; i < neighbors.size(); ++i)
+                sum += contrib(neighbors[i]) * weights[i];
+        } else {
+            for (const node v : neighbors)
+                sum += contrib(v);
+        }
+        return sum;
+    };
 
-    auto sumL2Norm = [&](const node u) {
-        const auto d = scoreData[u] - pr[u];
-        return d * d;
+    auto addToNorm = [&](double &residual, const double difference) {
+        residual += norm == Norm::L2_NORM ? difference * difference : std::abs(difference);
     };
 
-    auto converged([&]() {
+    auto converged = [&](const double residual) {
         if (iterations >= maxIterations) {
             return true;
         }
+        return (norm == Norm::L2_NORM ? std::sqrt(residual) : residual) <= tol;
+    };
 
-        if (norm == Norm::L2_NORM) {
-            return std::sqrt(G.parallelSumForNodes(sumL2Norm)) <= tol;
-        }
+    iterations = 0;
+    scoreData.assign(z, 0.0);
 
-        return G.parallelSumForNodes(sumL1Norm) <= tol;
-    });
-
-    bool isConverged = false;
-    do {
-        handler.assureRunning();
-        G.balancedParallelForNodes([&](const node u) {
-            pr[u] = 0.0;
-            G.forInEdgesOf(u, [&](const node u, const node v, const edgeweight w) {
-                // note: inconsistency in definition in Newman's book (Ch. 7) regarding directed
-                // graphs we follow the verbal description, which requires to sum over the incoming
-                // edges
-                pr[u] += scoreData[v] * w / deg[v];
-            });
-            pr[u] *= damp;
-            pr[u] += teleportProb;
+    if (strategy == Strategy::RESIDUAL_PUSH) {
+        // Solves pr = damp * P^T pr + (1 - damp) * teleport by pushing residuals: a node adds its
+        // residual to its score and distributes damp times of it to its out-neighbors. With all
+        // residuals below the threshold, the L1 error is at most n * threshold / (1 - damp).
+        const double threshold = (1.0 - damp) * tol / static_cast<double>(n);
+        // Snapshot of the graph in CSR format: pushes scan contiguous out-neighborhoods.
+        const CSRGraph csr(G);
+        std::vector<double> residual(z, 0.0);
+        std::vector<node> active;
+        G.forNodes([&](const node u) {
+            residual[u] = (1.0 - damp) * teleport[u];
+            if (residual[u] > threshold)
+                active.push_back(u);
         });
 
-        // For directed graphs sink-handling is needed to fulfill |pr| == 1 in each step. Otherwise
-        // probability mass would be leaked, creating wrong results. For this, we add edges from
-        // sinks to all other nodes. This is described amongst others in "PageRank revisited."
-        // by M. Brinkmeyer et al. (2005).
-        if (G.isDirected() && ((distributeSinks == SinkHandling::DISTRIBUTE_SINKS) || normalized)) {
-            double totalSinkContrib = 0.0;
-#pragma omp parallel for reduction(+ : totalSinkContrib)
-            for (omp_index i = 0; i < static_cast<omp_index>(nSinks); i++) {
-                totalSinkContrib += factor * scoreData[sinks[i]];
+        std::vector<std::vector<node>> activated(omp_get_max_threads());
+        auto addResidual = [&](const node v, const double value, std::vector<node> &next) {
+            double old;
+#pragma omp atomic capture
+            {
+                old = residual[v];
+                residual[v] += value;
+            }
+            if (old <= threshold && old + value > threshold)
+                next.push_back(v);
+        };
+
+        while (!active.empty() && iterations < maxIterations) {
+            handler.assureRunning();
+            double sinkMass = 0.0;
+
+#pragma omp parallel reduction(+ : sinkMass)
+            {
+                auto &next = activated[omp_get_thread_num()];
+                next.clear();
+#pragma omp for schedule(guided) nowait
+                for (omp_index i = 0; i < static_cast<omp_index>(active.size()); ++i) {
+                    const node u = active[i];
+                    double r;
+#pragma omp atomic capture
+                    {
+                        r = residual[u];
+                        residual[u] = 0.0;
+                    }
+                    if (r <= 0.0)
+                        continue;
+                    // u may be activated twice within one round
+#pragma omp atomic
+                    scoreData[u] += r;
+
+                    if (deg[u] == 0.0) {
+                        if (handleSinks)
+                            sinkMass += damp * r;
+                        continue;
+                    }
+                    const double share = damp * r / deg[u];
+                    const auto neighbors = csr.neighborRange(u);
+                    if (G.isWeighted()) {
+                        const auto weights = csr.neighborWeightRange(u);
+                        for (index j = 0; j < neighbors.size(); ++j)
+                            addResidual(neighbors[j], share * weights[j], next);
+                    } else {
+                        for (const node v : neighbors)
+                            addResidual(v, share, next);
+                    }
+                }
             }
-            G.balancedParallelForNodes([&](const node u) { pr[u] += totalSinkContrib; });
+
+            // The walks leaving sinks continue according to the teleport distribution.
+            if (sinkMass > 0.0) {
+#pragma omp parallel
+                {
+                    auto &next = activated[omp_get_thread_num()];
+#pragma omp for schedule(static) nowait
+                    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+                        if (teleport[u] > 0.0)
+                            addResidual(u, sinkMass * teleport[u], next);
+                    }
+                }
+            }
+
+            active.clear();
+            for (const auto &next : activated)
+                active.insert(active.end(), next.begin(), next.end());
+            ++iterations;
         }
+    } else if (strategy == Strategy::GAUSS_SEIDEL) {
+        // The scores divided by the degrees are updated in place; concurrent threads read them
+        // with relaxed atomic loads. The in-neighborhoods are pulled from a CSR snapshot.
+        const CSRGraph csr(G);
+        G.parallelForNodes([&](const node u) { scoreData[u] = teleport[u]; });
+        std::vector<double> contrib(z, 0.0);
+        G.parallelForNodes([&](const node u) {
+            if (deg[u] > 0.0)
+                contrib[u] = scoreData[u] / deg[u];
+        });
+        auto contribution = [&](const node v) {
+            return std::atomic_ref<double>(contrib[v]).load(std::memory_order_relaxed);
+        };
+
+        bool isConverged = false;
+        do {
+            handler.assureRunning();
+            const double totalSinkContrib = sinkContribution();
+            double residual = 0.0;
+#pragma omp parallel for schedule(guided) reduction(+ : residual)
+            for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+                if (!G.hasNode(u))
+                    continue;
+                const double value = damp * pullContributionsCSR(csr, u, contribution)
+                                     + (1.0 - damp + totalSinkContrib) * teleport[u];
+                addToNorm(residual, value - scoreData[u]);
+                scoreData[u] = value;
+                if (deg[u] > 0.0)
+                    std::atomic_ref<double>(contrib[u]).store(value / deg[u],
+                                                              std::memory_order_relaxed);
+            }
+
+            ++iterations;
+            isConverged = converged(residual);
+        } while (!isConverged);
+    } else {
+        G.parallelForNodes([&](const node u) { scoreData[u] = teleport[u]; });
+        std::vector<double> pr(z, 0.0);
+        std::vector<double> contrib(z, 0.0);
+        auto contribution = [&](const node v) { return contrib[v]; };
 
-        ++iterations;
-        isConverged = converged();
-        std::swap(pr, scoreData);
-    } while (!isConverged);
+        bool isConverged = false;
+        do {
+            handler.assureRunning();
+            G.parallelForNodes([&](const node u) {
+                contrib[u] = deg[u] > 0.0 ? scoreData[u] / deg[u] : 0.0;
+            });
+            const double totalSinkContrib = sinkContribution();
+
+            // Sparse matrix-vector product, fused with the computation of the residual
+            double residual = 0.0;
+#pragma omp parallel for schedule(guided) reduction(+ : residual)
+            for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+                if (!G.hasNode(u))
+                    continue;
+                pr[u] = damp * pullContributions(u, contribution)
+                        + (1.0 - damp + totalSinkContrib) * teleport[u];
+                addToNorm(residual, pr[u] - scoreData[u]);
+            }
+
+            ++iterations;
+            isConverged = converged(residual);
+            std::swap(pr, scoreData);
+        } while (!isConverged);
+    }
 
     handler.assureRunning();
 
@@ -109,7 +283,7 @@ void PageRank::run() {
             }
             normFactor = (1.0 / static_cast<double>(n)) * ((1.0 - damp) + (damp * sum));
         } else {
-            normFactor = teleportProb;
+            normFactor = (1.0 - damp) / static_cast<double>(n);
         }
         G.parallelForNodes([&](const node u) { scoreData[u] /= normFactor; });
 
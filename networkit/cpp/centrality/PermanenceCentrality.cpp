@@ -48,7 +48,7 @@ void NetworKit::PermanenceCentrality::run() {
         handler.assureRunning();
 
         // count in-degrees
-        std::vector<count> inDeg(G.upperNodeIdBound() + 1);
+        std::vector<index> inDeg(G.upperNodeIdBound() + 1);
 
         G.forEdges([&](node u, node v) {
             if (isOutEdge(u, v)) {
@@ -5,8 +5,8 @@
  *      Author: ebergamini, michele borassi
  */
 
+#include <atomic>
 #include <omp.h>
-#include <queue>
 #include <stack>
 
 #include <networkit/auxiliary/Log.hpp>
@@ -71,7 +71,7 @@ void TopCloseness::computelBound1(std::vector<double> &S) {
     std::vector<count> neighbors_new(n, 0);
     std::vector<count> neighbors_old(n, 0);
     std::vector<double> sumDist(n, 0);
-    std::vector<bool> finished(n, false);
+    std::vector<uint8_t> finished(n, false);
 
     count n_finished = 0;
 
@@ -91,9 +91,14 @@ void TopCloseness::computelBound1(std::vector<double> &S) {
     auto &reachL = *reachLPtr, &reachU = *reachUPtr;
     while (n_finished < n) {
         DEBUG("First bound. Finished: ", n_finished, " of ", n, ".");
-        G.forNodes([&](node u) {
-            if (!finished[u]) {
-                n_op += G.degreeOut(u);
+        // The bounds of all nodes are advanced by one level in parallel; each node only writes
+        // its own entries and reads the counts of its neighbors from the previous level.
+        count levelOps = 0;
+#pragma omp parallel for schedule(guided) reduction(+ : n_finished, levelOps)
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            const node u = static_cast<node>(i);
+            if (G.hasNode(u) && !finished[u]) {
+                levelOps += G.degreeOut(u);
                 neighbors_new[u] = 0;
                 G.forNeighborsOf(u, [&](node v) { neighbors_new[u] += neighbors[v]; });
                 if (!G.isDirected()) {
@@ -146,8 +151,9 @@ void TopCloseness::computelBound1(std::vector<double> &S) {
                     }
                 }
             }
-        });
-        G.forNodes([&](node u) {
+        }
+        n_op += levelOps;
+        G.parallelForNodes([&](node u) {
             // We update neighbors.
             neighbors_old[u] = neighbors[u];
             neighbors[u] = neighbors_new[u];
@@ -233,38 +239,42 @@ void TopCloseness::BFSbound(node x, std::vector<double> &S2, count &visEdges,
     }
 }
 
-double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
+double TopCloseness::BFScut(node v, const std::atomic<double> &kth, std::vector<bool> &visited,
                             std::vector<count> &distances, std::vector<node> &pred,
-                            count &visEdges) {
+                            std::vector<node> &queue, count &visEdges) {
     count d = 0, f = 0, nd = 1;
     const double rL = (*reachLPtr)[v], rU = (*reachUPtr)[v];
-    std::queue<node> Q1;
-    std::queue<node> to_reset;
     count sum_dist = 0;
     double ftildeL = 0, ftildeU = 0, gamma = G.degreeOut(v);
     double farnessV = 0;
+    // Other threads may lower kth during the BFS; the latest value is loaded at each level.
+    double x = kth.load(std::memory_order_relaxed);
 
     // MICHELE: variable visited is not local, otherwise the allocation would be
     // too expensive.
     visited[v] = true;
     distances[v] = 0;
-    Q1.push(v);
-    to_reset.push(v);
+    // The queue also contains all visited nodes, which have to be reset at the end.
+    queue.clear();
+    queue.push_back(v);
+    index head = 0;
 
     do {
-        node u = Q1.front();
-        Q1.pop();
+        node u = queue[head++];
 
         sum_dist += distances[u];
         if (distances[u] > d) { // Need to update bounds!
             d++;
+            x = kth.load(std::memory_order_relaxed);
             double f1 = f + static_cast<double>(d + 2) * static_cast<double>(rL - nd) - gamma;
             double f2 = static_cast<double>(n - 1) / (rL - 1.0) / (rL - 1.0);
             ftildeL = f1 * f2;
             f1 = f + static_cast<double>(d + 2) * static_cast<double>(rU - nd) - gamma;
             f2 = static_cast<double>(n - 1) / (rU - 1.0) / (rU - 1.0);
             ftildeU = f1 * f2;
-            if (std::min(ftildeL, ftildeU) >= x) {
+            // A bound equal to x does not exclude a tie with the k-th node, which run() would
+            // then accept with the bound instead of the exact farness.
+            if (std::min(ftildeL, ftildeU) > x) {
                 farnessV = std::min(ftildeL, ftildeU);
                 break;
             }
@@ -276,8 +286,7 @@ double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
                 ++visEdges;
                 if (!visited[w]) {
                     distances[w] = distances[u] + 1;
-                    Q1.push(w);
-                    to_reset.push(w);
+                    queue.push_back(w);
                     visited[w] = true;
                     f += distances[w];
                     if (!G.isDirected())
@@ -302,16 +311,13 @@ double TopCloseness::BFScut(node v, double x, std::vector<bool> &visited,
             farnessV = std::min(ftildeL, ftildeU);
             break;
         }
-    } while (!Q1.empty());
+    } while (head < queue.size());
 
-    do {
-        // MICHELE: need to reset variable visited.
-        // Variables pred and distances
-        // do not need to be updated.
-        node u = to_reset.front();
-        to_reset.pop();
+    // MICHELE: need to reset variable visited.
+    // Variables pred and distances
+    // do not need to be updated.
+    for (const node u : queue)
         visited[u] = false;
-    } while (!to_reset.empty());
     if (farnessV < x) {
         farnessV = static_cast<double>(sum_dist * (n - 1)) / static_cast<double>(nd - 1.0)
                    / static_cast<double>(nd - 1.0);
@@ -355,12 +361,13 @@ void TopCloseness::run() {
 
     std::vector<std::vector<bool>> visitedVec;
     std::vector<std::vector<count>> distVec;
-    std::vector<std::vector<node>> predVec;
+    std::vector<std::vector<node>> predVec, queueVec;
 
     if (!sec_heu) {
         visitedVec.resize(omp_get_max_threads(), std::vector<bool>(n));
         distVec.resize(omp_get_max_threads(), std::vector<count>(n));
         predVec.resize(omp_get_max_threads(), std::vector<node>(n));
+        queueVec.resize(omp_get_max_threads());
     }
 
     // Disable analyzing nodes, which are not part of the nodeList (if given).
@@ -374,9 +381,10 @@ void TopCloseness::run() {
         }
     }
 
-    double kth = std::numeric_limits<double>::max(); // like in Crescenzi
-#pragma omp parallel                                 // Shared variables:
-    // cc: synchronized write, read leads to a positive race condition;
+    // like in Crescenzi; written under the lock, read without it
+    std::atomic<double> kth{std::numeric_limits<double>::max()};
+#pragma omp parallel // Shared variables:
+    // kth: synchronized write, lock-free read;
     // Q: fully synchronized;
     // top: fully synchronized;
     // toAnalyze: fully synchronized;
@@ -399,7 +407,7 @@ void TopCloseness::run() {
             toAnalyze[s] = false;
             omp_unset_lock(&lock);
 
-            if (G.degreeOut(s) == 0 || farness[s] > kth) {
+            if (G.degreeOut(s) == 0 || farness[s] > kth.load(std::memory_order_relaxed)) {
                 break;
             }
             DEBUG("Iteration ", ++iters, " of thread ", omp_get_thread_num());
@@ -436,12 +444,15 @@ void TopCloseness::run() {
                 tlx::unused(imp);
             } else {
                 // MICHELE: we use BFScut to bound the centrality of s.
-                DEBUG("    Running BFScut with x=", kth, " (degree:", G.degreeOut(s), ").");
+                DEBUG("    Running BFScut with x=", kth.load(std::memory_order_relaxed),
+                      " (degree:", G.degreeOut(s), ").");
+                // BFScut resets the visited nodes itself
                 auto &visited = visitedVec[omp_get_thread_num()];
-                std::fill(visited.begin(), visited.end(), false);
                 auto &distances = distVec[omp_get_thread_num()];
                 auto &pred = predVec[omp_get_thread_num()];
-                const double farnessS = BFScut(s, kth, visited, distances, pred, visEdges);
+                auto &queue = queueVec[omp_get_thread_num()];
+                const double farnessS =
+                    BFScut(s, kth, visited, distances, pred, queue, visEdges);
                 DEBUG("    Visited edges: ", visEdges, ".");
                 omp_set_lock(&lock);
                 farness[s] = farnessS;
@@ -450,12 +461,12 @@ void TopCloseness::run() {
 
             // If necessary, we update kth.
             omp_set_lock(&lock);
-            if (farness[s] <= kth) {
+            if (farness[s] <= kth.load(std::memory_order_relaxed)) {
                 DEBUG("    The closeness of s is ", 1.0 / farness[s], ".");
                 top.push(s);
                 if (top.size() > k) {
                     ++trail;
-                    if (farness[s] < kth) {
+                    if (farness[s] < kth.load(std::memory_order_relaxed)) {
                         if (nMaxFarness == trail) {
                             // Purging trail
                             do {
@@ -496,9 +507,9 @@ void TopCloseness::run() {
 
             // We load the new value of kth.
             if (top.size() >= k) {
-                kth = farness[top.top()];
+                kth.store(farness[top.top()], std::memory_order_relaxed);
                 if (nMaxFarness == 1) {
-                    maxFarness = kth;
+                    maxFarness = farness[top.top()];
                 }
             }
             omp_unset_lock(&lock);
@@ -57,7 +57,10 @@ void TopHarmonicCloseness::init() {
 
     if (!useNBbound && G->isWeighted()) {
         distanceGlobal.clear();
-        distanceGlobal.resize(omp_get_max_threads(), std::vector<edgeweight>(n));
+        distanceGlobal.resize(omp_get_max_threads(),
+                              std::vector<edgeweight>(n, std::numeric_limits<edgeweight>::max()));
+        reachedGlobal.clear();
+        reachedGlobal.resize(omp_get_max_threads());
         dijkstraHeaps.clear();
         dijkstraHeaps.reserve(omp_get_max_threads());
         for (int i = 0; i < omp_get_max_threads(); ++i)
@@ -137,9 +140,7 @@ void TopHarmonicCloseness::runNBcut() {
         omp_set_lock(&lock);
         if (!prioQ.empty()) {
             u = prioQ.extract_top();
-            if (topKNodesPQ.size() == k)
-                kthCloseness.store(hCloseness[topKNodesPQ.top()], std::memory_order_relaxed);
-            if (hCloseness[u] < kthCloseness) {
+            if (hCloseness[u] < kthCloseness.load(std::memory_order_relaxed)) {
                 stop.store(true, std::memory_order_relaxed);
                 u = none;
             }
@@ -151,15 +152,18 @@ void TopHarmonicCloseness::runNBcut() {
             break;
 
         if (G->isWeighted()) {
-            if (!bfscutWeighted(u, kthCloseness.load(std::memory_order_relaxed)))
+            if (!bfscutWeighted(u, kthCloseness))
                 continue;
         } else {
-            if (!bfscutUnweighted(u, kthCloseness.load(std::memory_order_relaxed)))
+            if (!bfscutUnweighted(u, kthCloseness))
                 continue;
         }
 
+        // Publish the new k-th closeness right away, so that running searches can use it.
         omp_set_lock(&lock);
         updateTopkPQ(u);
+        if (topKNodesPQ.size() == k)
+            kthCloseness.store(hCloseness[topKNodesPQ.top()], std::memory_order_relaxed);
         omp_unset_lock(&lock);
     }
 }
@@ -168,7 +172,7 @@ void TopHarmonicCloseness::runNBbound() {
     numberOfNodesAtLevelGlobal.resize(omp_get_max_threads(),
                                       std::vector<count>(G->numberOfNodes(), 0));
     nodesAtLevelGlobal.resize(omp_get_max_threads(),
-                              std::vector<std::vector<count>>(G->numberOfNodes()));
+                              std::vector<std::vector<node>>(G->numberOfNodes()));
     nodesAtCurrentLevelGlobal.resize(omp_get_max_threads());
 
     for (int i = 0; i < omp_get_max_threads(); ++i)
@@ -233,7 +237,8 @@ void TopHarmonicCloseness::updateTopkPQ(node u) {
         trail.clear();
 }
 
-bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
+bool TopHarmonicCloseness::bfscutUnweighted(node source,
+                                            const std::atomic<double> &kthCloseness) {
     const count reachableFromSource = reachableNodes[source];
     const count undirected = !G->isDirected();
     updateTimestamp();
@@ -281,7 +286,7 @@ bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
 #endif
 
         // Prune BFS
-        if (htilde < kthCloseness) {
+        if (htilde < kthCloseness.load(std::memory_order_relaxed)) {
             hCloseness[source] = htilde;
             return false;
         }
@@ -294,16 +299,26 @@ bool TopHarmonicCloseness::bfscutUnweighted(node source, double kthCloseness) {
     return true;
 }
 
-bool TopHarmonicCloseness::bfscutWeighted(node source, double kthCloseness) {
+bool TopHarmonicCloseness::bfscutWeighted(node source,
+                                          const std::atomic<double> &kthCloseness) {
     auto &distance = distanceGlobal[omp_get_thread_num()];
-    std::ranges::fill(distance, std::numeric_limits<edgeweight>::max());
+    auto &reached = reachedGlobal[omp_get_thread_num()];
     distance[source] = 0;
+    reached.assign(1, source);
     auto &pq = dijkstraHeaps[omp_get_thread_num()];
     pq.clear();
     const count reachableFromSource = reachableNodes[source];
 
+    // Only the distances set by this search are reset, instead of all n of them.
+    const auto resetDistances = [&]() -> void {
+        for (const node u : reached)
+            distance[u] = std::numeric_limits<edgeweight>::max();
+    };
+
     // Visit the source immediately so we can avoid 'if (u != source) ... ' in the while loop below
     G->forNeighborsOf(source, [&](node v, edgeweight ew) {
+        if (distance[v] == std::numeric_limits<edgeweight>::max())
+            reached.push_back(v);
         distance[v] = ew;
         pq.update(v);
     });
@@ -325,19 +340,23 @@ bool TopHarmonicCloseness::bfscutWeighted(node source, double kthCloseness) {
         htilde = h + static_cast<double>(reachableFromSource - visitedNodes) / distU;
 
         // Prune SSSP
-        if (htilde < kthCloseness) {
+        if (htilde < kthCloseness.load(std::memory_order_relaxed)) {
             hCloseness[source] = htilde;
+            resetDistances();
             return false;
         }
 
         G->forNeighborsOf(u, [&](node v, edgeweight ew) {
             const double newDistV = distU + ew;
             if (newDistV < distance[v]) {
+                if (distance[v] == std::numeric_limits<edgeweight>::max())
+                    reached.push_back(v);
                 distance[v] = newDistV;
                 pq.update(v);
             }
         });
     }
+    resetDistances();
 
 #ifndef NDEBUG
     if (G->isDirected())
@@ -498,7 +517,7 @@ void TopHarmonicCloseness::computeNeighborhoodBasedBound() {
     std::vector<count> nodesAtKminusOne(n);
     std::vector<count> nodesAtKminusTwo(n);
     std::vector<count> visited(n);
-    std::vector<bool> finished(n);
+    std::vector<uint8_t> finished(n);
     std::vector<double> sumHCloseness(n);
 
     count nFinished = 0;
@@ -521,9 +540,13 @@ void TopHarmonicCloseness::computeNeighborhoodBasedBound() {
 
     count level = 2;
     while (nFinished < G->numberOfNodes()) {
-        G->forNodes([&](const node u) {
-            if (finished[u])
-                return;
+        // All nodes advance their bound by one level in parallel; each node only writes its own
+        // entries and reads the counts of its neighbors from the previous level.
+#pragma omp parallel for schedule(guided) reduction(+ : nFinished)
+        for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+            const node u = static_cast<node>(i);
+            if (!G->hasNode(u) || finished[u])
+                continue;
 
             nodesAtK[u] = 0;
             G->forNeighborsOf(u, [&](node v) { nodesAtK[u] += nodesAtKminusOne[v]; });
@@ -579,7 +602,7 @@ void TopHarmonicCloseness::computeNeighborhoodBasedBound() {
                 finished[u] = true;
                 ++nFinished;
             }
-        });
+        }
 
         G->parallelForNodes([&](node u) {
             nodesAtKminusTwo[u] = nodesAtKminusOne[u];
@@ -5,8 +5,11 @@
  *      Author: cls
  */
 
+#include <cstdio>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <omp.h>
 #include <random>
 
 #include <gtest/gtest.h>
@@ -24,11 +27,14 @@
 #include <networkit/centrality/CoreDecomposition.hpp>
 #include <networkit/centrality/DegreeCentrality.hpp>
 #include <networkit/centrality/DynApproxBetweenness.hpp>
+#include <networkit/centrality/DynCoreDecomposition.hpp>
 #include <networkit/centrality/DynKatzCentrality.hpp>
+#include <networkit/centrality/DynPageRank.hpp>
 #include <networkit/centrality/DynTopHarmonicCloseness.hpp>
 #include <networkit/centrality/EigenvectorCentrality.hpp>
 #include <networkit/centrality/EstimateBetweenness.hpp>
 #include <networkit/centrality/ForestCentrality.hpp>
+#include <networkit/centrality/FrontierParallelBrandes.hpp>
 #include <networkit/centrality/GedWalk.hpp>
 #include <networkit/centrality/GroupCloseness.hpp>
 #include <networkit/centrality/GroupClosenessGrowShrink.hpp>
@@ -147,6 +153,202 @@ TEST_F(CentralityGTest, testBetweenness2Centrality) {
     EXPECT_NEAR(1.0, bc[5], tol);
 }
 
+TEST_F(CentralityGTest, testBetweennessManyShortestPaths) {
+    // Chain of k diamonds, the junctions are the nodes 3i, the middle nodes of the i-th diamond
+    // are 3i + 1 and 3i + 2. There are 2^k shortest paths between the ends of the chain, which
+    // exceeds the range of double for k = 1100.
+    for (count k : {4, 1100}) {
+        Graph G(3 * k + 1);
+        for (node left = 0; left < 3 * k; left += 3) {
+            G.addEdge(left, left + 1);
+            G.addEdge(left, left + 2);
+            G.addEdge(left + 1, left + 3);
+            G.addEdge(left + 2, left + 3);
+        }
+
+        Betweenness centrality(G);
+        centrality.run();
+        const auto &bc = centrality.scores();
+
+        for (index i = 0; i < k; ++i) {
+            if (i > 0)
+                EXPECT_NEAR(bc[3 * i], 18. * i * (k - i) + 2., 1e-6 * bc[3 * i]);
+            const double middle = (3. * i + 1.) * (3. * (k - i) - 2.);
+            EXPECT_NEAR(bc[3 * i + 1], middle, 1e-6 * middle);
+            EXPECT_NEAR(bc[3 * i + 2], middle, 1e-6 * middle);
+        }
+    }
+}
+
+TEST_P(CentralityGTest, testBetweennessBatchedSources) {
+    // Unweighted graphs are processed in batches of sources, unit weights with one SSSP per source.
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.02, isDirected()).generate();
+    G.removeNode(GraphTools::randomNode(G));
+    G.indexEdges();
+    const Graph unitWeights = GraphTools::toWeighted(G);
+
+    for (const bool normalized : {false, true}) {
+        Betweenness batched(G, normalized, true);
+        batched.run();
+        Betweenness reference(unitWeights, normalized, true);
+        reference.run();
+
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(batched.score(u), reference.score(u), 1e-9 * (1 + reference.score(u)));
+        });
+        const auto &edgeScores = batched.edgeScores();
+        const auto &referenceEdgeScores = reference.edgeScores();
+        G.forEdges([&](node, node, edgeid eid) {
+            EXPECT_NEAR(edgeScores[eid], referenceEdgeScores[eid],
+                        1e-9 * (1 + referenceEdgeScores[eid]));
+        });
+    }
+}
+
+TEST_P(CentralityGTest, testBetweennessCSRGraph) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.03, isDirected()).generate();
+    G.removeNode(GraphTools::randomNode(G));
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        GraphTools::randomizeWeights(G);
+    }
+    G.indexEdges();
+
+    auto check = [&](bool normalized) {
+        const CSRGraph csr = G.freeze();
+        Betweenness snapshot(csr, normalized, true);
+        snapshot.run();
+        Betweenness reference(G, normalized, true);
+        reference.run();
+
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(snapshot.score(u), reference.score(u), 1e-9 * (1 + reference.score(u)));
+        });
+        const auto &edgeScores = snapshot.edgeScores();
+        const auto &referenceEdgeScores = reference.edgeScores();
+        G.forEdges([&](node, node, edgeid eid) {
+            EXPECT_NEAR(edgeScores[eid], referenceEdgeScores[eid],
+                        1e-9 * (1 + referenceEdgeScores[eid]));
+        });
+        EXPECT_EQ(snapshot.ranking().size(), G.numberOfNodes());
+        EXPECT_DOUBLE_EQ(snapshot.maximum(), reference.maximum());
+    };
+
+    check(false);
+    check(true);
+
+    // Non-positive edge weights fall back to the SSSP classes, which run on a converted graph.
+    if (isWeighted()) {
+        const auto [u, v] = GraphTools::randomEdge(G);
+        G.setWeight(u, v, 0);
+        check(false);
+    }
+}
+
+TEST_P(CentralityGTest, testBetweennessBatchMemory) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.03, isDirected()).generate();
+    G.indexEdges();
+
+    Betweenness reference(G, false, true);
+    reference.run();
+
+    // Batches of three sources, and one search per source if batches would be smaller than two
+    const count bytesPerSource = 2 * sizeof(double) * omp_get_max_threads() * G.upperNodeIdBound();
+    for (const count maxBatchMemory : {3 * bytesPerSource, 2 * bytesPerSource - 1, count{0}}) {
+        Betweenness bc(G, false, true);
+        bc.maxBatchMemory = maxBatchMemory;
+        bc.run();
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(bc.score(u), reference.score(u), 1e-9 * (1 + reference.score(u)));
+        });
+        const auto edgeScores = bc.edgeScores();
+        const auto referenceEdgeScores = reference.edgeScores();
+        G.forEdges([&](node, node, edgeid eid) {
+            EXPECT_NEAR(edgeScores[eid], referenceEdgeScores[eid],
+                        1e-9 * (1 + referenceEdgeScores[eid]));
+        });
+    }
+}
+
+TEST_P(CentralityGTest, testBetweennessSourceShards) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.03, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        GraphTools::randomizeWeights(G);
+    }
+    G.indexEdges();
+
+    Betweenness reference(G, true, true);
+    reference.run();
+
+    const count numberOfShards = 3;
+    std::vector<std::string> paths;
+    for (index shard = 0; shard < numberOfShards; ++shard) {
+        Betweenness partial(G, true, true);
+        partial.setSourceShard(shard, numberOfShards);
+        partial.run();
+        paths.push_back("output/betweenness_shard" + std::to_string(shard) + ".bin");
+        partial.writePartialScores(paths.back());
+    }
+
+    const auto [scores, edgeScores] = Betweenness::mergePartialScores(paths);
+    const auto referenceScores = reference.scores();
+    const auto referenceEdgeScores = reference.edgeScores();
+    ASSERT_EQ(scores.size(), referenceScores.size());
+    ASSERT_EQ(edgeScores.size(), referenceEdgeScores.size());
+    G.forNodes([&](node u) { EXPECT_NEAR(scores[u], referenceScores[u], 1e-12); });
+    G.forEdges([&](node, node, edgeid eid) {
+        EXPECT_NEAR(edgeScores[eid], referenceEdgeScores[eid], 1e-12);
+    });
+
+    EXPECT_THROW(Betweenness::mergePartialScores({paths[0], paths[1]}), std::runtime_error);
+    EXPECT_THROW(Betweenness::mergePartialScores({paths[0], paths[1], paths[1]}),
+                 std::runtime_error);
+    for (const auto &path : paths)
+        std::remove(path.c_str());
+}
+
+TEST_P(CentralityGTest, testFrontierParallelBrandes) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(200, 0.03, isDirected()).generate();
+    G.removeNode(GraphTools::randomNode(G));
+
+    Betweenness reference(G);
+    reference.run();
+
+    std::vector<double> scores(G.upperNodeIdBound());
+    FrontierParallelBrandes brandes(G);
+    G.forNodes([&](node s) {
+        EXPECT_TRUE(brandes.run(s));
+        EXPECT_EQ(brandes.distance(s), 0);
+        EXPECT_EQ(brandes.numberOfPaths(s), 1.);
+        brandes.parallelForReachedNodes([&](node t, double dependency) {
+            if (t != s)
+                scores[t] += dependency;
+        });
+    });
+
+    G.forNodes([&](node u) { EXPECT_NEAR(scores[u], reference.score(u), 1e-9); });
+}
+
+TEST_F(CentralityGTest, testEstimateBetweennessFewSamples) {
+    const Graph G = ErdosRenyiGenerator(300, 0.02, false).generate();
+    const count samples = 3;
+
+    Aux::Random::setSeed(42, false);
+    EstimateBetweenness sequential(G, samples, true, false);
+    sequential.run();
+    Aux::Random::setSeed(42, false);
+    EstimateBetweenness parallel(G, samples, true, true);
+    parallel.run();
+
+    G.forNodes([&](node u) { EXPECT_NEAR(sequential.score(u), parallel.score(u), 1e-12); });
+}
+
 TEST_F(CentralityGTest, runApproxBetweennessSmallGraph) {
     /* Graph:
      0    3
@@ -518,6 +720,146 @@ TEST_P(CentralityGTest, testPageRank) {
     doTest(PageRank::Norm::L2_NORM);
 }
 
+TEST_P(CentralityGTest, testPageRankStrategies) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.02, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        GraphTools::randomizeWeights(G);
+    }
+    G.removeNode(GraphTools::randomNode(G));
+
+    for (const auto sinks :
+         {PageRank::SinkHandling::NO_SINK_HANDLING, PageRank::SinkHandling::DISTRIBUTE_SINKS}) {
+        for (const bool normalized : {false, true}) {
+            PageRank reference(G, 0.85, 1e-13, normalized, sinks);
+            reference.norm = PageRank::Norm::L1_NORM;
+            reference.run();
+
+            for (const auto strategy :
+                 {PageRank::Strategy::GAUSS_SEIDEL, PageRank::Strategy::RESIDUAL_PUSH}) {
+                PageRank pr(G, 0.85, 1e-10, normalized, sinks);
+                pr.strategy = strategy;
+                pr.run();
+                const double tol = normalized ? 1e-6 : 1e-9;
+                G.forNodes([&](node u) { EXPECT_NEAR(pr.score(u), reference.score(u), tol); });
+            }
+        }
+    }
+}
+
+TEST_P(CentralityGTest, testPersonalizedPageRank) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(50, 0.1, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        GraphTools::randomizeWeights(G);
+    }
+    const double damp = 0.85;
+    std::vector<double> personalization(G.upperNodeIdBound(), 0.0);
+    personalization[3] = 2.0;
+    personalization[7] = 1.0;
+
+    // Reference: the plain iteration of pr = damp * P^T pr + (1 - damp) * p, with the walks
+    // leaving sinks continuing according to p.
+    std::vector<double> reference(G.upperNodeIdBound(), 0.0), next;
+    for (count i = 0; i < 500; ++i) {
+        next.assign(G.upperNodeIdBound(), 0.0);
+        double sinkMass = 0;
+        G.forNodes([&](node u) {
+            const double deg = G.weightedDegree(u);
+            if (deg == 0)
+                sinkMass += reference[u];
+            G.forNeighborsOf(u, [&](node v, edgeweight ew) {
+                next[v] += damp * reference[u] * ew / deg;
+            });
+        });
+        const double jump = 1 - damp + (G.isDirected() ? damp * sinkMass : 0);
+        G.forNodes([&](node u) { next[u] += jump * personalization[u] / 3; });
+        reference.swap(next);
+    }
+    const double sum = std::accumulate(reference.begin(), reference.end(), 0.0);
+
+    for (const auto strategy :
+         {PageRank::Strategy::POWER_ITERATION, PageRank::Strategy::GAUSS_SEIDEL,
+          PageRank::Strategy::RESIDUAL_PUSH}) {
+        PageRank pr(G, damp, 1e-12, false, PageRank::SinkHandling::DISTRIBUTE_SINKS);
+        pr.setPersonalization(personalization);
+        pr.strategy = strategy;
+        pr.run();
+        G.forNodes([&](node u) { EXPECT_NEAR(pr.score(u), reference[u] / sum, 1e-9); });
+    }
+
+    PageRank pr(G);
+    EXPECT_THROW(pr.setPersonalization({-1.0}), std::runtime_error);
+    pr.setPersonalization(std::vector<double>(G.upperNodeIdBound() - 1, 1.0));
+    EXPECT_THROW(pr.run(), std::runtime_error);
+}
+
+TEST_P(CentralityGTest, testDynPageRank) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.05, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        GraphTools::randomizeWeights(G);
+    }
+    const double damp = 0.85, tol = 1e-10;
+
+    auto expectSameScores = [&](DynPageRank &dynPr) {
+        PageRank pr(G, damp, 1e-14);
+        pr.run();
+        G.forNodes([&](node u) { EXPECT_NEAR(dynPr.score(u), pr.score(u), 1e-9); });
+    };
+
+    DynPageRank dynPr(G, damp, tol);
+    dynPr.run();
+    expectSameScores(dynPr);
+    const count runPushes = dynPr.numberOfPushes();
+
+    std::vector<GraphEvent> batch;
+    for (count i = 0; i < 3; ++i) {
+        const auto [u, v] = GraphTools::randomEdge(G);
+        batch.emplace_back(GraphEvent::EDGE_REMOVAL, u, v, G.weight(u, v));
+        G.removeEdge(u, v);
+    }
+    for (count i = 0; i < 3; ++i) {
+        node u, v;
+        do {
+            u = GraphTools::randomNode(G);
+            v = GraphTools::randomNode(G);
+        } while (u == v || G.hasEdge(u, v));
+        const edgeweight w = isWeighted() ? Aux::Random::real() : defaultEdgeWeight;
+        batch.emplace_back(GraphEvent::EDGE_ADDITION, u, v, w);
+        G.addEdge(u, v, w);
+    }
+    if (isWeighted()) {
+        const auto [u, v] = GraphTools::randomEdge(G);
+        batch.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, u, v, 0.5);
+        G.increaseWeight(u, v, 0.5);
+    }
+
+    dynPr.updateBatch(batch);
+    expectSameScores(dynPr);
+    EXPECT_LT(dynPr.numberOfPushes(), runPushes);
+
+    // A new node together with its edges, and an isolated new node
+    batch.clear();
+    const node x = G.addNode();
+    batch.emplace_back(GraphEvent::NODE_ADDITION, x);
+    for (const node v : {node{0}, node{42}, node{299}}) {
+        batch.emplace_back(GraphEvent::EDGE_ADDITION, x, v, defaultEdgeWeight);
+        G.addEdge(x, v);
+    }
+    batch.emplace_back(GraphEvent::EDGE_ADDITION, 7, x, defaultEdgeWeight);
+    G.addEdge(7, x);
+    batch.emplace_back(GraphEvent::NODE_ADDITION, G.addNode());
+    dynPr.updateBatch(batch);
+    expectSameScores(dynPr);
+
+    // Removing a node is not supported
+    EXPECT_THROW(dynPr.update(GraphEvent(GraphEvent::NODE_REMOVAL, 0)), std::runtime_error);
+}
+
 TEST_P(CentralityGTest, testNormalizedPageRank) {
     /* Graph:
      0 <---> 1
@@ -605,6 +947,60 @@ TEST_F(CentralityGTest, testEigenvectorCentrality) {
     EXPECT_NEAR(0.1503, std::fabs(cen[7]), tol);
 }
 
+TEST_F(CentralityGTest, testEigenvectorCentralityLanczos) {
+    const auto G = METISGraphReader{}.read("input/PGPgiantcompo.graph");
+
+    EigenvectorCentrality power(G, 1e-10);
+    power.run();
+    EigenvectorCentrality lanczos(G, 1e-10);
+    lanczos.strategy = EigenvectorCentrality::Strategy::LANCZOS;
+    lanczos.run();
+
+    // Residual ||Ax - (x^T A x) x|| of a unit vector x
+    auto residual = [&](const std::vector<double> &x) {
+        std::vector<double> y(G.upperNodeIdBound(), 0.0);
+        G.forNodes([&](node u) {
+            G.forNeighborsOf(u, [&](node, node v, edgeweight ew) { y[u] += ew * x[v]; });
+        });
+        const double lambda = G.parallelSumForNodes([&](node u) { return x[u] * y[u]; });
+        return std::sqrt(G.parallelSumForNodes(
+            [&](node u) { return (y[u] - lambda * x[u]) * (y[u] - lambda * x[u]); }));
+    };
+    // The power iteration stops when the eigenvalue estimate stagnates, so its vector is less
+    // accurate on this graph with a small spectral gap.
+    EXPECT_LE(residual(lanczos.scores()), 1e-8);
+    EXPECT_LE(residual(lanczos.scores()), residual(power.scores()));
+
+    const auto &expected = power.scores();
+    const auto &scores = lanczos.scores();
+    G.forNodes([&](node u) {
+        EXPECT_NEAR(scores[u], expected[u], 1e-4);
+        EXPECT_GE(scores[u], -1e-9);
+    });
+
+    Graph D(3, false, true);
+    D.addEdge(0, 1);
+    EigenvectorCentrality directed(D);
+    directed.strategy = EigenvectorCentrality::Strategy::LANCZOS;
+    EXPECT_THROW(directed.run(), std::runtime_error);
+}
+
+TEST_F(CentralityGTest, testKatzCentralityConjugateGradient) {
+    auto G = METISGraphReader{}.read("input/PGPgiantcompo.graph");
+    G.removeNode(0);
+
+    KatzCentrality power(G, 0, 0.1, 1e-12);
+    power.run();
+    KatzCentrality cg(G, 0, 0.1, 1e-12);
+    cg.strategy = KatzCentrality::Strategy::CONJUGATE_GRADIENT;
+    cg.run();
+
+    const auto &expected = power.scores();
+    const auto &scores = cg.scores();
+    G.forNodes([&](node u) { EXPECT_NEAR(scores[u], expected[u], 1e-8); });
+    EXPECT_EQ(scores[0], 0.0);
+}
+
 TEST_F(CentralityGTest, testPageRankCentrality) {
     /* Graph:
      0    3   6
@@ -1025,6 +1421,30 @@ TEST_P(CentralityGTest, testClosenessCentrality) {
     }
 }
 
+TEST_P(CentralityGTest, testClosenessBatchedSources) {
+    // Unweighted graphs are processed in batches of sources, unit weights with one SSSP per source.
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.01, isDirected()).generate();
+    G.removeNode(GraphTools::randomNode(G));
+    const Graph unitWeights = GraphTools::toWeighted(G);
+
+    for (const bool normalized : {false, true}) {
+        Closeness batched(G, normalized, ClosenessVariant::GENERALIZED);
+        batched.run();
+        Closeness reference(unitWeights, normalized, ClosenessVariant::GENERALIZED);
+        reference.run();
+        G.forNodes([&](node u) { EXPECT_DOUBLE_EQ(batched.score(u), reference.score(u)); });
+
+        HarmonicCloseness batchedHarmonic(G, normalized);
+        batchedHarmonic.run();
+        HarmonicCloseness referenceHarmonic(unitWeights, normalized);
+        referenceHarmonic.run();
+        G.forNodes([&](node u) {
+            EXPECT_NEAR(batchedHarmonic.score(u), referenceHarmonic.score(u), 1e-12);
+        });
+    }
+}
+
 TEST_F(CentralityGTest, testHarmonicClosenessCentrality) {
     /* Graph:
      0    3
@@ -1244,6 +1664,94 @@ TEST_F(CentralityGTest, testCoreDecompositionDirected) {
     EXPECT_EQ(2u, coreness[15]) << "expected coreness";
 }
 
+TEST_F(CentralityGTest, testCoreDecompositionDeletedNodes) {
+    Aux::Random::setSeed(42, false);
+    auto G = METISGraphReader{}.read("input/PGPgiantcompo.graph");
+    G.removeSelfLoops();
+    for (const node u : GraphTools::randomNodes(G, 1000))
+        G.removeNode(u);
+
+    CoreDecomposition park(G);
+    park.run();
+    CoreDecomposition bucketQueue(G, false, true);
+    bucketQueue.run();
+
+    G.forNodes([&](node u) { EXPECT_EQ(park.score(u), bucketQueue.score(u)); });
+    EXPECT_EQ(park.maxCoreNumber(), bucketQueue.maxCoreNumber());
+}
+
+TEST_F(CentralityGTest, testDynCoreDecomposition) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.05).generate();
+    DynCoreDecomposition dynCores(G);
+    dynCores.run();
+
+    auto checkCores = [&]() {
+        CoreDecomposition cores(G);
+        cores.run();
+        G.forNodes([&](node u) { EXPECT_EQ(dynCores.score(u), cores.score(u)); });
+        EXPECT_EQ(dynCores.maxCoreNumber(), cores.maxCoreNumber());
+    };
+
+    for (count i = 0; i < 200; ++i) {
+        if (i % 2) {
+            const auto [u, v] = GraphTools::randomEdge(G);
+            G.removeEdge(u, v);
+            dynCores.update(GraphEvent(GraphEvent::EDGE_REMOVAL, u, v));
+        } else {
+            node u, v;
+            do {
+                u = GraphTools::randomNode(G);
+                v = GraphTools::randomNode(G);
+            } while (u == v || G.hasEdge(u, v));
+            G.addEdge(u, v);
+            dynCores.update(GraphEvent(GraphEvent::EDGE_ADDITION, u, v));
+        }
+        checkCores();
+    }
+
+    EXPECT_THROW(dynCores.update(GraphEvent(GraphEvent::NODE_ADDITION, 0)), std::runtime_error);
+}
+
+TEST_F(CentralityGTest, testDynCoreDecompositionBatch) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.05).generate();
+    DynCoreDecomposition dynCores(G);
+    dynCores.run();
+
+    for (count batch = 0; batch < 10; ++batch) {
+        std::vector<GraphEvent> events;
+        for (count i = 0; i < 30; ++i) {
+            if (Aux::Random::integer(1)) {
+                const auto [u, v] = GraphTools::randomEdge(G);
+                G.removeEdge(u, v);
+                events.emplace_back(GraphEvent::EDGE_REMOVAL, u, v);
+            } else {
+                node u, v;
+                do {
+                    u = GraphTools::randomNode(G);
+                    v = GraphTools::randomNode(G);
+                } while (u == v || G.hasEdge(u, v));
+                G.addEdge(u, v);
+                events.emplace_back(GraphEvent::EDGE_ADDITION, u, v);
+            }
+        }
+        // A new isolated node and an edge that is inserted and removed within the batch
+        const node x = G.addNode();
+        node y;
+        do {
+            y = GraphTools::randomNode(G);
+        } while (y == x);
+        events.emplace_back(GraphEvent::EDGE_ADDITION, x, y);
+        events.emplace_back(GraphEvent::EDGE_REMOVAL, x, y);
+        dynCores.updateBatch(events);
+
+        CoreDecomposition cores(G);
+        cores.run();
+        G.forNodes([&](node u) { EXPECT_EQ(dynCores.score(u), cores.score(u)); });
+    }
+}
+
 TEST_F(CentralityGTest, testLocalClusteringCoefficientUndirected) {
     count n = 16;
     Graph G(n, false, false);
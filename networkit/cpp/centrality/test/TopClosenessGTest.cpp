@@ -7,6 +7,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <omp.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -45,6 +46,61 @@ bool TopHarmonicClosenessGTest::useNBBound() const noexcept {
     return GetParam();
 }
 
+namespace {
+// Graphs on which many nodes have the same (harmonic) closeness: a cycle, a grid, and a sparse
+// random graph. Directed graphs orient the edges of the cycle and the grid in one direction.
+std::vector<Graph> graphsWithTies(bool directed) {
+    std::vector<Graph> graphs;
+
+    Graph cycle(60, false, directed);
+    for (node u = 0; u < 60; ++u)
+        cycle.addEdge(u, (u + 1) % 60);
+    graphs.push_back(std::move(cycle));
+
+    constexpr count side = 9;
+    Graph grid(side * side, false, directed);
+    for (node u = 0; u < side * side; ++u) {
+        if (u % side + 1 < side)
+            grid.addEdge(u, u + 1);
+        if (u + side < side * side)
+            grid.addEdge(u, u + side);
+    }
+    graphs.push_back(std::move(grid));
+
+    Aux::Random::setSeed(42, false);
+    graphs.push_back(ErdosRenyiGenerator(200, 0.015, directed).generate());
+    return graphs;
+}
+
+// Compares the top-k scores with the exact scores, using several threads so that the threads
+// prune with the k-th score published by the others. With ties, any of the tied nodes may be
+// returned, but their exact scores must match.
+template <class Exact, class MakeTopK>
+void checkTopKWithTies(const Graph &G, count k, Exact &exact, MakeTopK makeTopK) {
+    constexpr double tol = 1e-9;
+    exact.run();
+    const auto ranking = exact.ranking();
+
+    const int maxThreads = omp_get_max_threads();
+    for (int threads : {1, 2, 4}) {
+        SCOPED_TRACE(testing::Message() << "k = " << k << ", threads = " << threads);
+        omp_set_num_threads(threads);
+        auto topk = makeTopK(G);
+        topk.run();
+
+        const auto nodes = topk.topkNodesList();
+        const auto scores = topk.topkScoresList();
+        ASSERT_EQ(nodes.size(), k);
+        ASSERT_EQ(scores.size(), k);
+        for (index i = 0; i < k; ++i) {
+            EXPECT_NEAR(scores[i], ranking[i].second, tol);
+            EXPECT_NEAR(exact.score(nodes[i]), ranking[i].second, tol);
+        }
+    }
+    omp_set_num_threads(maxThreads);
+}
+} // namespace
+
 INSTANTIATE_TEST_SUITE_P(InstantiationName, TopClosenessGTest,
                          testing::Values(std::make_pair(false, false), std::make_pair(true, false),
                                          std::make_pair(false, true), std::make_pair(true, true)));
@@ -75,6 +131,21 @@ TEST_P(TopClosenessGTest, testTopCloseness) {
     }
 }
 
+TEST_P(TopClosenessGTest, testTopClosenessWithTiesParallel) {
+    for (bool isDirected : {false, true}) {
+        for (const auto &G : graphsWithTies(isDirected)) {
+            SCOPED_TRACE(testing::Message() << "directed = " << isDirected
+                                            << ", n = " << G.numberOfNodes());
+            for (count k : {1, 5, 12}) {
+                Closeness exact(G, true, ClosenessVariant::GENERALIZED);
+                checkTopKWithTies(G, k, exact, [&](const Graph &graph) {
+                    return TopCloseness(graph, k, useFirstHeu(), useSecondHeu());
+                });
+            }
+        }
+    }
+}
+
 TEST_P(TopClosenessGTest, testTopClosenessWithNodeList) {
     METISGraphReader reader;
     Graph G = reader.read("input/lesmis.graph");
@@ -138,6 +209,21 @@ TEST_P(TopHarmonicClosenessGTest, testTopHarmonicCloseness) {
     }
 }
 
+TEST_P(TopHarmonicClosenessGTest, testTopHarmonicClosenessWithTiesParallel) {
+    for (bool isDirected : {false, true}) {
+        for (const auto &G : graphsWithTies(isDirected)) {
+            SCOPED_TRACE(testing::Message() << "directed = " << isDirected
+                                            << ", n = " << G.numberOfNodes());
+            for (count k : {1, 5, 12}) {
+                HarmonicCloseness exact(G, false);
+                checkTopKWithTies(G, k, exact, [&](const Graph &graph) {
+                    return TopHarmonicCloseness(graph, k, useNBBound());
+                });
+            }
+        }
+    }
+}
+
 TEST_P(TopHarmonicClosenessGTest, testTopHarmonicClosenessWithNodeList) {
     METISGraphReader reader;
     Graph G = reader.read("input/lesmis.graph");
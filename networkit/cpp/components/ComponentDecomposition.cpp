@@ -6,6 +6,9 @@ namespace NetworKit {
 ComponentDecomposition::ComponentDecomposition(const Graph &G)
     : G(&G), component(G.upperNodeIdBound()) {}
 
+ComponentDecomposition::ComponentDecomposition(const CSRGraph &G)
+    : G(nullptr), component(G.upperNodeIdBound()) {}
+
 count ComponentDecomposition::numberOfComponents() const {
     assureFinished();
     return component.upperBound();
@@ -25,7 +28,10 @@ const Partition &ComponentDecomposition::getPartition() const {
 std::vector<std::vector<node>> ComponentDecomposition::getComponents() const {
     assureFinished();
     std::vector<std::vector<node>> result(numberOfComponents());
-    G->forNodes([&](node u) { result[component[u]].push_back(u); });
+    // Deleted nodes are not assigned to any component.
+    for (node u = 0; u < component.numberOfElements(); ++u)
+        if (component[u] != none)
+            result[component[u]].push_back(u);
     return result;
 }
 
@@ -15,6 +15,10 @@ ConnectedComponents::ConnectedComponents(const Graph &G)
     : ComponentDecomposition(G),
       impl(new ConnectedComponentsDetails::ConnectedComponentsImpl<false>{G, component}) {}
 
+ConnectedComponents::ConnectedComponents(const CSRGraph &G)
+    : ComponentDecomposition(G),
+      impl(new ConnectedComponentsDetails::ConnectedComponentsImpl<false>{G, component}) {}
+
 ConnectedComponents::~ConnectedComponents() = default;
 
 void ConnectedComponents::run() {
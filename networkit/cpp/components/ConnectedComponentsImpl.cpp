@@ -6,9 +6,8 @@ namespace NetworKit {
 namespace ConnectedComponentsDetails {
 
 template <bool WeaklyCC>
-ConnectedComponentsImpl<WeaklyCC>::ConnectedComponentsImpl(const Graph &G, Partition &components)
-    : G(&G), componentPtr(&components) {
-
+template <class GraphType>
+void ConnectedComponentsImpl<WeaklyCC>::checkDirection(const GraphType &G) {
     if (!WeaklyCC && G.isDirected())
         throw std::runtime_error(
             "Error, connected components of directed graphs cannot be "
@@ -19,18 +18,42 @@ ConnectedComponentsImpl<WeaklyCC>::ConnectedComponentsImpl(const Graph &G, Parti
                                  "be computed, use ConnectedComponents instead.");
 }
 
+template <bool WeaklyCC>
+ConnectedComponentsImpl<WeaklyCC>::ConnectedComponentsImpl(const Graph &G, Partition &components)
+    : G(&G), componentPtr(&components) {
+    checkDirection(G);
+}
+
+template <bool WeaklyCC>
+ConnectedComponentsImpl<WeaklyCC>::ConnectedComponentsImpl(const CSRGraph &G,
+                                                           Partition &components)
+    : csr(&G), componentPtr(&components) {
+    checkDirection(G);
+}
+
 template <bool WeaklyCC>
 void ConnectedComponentsImpl<WeaklyCC>::run() {
+    if (csr)
+        runImpl(*csr);
+    else
+        runImpl(*G);
+
+    hasRun = true;
+}
+
+template <bool WeaklyCC>
+template <class GraphType>
+void ConnectedComponentsImpl<WeaklyCC>::runImpl(const GraphType &G) {
     index nComponents = 0;
     count visitedNodes = 0;
 
     std::queue<node> q;
     auto &component = *componentPtr;
-    component.reset(G->upperNodeIdBound(), none);
+    component.reset(G.upperNodeIdBound(), none);
 
     // perform breadth-first searches
-    for (const node u : G->nodeRange()) {
-        if (component[u] != none)
+    for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+        if (!G.hasNode(u) || component[u] != none)
             continue;
 
         component.setUpperBound(nComponents + 1);
@@ -52,19 +75,17 @@ void ConnectedComponentsImpl<WeaklyCC>::run() {
             };
 
             // enqueue neighbors, set component
-            G->forNeighborsOf(v, visitNeighbor);
+            G.forNeighborsOf(v, visitNeighbor);
             if (WeaklyCC)
-                G->forInNeighborsOf(v, visitNeighbor);
+                G.forInNeighborsOf(v, visitNeighbor);
 
         } while (!q.empty());
 
         ++nComponents;
 
-        if (visitedNodes == G->numberOfNodes())
+        if (visitedNodes == G.numberOfNodes())
             break;
     }
-
-    hasRun = true;
 }
 
 template <bool WeaklyCC>
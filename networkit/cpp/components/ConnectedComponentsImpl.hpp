@@ -2,6 +2,7 @@
 #define NETWORKIT_COMPONENTS_CONNECTED_COMPONENTS_GENERAL_HPP_
 
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/structures/Partition.hpp>
 
@@ -21,6 +22,12 @@ public:
      */
     ConnectedComponentsImpl(const Graph &G, Partition &components);
 
+    /* Create the ConnectedComponentsImpl class for the CSR snapshot @G.
+     *
+     * @param G The graph.
+     */
+    ConnectedComponentsImpl(const CSRGraph &G, Partition &components);
+
     /*
      * Compute the (weakly) connected components of the input graph.
      */
@@ -37,8 +44,16 @@ public:
     static Graph extractLargestConnectedComponent(const Graph &G, bool compactGraph);
 
 private:
-    const Graph *G;
+    // Exactly one of G and csr is set.
+    const Graph *G = nullptr;
+    const CSRGraph *csr = nullptr;
     Partition *componentPtr;
+
+    template <class GraphType>
+    static void checkDirection(const GraphType &G);
+
+    template <class GraphType>
+    void runImpl(const GraphType &G);
 };
 
 } // namespace ConnectedComponentsDetails
@@ -126,6 +126,26 @@ TEST_F(ConnectedComponentsGTest, testParallelConnectedComponentsWithDeletedNodes
     }
 }
 
+TEST_F(ConnectedComponentsGTest, testConnectedComponentsCSRGraph) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.005).generate();
+    G.removeNode(GraphTools::randomNode(G));
+
+    ConnectedComponents cc(G);
+    cc.run();
+    const CSRGraph csr = G.freeze();
+    ConnectedComponents ccSnapshot(csr);
+    ccSnapshot.run();
+
+    EXPECT_EQ(cc.numberOfComponents(), ccSnapshot.numberOfComponents());
+    G.forNodes([&](node u) { EXPECT_EQ(cc.componentOfNode(u), ccSnapshot.componentOfNode(u)); });
+    EXPECT_EQ(cc.getComponents(), ccSnapshot.getComponents());
+    EXPECT_EQ(cc.getComponentSizes(), ccSnapshot.getComponentSizes());
+
+    const CSRGraph directed = Graph(10, false, true).freeze();
+    EXPECT_THROW(ConnectedComponents{directed}, std::runtime_error);
+}
+
 TEST_F(ConnectedComponentsGTest, benchConnectedComponents) {
     // construct graph
     METISGraphReader reader;
@@ -5,9 +5,13 @@
  *      Author: Henning
  */
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <queue>
 
 #include <networkit/distance/BFS.hpp>
+#include <networkit/graph/BFS.hpp>
 
 namespace NetworKit {
 
@@ -15,6 +19,11 @@ BFS::BFS(const Graph &G, node source, bool storePaths, bool storeNodesSortedByDi
     : SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {}
 
 void BFS::run() {
+    if (strategy == DIRECTION_OPTIMIZING) {
+        runDirectionOptimizing();
+        return;
+    }
+
     count z = G->upperNodeIdBound();
     reachedNodes = 1;
     sumDist = 0.;
@@ -76,4 +85,75 @@ void BFS::run() {
 
     hasRun = true;
 }
+
+void BFS::runDirectionOptimizing() {
+    const count z = G->upperNodeIdBound();
+    const auto infDist = std::numeric_limits<edgeweight>::max();
+    distances.assign(z, infDist);
+
+    Traversal::parallelBFSfrom(*G, source, [&](node u, count dist) {
+        distances[u] = static_cast<edgeweight>(dist);
+    });
+
+    count reached = 0;
+    double sum = 0;
+    count maxDist = 0;
+#pragma omp parallel for reduction(+ : reached, sum) reduction(max : maxDist)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (distances[u] != infDist) {
+            ++reached;
+            sum += distances[u];
+            maxDist = std::max(maxDist, static_cast<count>(distances[u]));
+        }
+    }
+    reachedNodes = reached;
+    sumDist = sum;
+
+    if (!storePaths && !storeNodesSortedByDistance) {
+        hasRun = true;
+        return;
+    }
+
+    // Group the reached nodes by distance
+    std::vector<index> levelBegin(maxDist + 2, 0);
+    for (node u = 0; u < z; ++u)
+        if (distances[u] != infDist)
+            ++levelBegin[static_cast<index>(distances[u]) + 1];
+    std::partial_sum(levelBegin.begin(), levelBegin.end(), levelBegin.begin());
+    std::vector<node> sorted(reached);
+    {
+        auto position = levelBegin;
+        for (node u = 0; u < z; ++u)
+            if (distances[u] != infDist)
+                sorted[position[static_cast<index>(distances[u])]++] = u;
+    }
+
+    if (storePaths) {
+        previous.clear();
+        previous.resize(z);
+        npaths.clear();
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+
+        // The predecessors of a node are its in-neighbors one level closer to the source.
+        for (index level = 1; level <= maxDist; ++level) {
+#pragma omp parallel for schedule(dynamic, 64)
+            for (omp_index i = static_cast<omp_index>(levelBegin[level]);
+                 i < static_cast<omp_index>(levelBegin[level + 1]); ++i) {
+                const node v = sorted[i];
+                G->forInNeighborsOf(v, [&](node u) {
+                    if (distances[u] + 1. == distances[v]) {
+                        previous[v].push_back(u);
+                        npaths[v] += npaths[u];
+                    }
+                });
+            }
+        }
+    }
+
+    if (storeNodesSortedByDistance)
+        nodesSortedByDistance = std::move(sorted);
+
+    hasRun = true;
+}
 } // namespace NetworKit
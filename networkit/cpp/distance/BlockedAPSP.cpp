@@ -0,0 +1,271 @@
+/*
+ * BlockedAPSP.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <omp.h>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/auxiliary/Enforce.hpp>
+#include <networkit/distance/BlockedAPSP.hpp>
+#include <networkit/distance/Dijkstra.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Header of a matrix file (magic "nkapsp01"). The rows of the matrix follow at offsetMatrix, a
+ * multiple of MATRIX_ALIGNMENT, so the matrix can be used in place after mapping the file into
+ * memory.
+ */
+struct MatrixHeader {
+    char magic[8];
+    uint64_t encoding;
+    uint64_t nodes;
+    uint64_t offsetMatrix;
+};
+
+constexpr uint64_t MATRIX_ALIGNMENT = 4096;
+
+// Calls f with the type tag of the distances of encoding.
+template <typename F>
+decltype(auto) withDistanceType(BlockedAPSP::Encoding encoding, F f) {
+    switch (encoding) {
+    case BlockedAPSP::UINT8:
+        return f(std::type_identity<uint8_t>{});
+    case BlockedAPSP::UINT16:
+        return f(std::type_identity<uint16_t>{});
+    case BlockedAPSP::UINT32:
+        return f(std::type_identity<uint32_t>{});
+    case BlockedAPSP::FLOAT64:
+        return f(std::type_identity<edgeweight>{});
+    default:
+        throw std::runtime_error("Invalid encoding of the distances");
+    }
+}
+
+} // namespace
+
+edgeweight BlockedAPSP::Tile::distance(index row, node v) const {
+    return withDistanceType(encoding, [&]<typename T>(std::type_identity<T>) {
+        const T value = as<T>()[row * columns + v];
+        return value == std::numeric_limits<T>::max() ? std::numeric_limits<edgeweight>::max()
+                                                      : static_cast<edgeweight>(value);
+    });
+}
+
+BlockedAPSP::BlockedAPSP(const Graph &G) : G(&G) {}
+
+BlockedAPSP::BlockedAPSP(std::string_view path) : G(nullptr) {
+    mapMatrix(path);
+    hasRun = true;
+}
+
+void BlockedAPSP::mapMatrix(std::string_view path) {
+    auto mmfile = std::make_shared<MemoryMappedFile>(path);
+    const char *data = mmfile->cbegin();
+    const size_t size = mmfile->size();
+
+    MatrixHeader header;
+    if (size < sizeof(MatrixHeader))
+        throw std::runtime_error("File is too small to contain a distance matrix");
+    memcpy(&header, data, sizeof(MatrixHeader));
+    if (memcmp("nkapsp01", header.magic, 8))
+        throw std::runtime_error("Reader expected another magic value");
+    if (header.encoding >= AUTO)
+        throw std::runtime_error("Invalid encoding of the distances");
+
+    const auto encoding = static_cast<Encoding>(header.encoding);
+    const uint64_t bytes = withDistanceType(
+        encoding, []<typename T>(std::type_identity<T>) -> uint64_t { return sizeof(T); });
+    if (header.offsetMatrix % MATRIX_ALIGNMENT || header.offsetMatrix > size
+        || (header.nodes && header.nodes > (size - header.offsetMatrix) / bytes / header.nodes))
+        throw std::runtime_error("Matrix exceeds the file");
+
+    n = header.nodes;
+    stored = encoding;
+    matrix = data + header.offsetMatrix;
+    storage = std::move(mmfile);
+}
+
+BlockedAPSP::Encoding BlockedAPSP::resolveEncoding() const {
+    if (encoding != AUTO) {
+        if (encoding != FLOAT64 && G->isWeighted())
+            throw std::runtime_error("Integer encodings require an unweighted graph");
+        return encoding;
+    }
+    if (G->isWeighted())
+        return FLOAT64;
+
+    // Upper bound of the finite distances
+    count bound = G->numberOfNodes();
+    if (!G->isDirected()) {
+        // Within a component, no distance exceeds twice the eccentricity of any of its nodes.
+        bound = 0;
+        std::vector<count> dist(G->upperNodeIdBound(), none);
+        std::queue<node> q;
+        G->forNodes([&](node s) {
+            if (dist[s] != none)
+                return;
+            count eccentricity = 0;
+            dist[s] = 0;
+            q.push(s);
+            do {
+                const node u = q.front();
+                q.pop();
+                eccentricity = dist[u];
+                G->forNeighborsOf(u, [&](node v) {
+                    if (dist[v] == none) {
+                        dist[v] = dist[u] + 1;
+                        q.push(v);
+                    }
+                });
+            } while (!q.empty());
+            bound = std::max(bound, 2 * eccentricity);
+        });
+    }
+
+    if (bound < std::numeric_limits<uint8_t>::max())
+        return UINT8;
+    if (bound < std::numeric_limits<uint16_t>::max())
+        return UINT16;
+    if (bound < std::numeric_limits<uint32_t>::max())
+        return UINT32;
+    return FLOAT64;
+}
+
+template <typename T>
+void BlockedAPSP::computeTile(node first, count rows, T *data) const {
+    constexpr T infDist = std::numeric_limits<T>::max();
+    std::fill(data, data + rows * n, infDist);
+
+    std::vector<node> sources;
+    for (node s = first; s < first + rows; ++s)
+        if (G->hasNode(s))
+            sources.push_back(s);
+
+    std::atomic<bool> overflow{false};
+    if (!G->isWeighted()) {
+        const count batches = (sources.size() + MultiSourceBFS::maxSources - 1)
+                              / MultiSourceBFS::maxSources;
+#pragma omp parallel
+        {
+            MultiSourceBFS msBFS(*G);
+#pragma omp for schedule(dynamic, 1)
+            for (omp_index b = 0; b < static_cast<omp_index>(batches); ++b) {
+                const index begin = b * MultiSourceBFS::maxSources;
+                const std::span<const node> batch(
+                    sources.data() + begin,
+                    std::min(MultiSourceBFS::maxSources, sources.size() - begin));
+                msBFS.run(batch, [&](node u, count dist, MultiSourceBFS::SourceMask mask) {
+                    if constexpr (std::is_integral_v<T>) {
+                        if (dist >= infDist) {
+                            overflow.store(true, std::memory_order_relaxed);
+                            return;
+                        }
+                    }
+                    for (; mask; mask &= mask - 1)
+                        data[(batch[std::countr_zero(mask)] - first) * n + u] =
+                            static_cast<T>(dist);
+                });
+            }
+        }
+    } else {
+        constexpr auto infWeight = std::numeric_limits<edgeweight>::max();
+#pragma omp parallel
+        {
+            Dijkstra dijkstra(*G, first, false);
+#pragma omp for schedule(dynamic, 1)
+            for (omp_index i = 0; i < static_cast<omp_index>(sources.size()); ++i) {
+                dijkstra.setSource(sources[i]);
+                dijkstra.run();
+                const auto &distances = dijkstra.getDistances();
+                T *row = data + (sources[i] - first) * n;
+                for (node v = 0; v < n; ++v)
+                    if (distances[v] != infWeight)
+                        row[v] = static_cast<T>(distances[v]);
+            }
+        }
+    }
+
+    if (overflow)
+        throw std::runtime_error("Distances exceed the range of the encoding");
+}
+
+void BlockedAPSP::run() {
+    n = G->upperNodeIdBound();
+    stored = resolveEncoding();
+    storage.reset();
+    matrix = nullptr;
+
+    std::ofstream outfile;
+    uint64_t offsetMatrix = 0;
+    if (!outputPath.empty()) {
+        outfile.open(outputPath, std::ios::binary);
+        Aux::enforceOpened(outfile);
+
+        MatrixHeader header{};
+        strncpy(header.magic, "nkapsp01", 8);
+        header.encoding = stored;
+        header.nodes = n;
+        header.offsetMatrix = offsetMatrix = MATRIX_ALIGNMENT;
+        std::vector<char> padding(offsetMatrix - sizeof(MatrixHeader), 0);
+        outfile.write(reinterpret_cast<const char *>(&header), sizeof(MatrixHeader));
+        outfile.write(padding.data(), padding.size());
+    }
+
+    withDistanceType(stored, [&]<typename T>(std::type_identity<T>) {
+        count rows = tileSize;
+        if (!rows) {
+            rows = std::max<count>(maxTileBytes / std::max<count>(n * sizeof(T), 1), 1);
+            // Whole batches of the bit-parallel BFS
+            if (rows > MultiSourceBFS::maxSources)
+                rows -= rows % MultiSourceBFS::maxSources;
+        }
+        rows = std::min(rows, std::max<count>(n, 1));
+
+        std::vector<T> buffer(rows * n);
+        for (node first = 0; first < n; first += rows) {
+            const count tileRows = std::min(rows, n - first);
+            computeTile(first, tileRows, buffer.data());
+
+            const Tile tile{first, tileRows, n, stored, buffer.data()};
+            if (tileHandler)
+                tileHandler(tile);
+            if (outfile.is_open())
+                outfile.write(reinterpret_cast<const char *>(buffer.data()),
+                              tileRows * n * sizeof(T));
+        }
+    });
+
+    if (outfile.is_open()) {
+        outfile.close();
+        if (!outfile)
+            throw std::runtime_error("Could not write the distance matrix");
+        mapMatrix(outputPath);
+    }
+
+    hasRun = true;
+}
+
+edgeweight BlockedAPSP::getDistance(node u, node v) const {
+    assureFinished();
+    if (!matrix)
+        throw std::runtime_error("No distance matrix; set outputPath before calling run()");
+    return Tile{0, n, n, stored, matrix}.distance(u, v);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,791 @@
+/*
+ * ContractionHierarchy.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <omp.h>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
+
+#include <networkit/auxiliary/Enforce.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/auxiliary/VectorComparator.hpp>
+#include <networkit/distance/ContractionHierarchy.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+enum Section {
+    RANKS,
+    OUT_OFFSETS,
+    OUT_TARGETS,
+    OUT_WEIGHTS,
+    OUT_MIDDLES,
+    IN_OFFSETS,
+    IN_TARGETS,
+    IN_WEIGHTS,
+    IN_MIDDLES,
+    LABELS_OUT_OFFSETS,
+    LABELS_OUT_HUBS,
+    LABELS_OUT_DISTANCES,
+    LABELS_IN_OFFSETS,
+    LABELS_IN_HUBS,
+    LABELS_IN_DISTANCES,
+    NUM_SECTIONS
+};
+
+/**
+ * Header of an index file (magic "nkch01"). All sections start at a multiple of
+ * INDEX_ALIGNMENT, so they can be used in place after mapping the file into memory. Absent
+ * sections (the upward in-edges and in-labels of undirected graphs, the labels if they have not
+ * been extracted) have offset zero.
+ */
+struct IndexHeader {
+    char magic[8];
+    uint64_t features;
+    uint64_t nodes;
+    uint64_t edgesOut;
+    uint64_t edgesIn;
+    uint64_t shortcuts;
+    uint64_t entriesOut;
+    uint64_t entriesIn;
+    uint64_t sections[NUM_SECTIONS];
+};
+
+constexpr uint64_t INDEX_ALIGNMENT = 4096;
+constexpr uint64_t DIRECTED_MASK = 0x1;    // bit 0
+constexpr uint64_t INDEX_32BIT_MASK = 0x2; // bit 1
+constexpr uint64_t HUB_LABELS_MASK = 0x4;  // bit 2
+
+constexpr edgeweight infDist = std::numeric_limits<edgeweight>::max();
+
+// Owns the hierarchy computed by run()
+struct HierarchyStorage {
+    std::vector<index> ranks;
+    std::vector<index> offsetsOut, offsetsIn;
+    std::vector<node> targetsOut, targetsIn, middlesOut, middlesIn;
+    std::vector<edgeweight> weightsOut, weightsIn;
+};
+
+// Owns the hub labels computed by run()
+struct LabelStorage {
+    std::vector<index> offsetsOut, offsetsIn, hubsOut, hubsIn;
+    std::vector<edgeweight> distancesOut, distancesIn;
+};
+
+// Edge of the graph that remains during the contraction.
+struct Arc {
+    node target;
+    edgeweight weight;
+    node middle;
+};
+
+struct Shortcut {
+    node from, to;
+    edgeweight weight;
+    node middle;
+};
+
+// Adds the arc to arcs, or lowers the weight of an existing arc to the same target.
+void insertArc(std::vector<Arc> &arcs, node target, edgeweight weight, node middle) {
+    auto it = std::ranges::find(arcs, target, &Arc::target);
+    if (it == arcs.end())
+        arcs.push_back({target, weight, middle});
+    else if (weight < it->weight)
+        *it = {target, weight, middle};
+}
+
+// Bounded Dijkstra search that looks for witness paths; each thread uses its own instance.
+class WitnessSearch {
+public:
+    explicit WitnessSearch(count n)
+        : dist(n, infDist), isTarget(n), heap(Aux::LessInVector<edgeweight>{dist}) {}
+
+    // Searches from source over arcs while skipping the nodes for which skip returns true. The
+    // search stops as soon as it has settled all targets, all nodes up to distance maxDist, or
+    // limit nodes.
+    template <typename Skip>
+    void run(const std::vector<std::vector<Arc>> &arcs, node source,
+             const std::vector<node> &targets, edgeweight maxDist, count limit, Skip &&skip) {
+        for (const node u : touched)
+            dist[u] = infDist;
+        touched.clear();
+        heap.clear();
+        for (const node t : targets)
+            isTarget[t] = 1;
+
+        dist[source] = 0;
+        touched.push_back(source);
+        heap.push(source);
+        count settled = 0, targetsLeft = targets.size();
+        while (!heap.empty()) {
+            const node u = heap.extract_top();
+            if (dist[u] > maxDist || ++settled > limit)
+                break;
+            if (isTarget[u] && --targetsLeft == 0)
+                break;
+            for (const Arc &arc : arcs[u]) {
+                if (skip(arc.target))
+                    continue;
+                const edgeweight newDist = dist[u] + arc.weight;
+                if (newDist < dist[arc.target]) {
+                    if (dist[arc.target] == infDist)
+                        touched.push_back(arc.target);
+                    dist[arc.target] = newDist;
+                    heap.update(arc.target);
+                }
+            }
+        }
+
+        for (const node t : targets)
+            isTarget[t] = 0;
+    }
+
+    // Returns the length of the shortest path to u found by the last search (tentative
+    // distances are lengths of actual paths, too).
+    edgeweight distance(node u) const { return dist[u]; }
+
+private:
+    std::vector<edgeweight> dist;
+    std::vector<uint8_t> isTarget;
+    std::vector<node> touched;
+    tlx::d_ary_addressable_int_heap<node, 2, Aux::LessInVector<edgeweight>> heap;
+};
+
+/**
+ * Calls handle(p, s, weight) for each shortcut (p, s) that the contraction of x requires, i.e.,
+ * for each pair of neighbors such that no witness search finds a path from p to s that avoids
+ * x and the nodes for which skip returns true and is at most as long as the path over x. In
+ * undirected graphs, only pairs with p < s are reported.
+ */
+template <typename Skip, typename Handle>
+void forShortcuts(const std::vector<std::vector<Arc>> &out, const std::vector<std::vector<Arc>> &in,
+                  bool directed, node x, count limit, WitnessSearch &search, Skip &&skip,
+                  Handle &&handle) {
+    std::vector<node> targets;
+    for (const Arc &first : directed ? in[x] : out[x]) {
+        const node p = first.target;
+        auto isTarget = [&](node s) { return s != p && (directed || s > p); };
+
+        edgeweight maxDist = 0;
+        targets.clear();
+        for (const Arc &second : out[x]) {
+            if (isTarget(second.target)) {
+                maxDist = std::max(maxDist, first.weight + second.weight);
+                targets.push_back(second.target);
+            }
+        }
+        if (targets.empty())
+            continue;
+
+        search.run(out, p, targets, maxDist, limit, [&](node v) { return v == x || skip(v); });
+        for (const Arc &second : out[x]) {
+            const edgeweight viaX = first.weight + second.weight;
+            if (isTarget(second.target) && search.distance(second.target) > viaX)
+                handle(p, second.target, viaX);
+        }
+    }
+}
+
+using Label = std::pair<index, edgeweight>;
+
+// Returns the shortest distance over a common hub of the two sorted label lists.
+edgeweight mergeLabels(const std::vector<Label> &labelsU, const std::vector<Label> &labelsV) {
+    edgeweight result = infDist;
+    auto iterU = labelsU.begin(), iterV = labelsV.begin();
+    while (iterU != labelsU.end() && iterV != labelsV.end()) {
+        if (iterU->first < iterV->first)
+            ++iterU;
+        else if (iterV->first < iterU->first)
+            ++iterV;
+        else {
+            result = std::min(result, iterU->second + iterV->second);
+            ++iterU;
+            ++iterV;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+ContractionHierarchy::ContractionHierarchy(const Graph &G, bool hubLabels)
+    : G(&G), directed(G.isDirected()), hubLabels(hubLabels) {}
+
+ContractionHierarchy::ContractionHierarchy(std::string_view path) : G(nullptr) {
+    auto mmfile = std::make_shared<MemoryMappedFile>(path);
+    const char *data = mmfile->cbegin();
+    const size_t size = mmfile->size();
+
+    IndexHeader header;
+    if (size < sizeof(IndexHeader))
+        throw std::runtime_error("File is too small to contain a contraction hierarchy");
+    memcpy(&header, data, sizeof(IndexHeader));
+    if (memcmp("nkch01", header.magic, 8))
+        throw std::runtime_error("Reader expected another magic value");
+    if (static_cast<bool>(header.features & INDEX_32BIT_MASK)
+        != (sizeof(index) == sizeof(uint32_t)))
+        throw std::runtime_error("Index was written with a different node id width");
+    if (header.nodes == none)
+        throw std::runtime_error("Invalid number of nodes");
+
+    directed = header.features & DIRECTED_MASK;
+    hubLabels = header.features & HUB_LABELS_MASK;
+    shortcuts = header.shortcuts;
+    const uint64_t *sections = header.sections;
+
+    // The queries access the arrays without bound checks, so the whole index is validated here.
+    const count n = header.nodes;
+    ranks = mappedSection<index>(data, size, sections[RANKS], n);
+    if (ranks.size() != n)
+        throw std::runtime_error("Invalid ranks in the index file");
+    {
+        std::vector<uint8_t> isRank(n, 0);
+        for (const index r : ranks) {
+            if (r >= n || isRank[r])
+                throw std::runtime_error("Invalid ranks in the index file");
+            isRank[r] = 1;
+        }
+    }
+
+    auto mapEdges = [&](Section first, uint64_t edges, UpwardGraph &up) {
+        up.offsets = mappedSection<index>(data, size, sections[first], n + 1);
+        up.targets = mappedSection<node>(data, size, sections[first + 1], edges);
+        up.weights = mappedSection<edgeweight>(data, size, sections[first + 2], edges);
+        up.middles = mappedSection<node>(data, size, sections[first + 3], edges);
+        if (!validOffsets(up.offsets, edges) || up.targets.size() != edges
+            || up.weights.size() != edges || up.middles.size() != edges)
+            throw std::runtime_error("Invalid edges in the index file");
+
+        // Edges lead to nodes of higher rank, shortcuts bypass a node of lower rank than both
+        // endpoints; the latter also bounds the recursion of unpacking shortcuts.
+        for (node u = 0; u < n; ++u) {
+            for (index i = up.offsets[u]; i < up.offsets[u + 1]; ++i) {
+                const node v = up.targets[i], middle = up.middles[i];
+                if (v >= n || ranks[v] <= ranks[u]
+                    || (middle != none && (middle >= n || ranks[middle] >= ranks[u])))
+                    throw std::runtime_error("Invalid edges in the index file");
+            }
+        }
+    };
+    mapEdges(OUT_OFFSETS, header.edgesOut, upOut);
+    if (directed)
+        mapEdges(IN_OFFSETS, header.edgesIn, upIn);
+    else
+        upIn = upOut;
+
+    if (hubLabels) {
+        auto mapLabels = [&](Section first, uint64_t entries, HubLabels &labels) {
+            labels.offsets = mappedSection<index>(data, size, sections[first], n + 1);
+            labels.hubs = mappedSection<index>(data, size, sections[first + 1], entries);
+            labels.distances = mappedSection<edgeweight>(data, size, sections[first + 2], entries);
+            if (!validOffsets(labels.offsets, entries) || labels.hubs.size() != entries
+                || labels.distances.size() != entries)
+                throw std::runtime_error("Invalid labels in the index file");
+
+            // Every list must end with the sentinel that stops the merge in distance().
+            for (node u = 0; u < n; ++u) {
+                const index end = labels.offsets[u + 1];
+                if (end == labels.offsets[u] || labels.hubs[end - 1] != none)
+                    throw std::runtime_error("Invalid labels in the index file");
+            }
+            for (const index hub : labels.hubs)
+                if (hub >= n && hub != none)
+                    throw std::runtime_error("Invalid labels in the index file");
+        };
+        mapLabels(LABELS_OUT_OFFSETS, header.entriesOut, labelsOut);
+        if (directed)
+            mapLabels(LABELS_IN_OFFSETS, header.entriesIn, labelsIn);
+        else
+            labelsIn = labelsOut;
+    }
+
+    storage = std::move(mmfile);
+    hasRun = true;
+}
+
+void ContractionHierarchy::run() {
+    if (!G)
+        throw std::runtime_error("The index has been loaded from a file");
+
+    bool negativeWeights = false;
+    G->forEdges([&](node, node, edgeweight weight) { negativeWeights |= weight < 0; });
+    if (negativeWeights)
+        throw std::runtime_error("Contraction hierarchies require non-negative edge weights");
+
+    const count n = G->upperNodeIdBound();
+    std::vector<std::vector<Arc>> out(n), in(directed ? n : 0);
+    G->parallelForNodes([&](node u) {
+        G->forNeighborsOf(u, [&](node v, edgeweight weight) {
+            if (u != v)
+                insertArc(out[u], v, weight, none);
+        });
+        if (directed)
+            G->forInNeighborsOf(u, [&](node v, edgeweight weight) {
+                if (u != v)
+                    insertArc(in[u], v, weight, none);
+            });
+    });
+
+    std::vector<std::unique_ptr<WitnessSearch>> searches(omp_get_max_threads());
+    auto witnessSearch = [&]() -> WitnessSearch & {
+        auto &search = searches[omp_get_thread_num()];
+        if (!search)
+            search = std::make_unique<WitnessSearch>(n);
+        return *search;
+    };
+
+    // Weighted sum of edge difference and number of contracted neighbors; weighting the edge
+    // difference higher yields fewer shortcuts and smaller search spaces.
+    std::vector<count> contractedNeighbors(n);
+    std::vector<int64_t> priorities(n);
+    auto updatePriority = [&](node x) {
+        int64_t added = 0;
+        forShortcuts(
+            out, in, directed, x, witnessSearchLimit, witnessSearch(),
+            [](node) { return false; }, [&](node, node, edgeweight) { ++added; });
+        const auto removed = static_cast<int64_t>(out[x].size() + (directed ? in[x].size() : 0));
+        priorities[x] = 4 * (added - removed) + static_cast<int64_t>(contractedNeighbors[x]);
+    };
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for (omp_index x = 0; x < static_cast<omp_index>(n); ++x)
+        updatePriority(x);
+
+    // Nodes without an id in the graph are isolated and get contracted in the first round.
+    std::vector<node> remaining(n);
+    std::iota(remaining.begin(), remaining.end(), node{0});
+
+    std::vector<index> rankOf(n, none);
+    std::vector<std::vector<Arc>> upwardOut(n), upwardIn(directed ? n : 0);
+    std::vector<uint8_t> contracting(n), affected(n);
+    std::vector<node> batch, neighbors;
+    std::vector<std::vector<Shortcut>> threadShortcuts(omp_get_max_threads());
+    std::vector<Shortcut> added;
+    index nextRank = 0;
+
+    auto isLocalMinimum = [&](node x) {
+        auto precedes = [&](const Arc &arc) {
+            const node y = arc.target;
+            return priorities[x] < priorities[y] || (priorities[x] == priorities[y] && x < y);
+        };
+        return std::ranges::all_of(out[x], precedes)
+               && (!directed || std::ranges::all_of(in[x], precedes));
+    };
+
+    // Inserts the shortcuts into the arc lists; shortcuts must be sorted by the endpoint key.
+    auto insertShortcuts = [&](std::vector<std::vector<Arc>> &arcs, auto key, auto other) {
+        std::vector<index> groupBegin;
+        for (index i = 0; i < added.size(); ++i)
+            if (i == 0 || key(added[i]) != key(added[i - 1]))
+                groupBegin.push_back(i);
+        groupBegin.push_back(added.size());
+
+#pragma omp parallel for schedule(dynamic, 64)
+        for (omp_index g = 0; g < static_cast<omp_index>(groupBegin.size()) - 1; ++g)
+            for (index i = groupBegin[g]; i < groupBegin[g + 1]; ++i)
+                insertArc(arcs[key(added[i])], other(added[i]), added[i].weight,
+                          added[i].middle);
+    };
+
+    while (!remaining.empty()) {
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(remaining.size()); ++i)
+            contracting[remaining[i]] = isLocalMinimum(remaining[i]);
+
+        batch.clear();
+        for (const node x : remaining)
+            if (contracting[x])
+                batch.push_back(x);
+
+        // The nodes of the batch are pairwise non-adjacent and witness paths avoid all of them,
+        // so their shortcuts can be computed independently.
+#pragma omp parallel for schedule(dynamic, 16)
+        for (omp_index i = 0; i < static_cast<omp_index>(batch.size()); ++i) {
+            const node x = batch[i];
+            auto &shortcutsOfThread = threadShortcuts[omp_get_thread_num()];
+            forShortcuts(
+                out, in, directed, x, witnessSearchLimit, witnessSearch(),
+                [&](node v) { return contracting[v]; },
+                [&](node p, node s, edgeweight weight) {
+                    shortcutsOfThread.push_back({p, s, weight, x});
+                    if (!directed)
+                        shortcutsOfThread.push_back({s, p, weight, x});
+                });
+        }
+
+        // All remaining neighbors of a contracted node are contracted later, so its arcs become
+        // its upward edges.
+        neighbors.clear();
+        for (const node x : batch) {
+            rankOf[x] = nextRank++;
+            upwardOut[x].swap(out[x]);
+            if (directed)
+                upwardIn[x].swap(in[x]);
+            auto markNeighbor = [&](const Arc &arc) {
+                if (!affected[arc.target]) {
+                    affected[arc.target] = 1;
+                    neighbors.push_back(arc.target);
+                }
+            };
+            std::ranges::for_each(upwardOut[x], markNeighbor);
+            if (directed)
+                std::ranges::for_each(upwardIn[x], markNeighbor);
+        }
+
+#pragma omp parallel for schedule(dynamic, 64)
+        for (omp_index i = 0; i < static_cast<omp_index>(neighbors.size()); ++i) {
+            const node y = neighbors[i];
+            auto isContracted = [&](const Arc &arc) { return contracting[arc.target] != 0; };
+            count removed = std::erase_if(out[y], isContracted);
+            if (directed)
+                removed += std::erase_if(in[y], isContracted);
+            contractedNeighbors[y] += removed;
+        }
+
+        added.clear();
+        for (auto &shortcutsOfThread : threadShortcuts) {
+            added.insert(added.end(), shortcutsOfThread.begin(), shortcutsOfThread.end());
+            shortcutsOfThread.clear();
+        }
+        // Sort all fields, so that ties between shortcuts are broken independently of the threads.
+        Aux::Parallel::sort(added.begin(), added.end(), [](const Shortcut &a, const Shortcut &b) {
+            return std::tie(a.from, a.to, a.weight, a.middle)
+                   < std::tie(b.from, b.to, b.weight, b.middle);
+        });
+        insertShortcuts(
+            out, [](const Shortcut &s) { return s.from; }, [](const Shortcut &s) { return s.to; });
+        if (directed) {
+            Aux::Parallel::sort(added.begin(), added.end(),
+                                [](const Shortcut &a, const Shortcut &b) {
+                                    return std::tie(a.to, a.from, a.weight, a.middle)
+                                           < std::tie(b.to, b.from, b.weight, b.middle);
+                                });
+            insertShortcuts(
+                in, [](const Shortcut &s) { return s.to; },
+                [](const Shortcut &s) { return s.from; });
+        }
+
+        for (const node x : batch)
+            contracting[x] = 0;
+
+#pragma omp parallel for schedule(dynamic, 16)
+        for (omp_index i = 0; i < static_cast<omp_index>(neighbors.size()); ++i) {
+            affected[neighbors[i]] = 0;
+            updatePriority(neighbors[i]);
+        }
+
+        std::erase_if(remaining, [&](node x) { return rankOf[x] != none; });
+    }
+    searches.clear();
+
+    // Flatten the upward edges
+    auto hierarchy = std::make_shared<HierarchyStorage>();
+    auto flatten = [&](std::vector<std::vector<Arc>> &arcs, std::vector<index> &offsets,
+                       std::vector<node> &targets, std::vector<edgeweight> &weights,
+                       std::vector<node> &middles) -> UpwardGraph {
+        offsets.resize(n + 1);
+        offsets[0] = 0;
+        for (node u = 0; u < n; ++u)
+            offsets[u + 1] = offsets[u] + arcs[u].size();
+        targets.resize(offsets[n]);
+        weights.resize(offsets[n]);
+        middles.resize(offsets[n]);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+            index i = offsets[u];
+            for (const Arc &arc : arcs[u]) {
+                targets[i] = arc.target;
+                weights[i] = arc.weight;
+                middles[i++] = arc.middle;
+            }
+            std::vector<Arc>().swap(arcs[u]);
+        }
+
+        return {offsets, targets, weights, middles};
+    };
+
+    hierarchy->ranks = std::move(rankOf);
+    ranks = hierarchy->ranks;
+    upOut = flatten(upwardOut, hierarchy->offsetsOut, hierarchy->targetsOut, hierarchy->weightsOut,
+                    hierarchy->middlesOut);
+    if (directed)
+        upIn = flatten(upwardIn, hierarchy->offsetsIn, hierarchy->targetsIn, hierarchy->weightsIn,
+                       hierarchy->middlesIn);
+    else
+        upIn = upOut;
+
+    shortcuts = std::ranges::count_if(upOut.middles, [](node m) { return m != none; });
+    if (directed)
+        shortcuts += std::ranges::count_if(upIn.middles, [](node m) { return m != none; });
+
+    storage = std::move(hierarchy);
+    labelStorage.reset();
+    labelsOut = labelsIn = {};
+    if (hubLabels)
+        extractHubLabels();
+
+    hasRun = true;
+}
+
+void ContractionHierarchy::extractHubLabels() {
+    const count n = ranks.size();
+    std::vector<node> nodeOfRank(n);
+    for (node u = 0; u < n; ++u)
+        nodeOfRank[ranks[u]] = u;
+
+    // The labels of a node depend on the labels of its upward neighbors. Thus, group the nodes
+    // by their depth (the longest upward path from them) and process the groups from the top.
+    std::vector<count> depth(n, 0);
+    count maxDepth = 0;
+    for (index r = n; r-- > 0;) {
+        const node u = nodeOfRank[r];
+        for (index i = upOut.offsets[u]; i < upOut.offsets[u + 1]; ++i)
+            depth[u] = std::max(depth[u], depth[upOut.targets[i]] + 1);
+        for (index i = upIn.offsets[u]; i < upIn.offsets[u + 1]; ++i)
+            depth[u] = std::max(depth[u], depth[upIn.targets[i]] + 1);
+        maxDepth = std::max(maxDepth, depth[u]);
+    }
+
+    std::vector<index> depthBegin(maxDepth + 2, 0);
+    for (node u = 0; u < n; ++u)
+        ++depthBegin[depth[u] + 1];
+    std::partial_sum(depthBegin.begin(), depthBegin.end(), depthBegin.begin());
+    std::vector<node> byDepth(n);
+    {
+        auto position = depthBegin;
+        for (node u = 0; u < n; ++u)
+            byDepth[position[depth[u]]++] = u;
+    }
+
+    std::vector<std::vector<Label>> out(n), in(directed ? n : 0);
+    auto &inLabels = directed ? in : out;
+
+    // The labels of u are the labels of its upward neighbors, extended by the edge to them.
+    // Entries whose distance is not the shortest distance to the hub are pruned; they are never
+    // needed by queries.
+    auto computeLabels = [&](node u, const UpwardGraph &up, std::vector<std::vector<Label>> &labels,
+                             const std::vector<std::vector<Label>> &opposite,
+                             std::vector<Label> &candidates) {
+        candidates.clear();
+        candidates.emplace_back(ranks[u], 0);
+        for (index i = up.offsets[u]; i < up.offsets[u + 1]; ++i)
+            for (const auto &[hub, dist] : labels[up.targets[i]])
+                candidates.emplace_back(hub, dist + up.weights[i]);
+
+        std::ranges::sort(candidates);
+        const auto duplicates = std::ranges::unique(candidates, {}, &Label::first);
+        candidates.erase(duplicates.begin(), duplicates.end());
+
+        auto &labelsU = labels[u];
+        for (const auto &label : candidates)
+            if (label.first == ranks[u]
+                || mergeLabels(candidates, opposite[nodeOfRank[label.first]]) >= label.second)
+                labelsU.push_back(label);
+    };
+
+    for (index d = 0; d <= maxDepth; ++d) {
+#pragma omp parallel
+        {
+            std::vector<Label> candidates;
+#pragma omp for schedule(dynamic, 64)
+            for (omp_index i = static_cast<omp_index>(depthBegin[d]);
+                 i < static_cast<omp_index>(depthBegin[d + 1]); ++i) {
+                const node u = byDepth[i];
+                computeLabels(u, upOut, out, inLabels, candidates);
+                if (directed)
+                    computeLabels(u, upIn, in, out, candidates);
+            }
+        }
+    }
+
+    auto labels = std::make_shared<LabelStorage>();
+    auto flatten = [&](std::vector<std::vector<Label>> &lists, std::vector<index> &offsets,
+                       std::vector<index> &hubs, std::vector<edgeweight> &distances) -> HubLabels {
+        offsets.resize(n + 1);
+        offsets[0] = 0;
+        for (node u = 0; u < n; ++u)
+            offsets[u + 1] = offsets[u] + lists[u].size() + 1;
+        hubs.resize(offsets[n]);
+        distances.resize(offsets[n]);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+            index i = offsets[u];
+            for (const auto &[hub, dist] : lists[u]) {
+                hubs[i] = hub;
+                distances[i++] = dist;
+            }
+            hubs[i] = none;
+            distances[i] = 0;
+            std::vector<Label>().swap(lists[u]);
+        }
+
+        return {offsets, hubs, distances};
+    };
+
+    labelsOut = flatten(out, labels->offsetsOut, labels->hubsOut, labels->distancesOut);
+    if (directed)
+        labelsIn = flatten(in, labels->offsetsIn, labels->hubsIn, labels->distancesIn);
+    else
+        labelsIn = labelsOut;
+    labelStorage = std::move(labels);
+}
+
+edgeweight ContractionHierarchy::distance(node u, node v) const {
+    assureFinished();
+    if (!hubLabels)
+        throw std::runtime_error("The index has no hub labels, use ContractionHierarchyQuery");
+    assert(u < ranks.size() && v < ranks.size());
+    if (u == v)
+        return 0;
+
+    const index *hubsU = labelsOut.hubs.data() + labelsOut.offsets[u];
+    const index *hubsV = labelsIn.hubs.data() + labelsIn.offsets[v];
+    const edgeweight *distancesU = labelsOut.distances.data() + labelsOut.offsets[u];
+    const edgeweight *distancesV = labelsIn.distances.data() + labelsIn.offsets[v];
+
+    // Both lists end with the sentinel none, so only equal hubs need to be checked for the end.
+    edgeweight result = infDist;
+    index i = 0, j = 0;
+    while (true) {
+        const index a = hubsU[i], b = hubsV[j];
+        if (a == b) {
+            if (a == none)
+                break;
+            result = std::min(result, distancesU[i] + distancesV[j]);
+            ++i;
+            ++j;
+        } else {
+            i += a < b;
+            j += b < a;
+        }
+    }
+
+    return result;
+}
+
+count ContractionHierarchy::numberOfLabels() const {
+    assureFinished();
+    if (!hubLabels)
+        return 0;
+
+    // Do not count the sentinels
+    count labels = labelsOut.hubs.size() - ranks.size();
+    if (directed)
+        labels += labelsIn.hubs.size() - ranks.size();
+    return labels;
+}
+
+std::pair<edgeweight, node> ContractionHierarchy::findEdge(node u, node v) const {
+    // The edge is stored at the endpoint of lower rank.
+    const bool upward = ranks[u] < ranks[v];
+    const UpwardGraph &up = upward ? upOut : upIn;
+    const node from = upward ? u : v, to = upward ? v : u;
+    for (index i = up.offsets[from]; i < up.offsets[from + 1]; ++i)
+        if (up.targets[i] == to)
+            return {up.weights[i], up.middles[i]};
+
+    assert(false);
+    return {infDist, none};
+}
+
+void ContractionHierarchy::save(std::string_view path) const {
+    assureFinished();
+
+    std::ofstream outfile(path.data(), std::ios::binary);
+    Aux::enforceOpened(outfile);
+
+    // Assign page-aligned offsets to all sections.
+    IndexHeader header{};
+    uint64_t nextOffset = sizeof(IndexHeader);
+    auto reserve = [&](Section section, uint64_t bytes) {
+        nextOffset = (nextOffset + INDEX_ALIGNMENT - 1) / INDEX_ALIGNMENT * INDEX_ALIGNMENT;
+        header.sections[section] = nextOffset;
+        nextOffset += bytes;
+    };
+
+    strncpy(header.magic, "nkch01", 8);
+    header.features = (directed ? DIRECTED_MASK : 0)
+                      | (sizeof(index) == sizeof(uint32_t) ? INDEX_32BIT_MASK : 0)
+                      | (hubLabels ? HUB_LABELS_MASK : 0);
+    header.nodes = ranks.size();
+    header.shortcuts = shortcuts;
+    header.edgesOut = upOut.targets.size();
+    reserve(RANKS, ranks.size_bytes());
+    reserve(OUT_OFFSETS, upOut.offsets.size_bytes());
+    reserve(OUT_TARGETS, upOut.targets.size_bytes());
+    reserve(OUT_WEIGHTS, upOut.weights.size_bytes());
+    reserve(OUT_MIDDLES, upOut.middles.size_bytes());
+    if (directed) {
+        header.edgesIn = upIn.targets.size();
+        reserve(IN_OFFSETS, upIn.offsets.size_bytes());
+        reserve(IN_TARGETS, upIn.targets.size_bytes());
+        reserve(IN_WEIGHTS, upIn.weights.size_bytes());
+        reserve(IN_MIDDLES, upIn.middles.size_bytes());
+    }
+    if (hubLabels) {
+        header.entriesOut = labelsOut.hubs.size();
+        reserve(LABELS_OUT_OFFSETS, labelsOut.offsets.size_bytes());
+        reserve(LABELS_OUT_HUBS, labelsOut.hubs.size_bytes());
+        reserve(LABELS_OUT_DISTANCES, labelsOut.distances.size_bytes());
+        if (directed) {
+            header.entriesIn = labelsIn.hubs.size();
+            reserve(LABELS_IN_OFFSETS, labelsIn.offsets.size_bytes());
+            reserve(LABELS_IN_HUBS, labelsIn.hubs.size_bytes());
+            reserve(LABELS_IN_DISTANCES, labelsIn.distances.size_bytes());
+        }
+    }
+
+    uint64_t position = 0;
+    auto writeBytes = [&](const void *data, uint64_t bytes) {
+        outfile.write(static_cast<const char *>(data), bytes);
+        position += bytes;
+    };
+    auto writeSection = [&](Section section, const auto &data) {
+        if (!header.sections[section])
+            return;
+        assert(position <= header.sections[section]);
+        const std::vector<char> zeros(header.sections[section] - position, 0);
+        writeBytes(zeros.data(), zeros.size());
+        writeBytes(data.data(), data.size_bytes());
+    };
+
+    // The sections have been reserved in the order of the Section enum.
+    writeBytes(&header, sizeof(IndexHeader));
+    writeSection(RANKS, ranks);
+    writeSection(OUT_OFFSETS, upOut.offsets);
+    writeSection(OUT_TARGETS, upOut.targets);
+    writeSection(OUT_WEIGHTS, upOut.weights);
+    writeSection(OUT_MIDDLES, upOut.middles);
+    writeSection(IN_OFFSETS, upIn.offsets);
+    writeSection(IN_TARGETS, upIn.targets);
+    writeSection(IN_WEIGHTS, upIn.weights);
+    writeSection(IN_MIDDLES, upIn.middles);
+    writeSection(LABELS_OUT_OFFSETS, labelsOut.offsets);
+    writeSection(LABELS_OUT_HUBS, labelsOut.hubs);
+    writeSection(LABELS_OUT_DISTANCES, labelsOut.distances);
+    writeSection(LABELS_IN_OFFSETS, labelsIn.offsets);
+    writeSection(LABELS_IN_HUBS, labelsIn.hubs);
+    writeSection(LABELS_IN_DISTANCES, labelsIn.distances);
+
+    if (!outfile)
+        throw std::runtime_error("Could not write the index");
+}
+
+} // namespace NetworKit
@@ -0,0 +1,165 @@
+/*
+ * ContractionHierarchyQuery.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <networkit/distance/ContractionHierarchyQuery.hpp>
+
+namespace NetworKit {
+
+void ContractionHierarchyQuery::checkHierarchy() const {
+    if (ch->upperNodeIdBound() != G->upperNodeIdBound())
+        throw std::runtime_error("The contraction hierarchy does not belong to the graph");
+}
+
+void ContractionHierarchyQuery::run() {
+    init();
+
+    if (targets.empty()) {
+        if (source == target) {
+            distance = 0;
+            path.clear();
+        } else if (!storePred && ch->hasHubLabels()) {
+            distance = ch->distance(source, target);
+        } else {
+            node meeting;
+            distance = search(source, target, meeting);
+            if (storePred && meeting != none) {
+                // Path in the hierarchy: upwards from the source to the meeting node, then
+                // downwards to the target.
+                std::vector<node> hierarchyPath;
+                for (node u = meeting; u != source; u = predOut[u])
+                    hierarchyPath.push_back(u);
+                hierarchyPath.push_back(source);
+                std::ranges::reverse(hierarchyPath);
+                for (node u = meeting; u != target;) {
+                    u = predIn[u];
+                    hierarchyPath.push_back(u);
+                }
+
+                std::vector<node> nodes{source};
+                for (index i = 0; i + 1 < hierarchyPath.size(); ++i) {
+                    unpackEdge(hierarchyPath[i], hierarchyPath[i + 1], nodes);
+                    nodes.push_back(hierarchyPath[i + 1]);
+                }
+                for (index i = 0; i + 1 < nodes.size(); ++i)
+                    pred[nodes[i + 1]] = nodes[i];
+                buildPath();
+            } else if (storePred) {
+                path.clear();
+                WARN("Source cannot reach target!");
+            }
+        }
+    } else {
+        distances.clear();
+        distances.reserve(targets.size());
+        targetIdx.clear();
+        for (const node t : targets) {
+            targetIdx.emplace(t, distances.size());
+            node meeting;
+            distances.push_back(ch->hasHubLabels() ? ch->distance(source, t)
+                                                   : search(source, t, meeting));
+        }
+    }
+
+    hasRun = true;
+}
+
+edgeweight ContractionHierarchyQuery::search(node s, node t, node &meeting) {
+    constexpr edgeweight infDist = std::numeric_limits<edgeweight>::max();
+    const count n = G->upperNodeIdBound();
+    if (distOut.size() != n) {
+        distOut.assign(n, infDist);
+        distIn.assign(n, infDist);
+        predOut.resize(n);
+        predIn.resize(n);
+        touched.clear();
+    }
+
+    for (const node u : touched)
+        distOut[u] = distIn[u] = infDist;
+    touched.clear();
+    heapOut.clear();
+    heapIn.clear();
+
+    meeting = s;
+    if (s == t)
+        return 0;
+
+    distOut[s] = distIn[t] = 0;
+    predOut[s] = s;
+    predIn[t] = t;
+    touched.push_back(s);
+    touched.push_back(t);
+    heapOut.push(s);
+    heapIn.push(t);
+
+    edgeweight best = infDist;
+    meeting = none;
+    bool forward = true;
+    while (!heapOut.empty() || !heapIn.empty()) {
+        if (heapOut.empty())
+            forward = false;
+        else if (heapIn.empty())
+            forward = true;
+
+        auto &heap = forward ? heapOut : heapIn;
+        auto &dist = forward ? distOut : distIn;
+        auto &pred = forward ? predOut : predIn;
+        const auto &otherDist = forward ? distIn : distOut;
+        const auto &up = forward ? ch->upOut : ch->upIn;
+        const auto &down = forward ? ch->upIn : ch->upOut;
+        forward = !forward;
+
+        const node u = heap.extract_top();
+        const edgeweight du = dist[u];
+        if (du >= best) {
+            // All remaining nodes of this direction are at least as far away
+            heap.clear();
+            continue;
+        }
+        if (otherDist[u] != infDist && du + otherDist[u] < best) {
+            best = du + otherDist[u];
+            meeting = u;
+        }
+
+        // Stall u if a node of higher rank reaches it on a shorter path; then, u cannot be on a
+        // shortest path found by this search.
+        bool stalled = false;
+        for (index i = down.offsets[u]; i < down.offsets[u + 1] && !stalled; ++i)
+            stalled = dist[down.targets[i]] != infDist
+                      && dist[down.targets[i]] + down.weights[i] < du;
+        if (stalled)
+            continue;
+
+        for (index i = up.offsets[u]; i < up.offsets[u + 1]; ++i) {
+            const node v = up.targets[i];
+            const edgeweight dv = du + up.weights[i];
+            if (dv < dist[v]) {
+                if (distOut[v] == infDist && distIn[v] == infDist)
+                    touched.push_back(v);
+                dist[v] = dv;
+                pred[v] = u;
+                heap.update(v);
+            }
+        }
+    }
+
+    return best;
+}
+
+void ContractionHierarchyQuery::unpackEdge(node u, node v, std::vector<node> &nodes) const {
+    const node middle = ch->findEdge(u, v).second;
+    if (middle == none)
+        return;
+    unpackEdge(u, middle, nodes);
+    nodes.push_back(middle);
+    unpackEdge(middle, v, nodes);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,184 @@
+/*
+ * DeltaStepping.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <omp.h>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
+
+namespace NetworKit {
+
+DeltaStepping::DeltaStepping(const Graph &G, node source, bool storePaths,
+                             bool storeNodesSortedByDistance, node target)
+    : SSSP(G, source, storePaths, storeNodesSortedByDistance, target) {}
+
+edgeweight DeltaStepping::maxEdgeWeight() const {
+    if (!G->isWeighted())
+        return 1;
+
+    edgeweight maxWeight = 0;
+#pragma omp parallel for reduction(max : maxWeight)
+    for (omp_index u = 0; u < static_cast<omp_index>(G->upperNodeIdBound()); ++u)
+        if (G->hasNode(u))
+            G->forNeighborsOf(u, [&](node, edgeweight w) { maxWeight = std::max(maxWeight, w); });
+    return maxWeight;
+}
+
+void DeltaStepping::run() {
+    const count z = G->upperNodeIdBound();
+    constexpr auto infDist = std::numeric_limits<edgeweight>::max();
+    std::fill(distances.begin(), distances.end(), infDist);
+    if (distances.size() < z)
+        distances.resize(z, infDist);
+
+    const edgeweight maxWeight = maxEdgeWeight();
+    edgeweight width = delta;
+    if (width <= 0) {
+        // Maximum edge weight divided by the average degree (at least one)
+        const count arcs = (G->isDirected() ? 1 : 2) * G->numberOfEdges();
+        width = maxWeight * static_cast<double>(G->numberOfNodes())
+                / static_cast<double>(std::max(arcs, G->numberOfNodes()));
+        if (width <= 0)
+            width = 1;
+    }
+    auto bucketOf = [width](edgeweight dist) -> index { return static_cast<index>(dist / width); };
+
+    // Relaxing the edges of bucket b only fills buckets b, ..., b + maxWeight / width, so the
+    // pending buckets fit into a cyclic array (with one more slot to absorb rounding).
+    const count slots = static_cast<count>(maxWeight / width) + 2;
+
+    distances[source] = 0;
+    std::vector<node> frontier{source};
+    index bucket = 0, nextBucket = none;
+
+#pragma omp parallel
+    {
+        // Buckets of the nodes whose distances have been decreased by this thread; bucket b is
+        // stored in slot b % slots. A node can be in several buckets; entries of nodes that have
+        // moved to smaller buckets are skipped.
+        std::vector<std::vector<node>> buckets(slots);
+
+        while (bucket != none) {
+#pragma omp for schedule(dynamic, 64) nowait
+            for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+                const node u = frontier[i];
+                const edgeweight du =
+                    std::atomic_ref<edgeweight>(distances[u]).load(std::memory_order_relaxed);
+                if (bucketOf(du) < bucket)
+                    continue;
+
+                G->forNeighborsOf(u, [&](node v, edgeweight w) {
+                    const edgeweight newDist = du + w;
+                    std::atomic_ref<edgeweight> dv(distances[v]);
+                    edgeweight oldDist = dv.load(std::memory_order_relaxed);
+                    while (newDist < oldDist) {
+                        if (dv.compare_exchange_weak(oldDist, newDist,
+                                                     std::memory_order_relaxed)) {
+                            buckets[bucketOf(newDist) % slots].push_back(v);
+                            break;
+                        }
+                    }
+                });
+            }
+
+            // The next bucket is the smallest non-empty bucket of all threads; the current one is
+            // processed again if it has been refilled.
+            for (index b = bucket; b < bucket + slots; ++b) {
+                if (!buckets[b % slots].empty()) {
+                    std::atomic_ref<index> next(nextBucket);
+                    index current = next.load(std::memory_order_relaxed);
+                    while (b < current && !next.compare_exchange_weak(current, b))
+                        ;
+                    break;
+                }
+            }
+
+#pragma omp barrier
+#pragma omp single
+            {
+                // Once the bucket of the target has been processed, its distance is final.
+                if (target != none && distances[target] != infDist
+                    && bucketOf(distances[target]) < nextBucket)
+                    nextBucket = none;
+                bucket = nextBucket;
+                nextBucket = none;
+                frontier.clear();
+            }
+
+            if (bucket != none && !buckets[bucket % slots].empty()) {
+                auto &current = buckets[bucket % slots];
+#pragma omp critical
+                frontier.insert(frontier.end(), current.begin(), current.end());
+                current.clear();
+            }
+#pragma omp barrier
+        }
+    }
+
+    count reached = 0;
+    double sum = 0;
+#pragma omp parallel for reduction(+ : reached, sum)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+        if (distances[u] != infDist) {
+            ++reached;
+            sum += distances[u];
+        }
+    }
+    reachedNodes = reached;
+    sumDist = sum;
+
+    if (storePaths || storeNodesSortedByDistance)
+        computePaths();
+
+    hasRun = true;
+}
+
+void DeltaStepping::computePaths() {
+    const count z = G->upperNodeIdBound();
+    constexpr auto infDist = std::numeric_limits<edgeweight>::max();
+
+    std::vector<node> sorted;
+    sorted.reserve(reachedNodes);
+    for (node u = 0; u < z; ++u)
+        if (distances[u] != infDist)
+            sorted.push_back(u);
+    Aux::Parallel::sort(sorted.begin(), sorted.end(), [&](node u, node v) {
+        return distances[u] < distances[v] || (distances[u] == distances[v] && u < v);
+    });
+
+    if (storePaths) {
+        previous.clear();
+        previous.resize(z);
+        npaths.clear();
+        npaths.resize(z, 0);
+        npaths[source] = 1;
+
+        // The predecessors of a node are the in-neighbors whose distances plus the edge weights
+        // yield exactly its distance. This is the same floating-point sum as in the search.
+#pragma omp parallel for schedule(dynamic, 64)
+        for (omp_index i = 0; i < static_cast<omp_index>(sorted.size()); ++i) {
+            const node v = sorted[i];
+            if (v == source)
+                continue;
+            G->forInNeighborsOf(v, [&](node u, edgeweight w) {
+                if (distances[u] != infDist && distances[u] + w == distances[v])
+                    previous[v].push_back(u);
+            });
+        }
+
+        for (const node v : sorted)
+            for (const node u : previous[v])
+                npaths[v] += npaths[u];
+    }
+
+    if (storeNodesSortedByDistance)
+        nodesSortedByDistance = std::move(sorted);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,50 @@
+/*
+ * MultiSourceBFS.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <cassert>
+#include <stdexcept>
+
+#include <networkit/distance/MultiSourceBFS.hpp>
+
+namespace NetworKit {
+
+MultiSourceBFS::MultiSourceBFS(const Graph &G) : G(&G) {}
+
+MultiSourceBFS::MultiSourceBFS(const CSRGraph &G) : csr(&G) {}
+
+void MultiSourceBFS::initialize(std::span<const node> sources) {
+    if (sources.size() > maxSources)
+        throw std::runtime_error("MultiSourceBFS supports at most 64 sources per run");
+
+    const count z = csr ? csr->upperNodeIdBound() : G->upperNodeIdBound();
+    if (seen.size() != z) {
+        seen.assign(z, 0);
+        frontier.assign(z, 0);
+        next.assign(z, 0);
+    } else {
+        // Only the nodes reached in the previous run have non-zero masks
+        for (const node u : visited)
+            seen[u] = 0;
+    }
+
+    visited.clear();
+    visitedMasks.clear();
+    levelBegin.assign(1, 0);
+
+    for (index i = 0; i < sources.size(); ++i) {
+        const node s = sources[i];
+        assert(csr ? csr->hasNode(s) : G->hasNode(s));
+        if (!seen[s])
+            visited.push_back(s);
+        seen[s] |= SourceMask{1} << i;
+    }
+    for (const node s : visited) {
+        frontier[s] = seen[s];
+        visitedMasks.push_back(seen[s]);
+    }
+}
+
+} // namespace NetworKit
@@ -1,16 +1,57 @@
 #include <algorithm>
-#include <queue>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <omp.h>
+#include <stdexcept>
 #include <vector>
 
+#include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/distance/PrunedLandmarkLabeling.hpp>
 #include <networkit/graph/Graph.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
 
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Header of an index file (magic "nkpll01"). All sections start at a multiple of
+ * INDEX_ALIGNMENT, so they can be used in place after mapping the file into memory. The
+ * in-label sections are absent (offset zero) for undirected graphs.
+ */
+struct IndexHeader {
+    char magic[8];
+    uint64_t features;
+    uint64_t nodes;
+    uint64_t entriesOut;
+    uint64_t entriesIn;
+    uint64_t offsetOutOffsets;
+    uint64_t offsetOutHubs;
+    uint64_t offsetOutDistances;
+    uint64_t offsetInOffsets;
+    uint64_t offsetInHubs;
+    uint64_t offsetInDistances;
+};
+
+constexpr uint64_t INDEX_ALIGNMENT = 4096;
+constexpr uint64_t DIRECTED_MASK = 0x1;    // bit 0
+constexpr uint64_t INDEX_32BIT_MASK = 0x2; // bit 1
+
+// Owns the flattened labels computed by run()
+struct FlatStorage {
+    std::vector<index> offsetsOut, offsetsIn;
+    std::vector<node> hubsOut, hubsIn;
+    std::vector<uint32_t> distancesOut, distancesIn;
+};
+
+} // namespace
+
 PrunedLandmarkLabeling::PrunedLandmarkLabeling(const Graph &G)
-    : G(&G), nodesSortedByDegreeDesc(G.nodeRange().begin(), G.nodeRange().end()) {
+    : G(&G), nodesSortedByDegreeDesc(G.nodeRange().begin(), G.nodeRange().end()),
+      directed(G.isDirected()) {
 
     if (G.isWeighted())
         WARN("This algorithm ignores edge weights.");
@@ -37,67 +78,280 @@ PrunedLandmarkLabeling::PrunedLandmarkLabeling(const Graph &G)
     labelsVCopy.reserve(G.upperNodeIdBound());
 }
 
-template <bool Reverse>
-void PrunedLandmarkLabeling::prunedBFS(node root, node rankOfRootNode) {
-    std::fill(visited.begin(), visited.end(), false);
-    visited[root] = true;
+PrunedLandmarkLabeling::PrunedLandmarkLabeling(std::string_view path) : G(nullptr) {
+    auto mmfile = std::make_shared<MemoryMappedFile>(path);
+    const char *data = mmfile->cbegin();
+    const size_t size = mmfile->size();
 
-    std::queue<node> q1, q2;
-    q1.push(root);
+    IndexHeader header;
+    if (size < sizeof(IndexHeader))
+        throw std::runtime_error("File is too small to contain a distance labeling");
+    memcpy(&header, data, sizeof(IndexHeader));
+    if (memcmp("nkpll01", header.magic, 8))
+        throw std::runtime_error("Reader expected another magic value");
+    if (static_cast<bool>(header.features & INDEX_32BIT_MASK)
+        != (sizeof(index) == sizeof(uint32_t)))
+        throw std::runtime_error("Index was written with a different node id width");
+    if (header.nodes == none)
+        throw std::runtime_error("Invalid number of nodes");
 
-    index level = 0;
+    directed = header.features & DIRECTED_MASK;
+    auto mapLabels = [&](uint64_t offsetOffsets, uint64_t offsetHubs, uint64_t offsetDistances,
+                         uint64_t entries, FlatLabels &labels) {
+        labels.offsets = mappedSection<index>(data, size, offsetOffsets, header.nodes + 1);
+        labels.hubs = mappedSection<node>(data, size, offsetHubs, entries);
+        labels.distances = mappedSection<uint32_t>(data, size, offsetDistances, entries);
+        if (!validOffsets(labels.offsets, entries) || labels.hubs.size() != entries
+            || labels.distances.size() != entries)
+            throw std::runtime_error("Invalid labels in the index file");
 
-    const auto visitNeighbor = [&](node v) -> void {
-        if (visited[v])
-            return;
-        visited[v] = true;
-        q2.push(v);
+        // Queries merge the lists without bound checks, so every list must end with the
+        // sentinel; the other hubs are ranks of nodes.
+        for (node u = 0; u < header.nodes; ++u) {
+            const index end = labels.offsets[u + 1];
+            if (end == labels.offsets[u] || labels.hubs[end - 1] != none)
+                throw std::runtime_error("Invalid labels in the index file");
+        }
+        for (const node hub : labels.hubs)
+            if (hub >= header.nodes && hub != none)
+                throw std::runtime_error("Invalid labels in the index file");
     };
+    mapLabels(header.offsetOutOffsets, header.offsetOutHubs, header.offsetOutDistances,
+              header.entriesOut, flatOut);
+    if (directed)
+        mapLabels(header.offsetInOffsets, header.offsetInHubs, header.offsetInDistances,
+                  header.entriesIn, flatIn);
 
-    do {
-        do {
-            const node u = q1.front();
-            q1.pop();
-            if constexpr (Reverse) {
-                if (u != root && queryImpl(u, root) <= level)
-                    continue;
-            } else {
-                if (u != root && queryImpl(root, u) <= level)
-                    continue;
-            }
+    storage = std::move(mmfile);
+    flattened = true;
+    hasRun = true;
+}
 
-            if constexpr (Reverse) {
-                labelsIn[u].emplace_back(rankOfRootNode, level);
-                G->forInNeighborsOf(u, visitNeighbor);
-            } else {
-                labelsOut[u].emplace_back(rankOfRootNode, level);
-                G->forNeighborsOf(u, visitNeighbor);
-            }
+template <bool Reverse>
+void PrunedLandmarkLabeling::computeLevel(count level, const std::vector<index> &rank,
+                                          const std::vector<index> &levelBegin,
+                                          const std::vector<node> &frontier,
+                                          std::vector<std::vector<Label>> &next,
+                                          std::vector<LevelBuffers> &buffers) {
+    auto &labels = Reverse ? labelsIn : labelsOut;
+    // The distances between the root and the hubs of its labels, in the opposite direction
+    const auto &rootLabels = directed ? (Reverse ? labelsOut : labelsIn) : labelsOut;
+    const count n = G->numberOfNodes();
+
+#pragma omp parallel
+    {
+        auto &buffer = buffers[omp_get_thread_num()];
+        if (buffer.distances.size() != n) {
+            // First level: the thread that uses the arrays allocates them.
+            buffer.distances.assign(n, infDist);
+            buffer.isCandidate.assign(n, 0);
+        }
+        auto &distances = buffer.distances;
+        auto &isCandidate = buffer.isCandidate;
+        auto &candidates = buffer.candidates;
+
+#pragma omp for schedule(dynamic, 64)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+            const node v = frontier[i];
+            next[v].clear();
 
-        } while (!q1.empty());
+            // Candidates are the hubs of the labels of the previous level of the neighbors of v
+            // (in-neighbors for out-labels) that are ranked higher than v.
+            candidates.clear();
+            auto collect = [&](node u) {
+                for (index j = levelBegin[u]; j < labels[u].size(); ++j) {
+                    const node r = labels[u][j].node_;
+                    if (r < rank[v] && !isCandidate[r]) {
+                        isCandidate[r] = 1;
+                        candidates.push_back(r);
+                    }
+                }
+            };
+            if constexpr (Reverse)
+                G->forNeighborsOf(v, collect);
+            else
+                G->forInNeighborsOf(v, collect);
+            if (candidates.empty())
+                continue;
 
-        ++level;
-        std::swap(q1, q2);
-    } while (!q1.empty());
+            for (const auto &label : labels[v])
+                distances[label.node_] = label.distance_;
+
+            for (const node r : candidates) {
+                isCandidate[r] = 0;
+                // Prune if a hub of higher rank already covers the distance level; this also
+                // covers candidates with an existing label of smaller distance.
+                bool pruned = false;
+                for (const auto &label : rootLabels[nodesSortedByDegreeDesc[r]]) {
+                    if (distances[label.node_] != infDist
+                        && label.distance_ + distances[label.node_] <= level) {
+                        pruned = true;
+                        break;
+                    }
+                }
+                if (!pruned)
+                    next[v].emplace_back(r, level);
+            }
+
+            for (const auto &label : labels[v])
+                distances[label.node_] = infDist;
+        }
+    }
 }
 
 void PrunedLandmarkLabeling::run() {
-    index rankOfRootNode = 0;
-    for (node root : nodesSortedByDegreeDesc) {
-        prunedBFS(root, rankOfRootNode);
-        if (G->isDirected())
-            prunedBFS<true>(root, rankOfRootNode);
-        ++rankOfRootNode;
+    if (!G)
+        throw std::runtime_error("The index has been loaded from a file");
+
+    const count z = G->upperNodeIdBound();
+    std::vector<index> rank(z, none);
+    for (index r = 0; r < nodesSortedByDegreeDesc.size(); ++r)
+        rank[nodesSortedByDegreeDesc[r]] = r;
+
+    // Level 0: every node is a hub of itself.
+    G->parallelForNodes([&](node u) {
+        labelsOut[u].assign(1, Label(rank[u], 0));
+        if (directed)
+            labelsIn[u].assign(1, Label(rank[u], 0));
+    });
+
+    // The labels of the previous level of u start at levelBegin[u]; changed contains the nodes
+    // that got labels in the previous level and frontier their neighbors.
+    std::vector<index> levelBeginOut(z, 0), levelBeginIn(directed ? z : 0, 0);
+    std::vector<std::vector<Label>> nextOut(z), nextIn(directed ? z : 0);
+    std::vector<node> changedOut, changedIn, frontierOut, frontierIn;
+    G->forNodes([&](node u) { changedOut.push_back(u); });
+    if (directed)
+        changedIn = changedOut;
+
+    std::vector<uint8_t> inFrontier(z, 0);
+    std::vector<std::vector<node>> localNodes(omp_get_max_threads());
+    std::vector<LevelBuffers> buffers(omp_get_max_threads());
+    auto gather = [&](std::vector<node> &result) {
+        result.clear();
+        for (auto &nodes : localNodes) {
+            result.insert(result.end(), nodes.begin(), nodes.end());
+            nodes.clear();
+        }
+    };
+
+    // Out-labels are derived from the labels of in-neighbors, so the out-neighbors of changed
+    // nodes form the frontier (and vice versa for in-labels).
+    auto computeFrontier = [&](const std::vector<node> &changed, bool reverse,
+                               std::vector<node> &frontier) {
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(changed.size()); ++i) {
+            auto &local = localNodes[omp_get_thread_num()];
+            auto visit = [&](node v) {
+                uint8_t old;
+#pragma omp atomic capture
+                {
+                    old = inFrontier[v];
+                    inFrontier[v] = 1;
+                }
+                if (!old)
+                    local.push_back(v);
+            };
+            if (reverse)
+                G->forInNeighborsOf(changed[i], visit);
+            else
+                G->forNeighborsOf(changed[i], visit);
+        }
+        gather(frontier);
+        for (const node v : frontier)
+            inFrontier[v] = 0;
+    };
+
+    auto append = [&](std::vector<std::vector<Label>> &labels, std::vector<index> &levelBegin,
+                      const std::vector<node> &frontier, std::vector<std::vector<Label>> &next,
+                      std::vector<node> &changed) {
+        for (const node u : changed)
+            levelBegin[u] = labels[u].size();
+#pragma omp parallel for schedule(guided)
+        for (omp_index i = 0; i < static_cast<omp_index>(frontier.size()); ++i) {
+            const node v = frontier[i];
+            if (next[v].empty())
+                continue;
+            levelBegin[v] = labels[v].size();
+            labels[v].insert(labels[v].end(), next[v].begin(), next[v].end());
+            localNodes[omp_get_thread_num()].push_back(v);
+        }
+        gather(changed);
+    };
+
+    for (count level = 1; !changedOut.empty() || !changedIn.empty(); ++level) {
+        computeFrontier(changedOut, false, frontierOut);
+        if (directed)
+            computeFrontier(changedIn, true, frontierIn);
+
+        // Both directions read the labels of the previous levels only, so they are appended after
+        // both have been computed.
+        computeLevel<false>(level, rank, levelBeginOut, frontierOut, nextOut, buffers);
+        if (directed)
+            computeLevel<true>(level, rank, levelBeginIn, frontierIn, nextIn, buffers);
+
+        append(labelsOut, levelBeginOut, frontierOut, nextOut, changedOut);
+        if (directed)
+            append(labelsIn, levelBeginIn, frontierIn, nextIn, changedIn);
     }
 
+    // Queries merge the labels by rank
+    G->parallelForNodes([&](node u) {
+        auto byRank = [](const Label &a, const Label &b) { return a.node_ < b.node_; };
+        std::sort(labelsOut[u].begin(), labelsOut[u].end(), byRank);
+        if (directed)
+            std::sort(labelsIn[u].begin(), labelsIn[u].end(), byRank);
+    });
+
+    if (!keepLabelLists)
+        flattenLabels();
+
     hasRun = true;
 }
 
+void PrunedLandmarkLabeling::flattenLabels() {
+    auto flatStorage = std::make_shared<FlatStorage>();
+
+    auto flatten = [&](std::vector<std::vector<Label>> &labels, std::vector<index> &offsets,
+                       std::vector<node> &hubs, std::vector<uint32_t> &distances,
+                       FlatLabels &flat) {
+        const count z = labels.size();
+        offsets.assign(z + 1, 0);
+        for (index u = 0; u < z; ++u)
+            offsets[u + 1] = offsets[u] + labels[u].size() + 1;
+        hubs.resize(offsets.back());
+        distances.resize(offsets.back());
+
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            index pos = offsets[u];
+            for (const auto &label : labels[u]) {
+                hubs[pos] = label.node_;
+                distances[pos++] = static_cast<uint32_t>(label.distance_);
+            }
+            hubs[pos] = none;
+            distances[pos] = 0;
+            std::vector<Label>().swap(labels[u]);
+        }
+
+        flat = {offsets, hubs, distances};
+    };
+
+    flatten(labelsOut, flatStorage->offsetsOut, flatStorage->hubsOut, flatStorage->distancesOut,
+            flatOut);
+    if (directed)
+        flatten(labelsIn, flatStorage->offsetsIn, flatStorage->hubsIn, flatStorage->distancesIn,
+                flatIn);
+
+    storage = std::move(flatStorage);
+    flattened = true;
+}
+
 count PrunedLandmarkLabeling::queryImpl(node u, node v, node upperBound) const {
     if (u == v)
         return 0;
 
-    auto [iterLabelsU, iterLabelsUEnd] = getSourceLabelsIterators(u, G->isDirected());
+    auto [iterLabelsU, iterLabelsUEnd] = getSourceLabelsIterators(u, directed);
     auto [iterLabelsV, iterLabelsVEnd] = getSourceLabelsIterators(v);
 
     count result = infDist;
@@ -120,9 +374,140 @@ count PrunedLandmarkLabeling::queryImpl(node u, node v, node upperBound) const {
     return result;
 }
 
+count PrunedLandmarkLabeling::queryFlat(const FlatLabels &source, node u,
+                                        const FlatLabels &target, node v) {
+    const node *hubsU = source.hubs.data() + source.offsets[u];
+    const node *hubsV = target.hubs.data() + target.offsets[v];
+    const uint32_t *distancesU = source.distances.data() + source.offsets[u];
+    const uint32_t *distancesV = target.distances.data() + target.offsets[v];
+
+    // Both lists end with the sentinel none, so only equal hubs need to be checked for the end.
+    count result = infDist;
+    index i = 0, j = 0;
+    while (true) {
+        const node a = hubsU[i], b = hubsV[j];
+        if (a == b) {
+            if (a == none)
+                break;
+            result = std::min<count>(result, static_cast<count>(distancesU[i]) + distancesV[j]);
+            ++i;
+            ++j;
+        } else {
+            i += a < b;
+            j += b < a;
+        }
+    }
+
+    return result;
+}
+
 count PrunedLandmarkLabeling::query(node u, node v) const {
     assureFinished();
-    return queryImpl(u, v);
+    if (!flattened)
+        return queryImpl(u, v);
+    if (u == v)
+        return 0;
+    assert(u + 1 < flatOut.offsets.size() && v + 1 < flatOut.offsets.size());
+    return queryFlat(directed ? flatIn : flatOut, u, flatOut, v);
+}
+
+count PrunedLandmarkLabeling::numberOfLabels() const {
+    assureFinished();
+    if (flattened) {
+        // Do not count the sentinels
+        count labels = flatOut.hubs.size() - (flatOut.offsets.size() - 1);
+        if (directed)
+            labels += flatIn.hubs.size() - (flatIn.offsets.size() - 1);
+        return labels;
+    }
+
+    count labels = 0;
+    for (const auto &labelsU : labelsOut)
+        labels += labelsU.size();
+    for (const auto &labelsU : labelsIn)
+        labels += labelsU.size();
+    return labels;
+}
+
+void PrunedLandmarkLabeling::save(std::string_view path) const {
+    assureFinished();
+
+    // Labels that are kept in lists (e.g., by DynPrunedLandmarkLabeling) are flattened first.
+    FlatStorage lists;
+    FlatLabels out = flatOut, in = flatIn;
+    if (!flattened) {
+        auto flatten = [](const std::vector<std::vector<Label>> &labels,
+                          std::vector<index> &offsets, std::vector<node> &hubs,
+                          std::vector<uint32_t> &distances) -> FlatLabels {
+            offsets.assign(1, 0);
+            for (const auto &labelsU : labels) {
+                for (const auto &label : labelsU) {
+                    hubs.push_back(label.node_);
+                    distances.push_back(static_cast<uint32_t>(label.distance_));
+                }
+                hubs.push_back(none);
+                distances.push_back(0);
+                offsets.push_back(hubs.size());
+            }
+            return {offsets, hubs, distances};
+        };
+        out = flatten(labelsOut, lists.offsetsOut, lists.hubsOut, lists.distancesOut);
+        if (directed)
+            in = flatten(labelsIn, lists.offsetsIn, lists.hubsIn, lists.distancesIn);
+    }
+
+    std::ofstream outfile(path.data(), std::ios::binary);
+    Aux::enforceOpened(outfile);
+
+    // Assign page-aligned offsets to all sections.
+    IndexHeader header{};
+    uint64_t nextOffset = sizeof(IndexHeader);
+    auto reserve = [&](uint64_t bytes) -> uint64_t {
+        nextOffset = (nextOffset + INDEX_ALIGNMENT - 1) / INDEX_ALIGNMENT * INDEX_ALIGNMENT;
+        const uint64_t offset = nextOffset;
+        nextOffset += bytes;
+        return offset;
+    };
+
+    strncpy(header.magic, "nkpll01", 8);
+    header.features = (directed ? DIRECTED_MASK : 0)
+                      | (sizeof(index) == sizeof(uint32_t) ? INDEX_32BIT_MASK : 0);
+    header.nodes = out.offsets.size() - 1;
+    header.entriesOut = out.hubs.size();
+    header.offsetOutOffsets = reserve(out.offsets.size_bytes());
+    header.offsetOutHubs = reserve(out.hubs.size_bytes());
+    header.offsetOutDistances = reserve(out.distances.size_bytes());
+    if (directed) {
+        header.entriesIn = in.hubs.size();
+        header.offsetInOffsets = reserve(in.offsets.size_bytes());
+        header.offsetInHubs = reserve(in.hubs.size_bytes());
+        header.offsetInDistances = reserve(in.distances.size_bytes());
+    }
+
+    uint64_t position = 0;
+    auto writeBytes = [&](const void *data, uint64_t bytes) {
+        outfile.write(static_cast<const char *>(data), bytes);
+        position += bytes;
+    };
+    auto writeSection = [&](uint64_t offset, const auto &section) {
+        assert(position <= offset);
+        const std::vector<char> zeros(offset - position, 0);
+        writeBytes(zeros.data(), zeros.size());
+        writeBytes(section.data(), section.size_bytes());
+    };
+
+    writeBytes(&header, sizeof(IndexHeader));
+    writeSection(header.offsetOutOffsets, out.offsets);
+    writeSection(header.offsetOutHubs, out.hubs);
+    writeSection(header.offsetOutDistances, out.distances);
+    if (directed) {
+        writeSection(header.offsetInOffsets, in.offsets);
+        writeSection(header.offsetInHubs, in.hubs);
+        writeSection(header.offsetInDistances, in.distances);
+    }
+
+    if (!outfile)
+        throw std::runtime_error("Could not write the index");
 }
 
 } // namespace NetworKit
@@ -11,6 +11,7 @@
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/BidirectionalBFS.hpp>
 #include <networkit/distance/BidirectionalDijkstra.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/MultiTargetBFS.hpp>
 #include <networkit/distance/MultiTargetDijkstra.hpp>
@@ -22,7 +23,9 @@ namespace NetworKit {
 void SPSP::run() {
     distances.resize(sources.size());
 
-    if (targets.empty())
+    if (useDeltaStepping && G->isWeighted())
+        runWithDeltaStepping();
+    else if (targets.empty())
         runWithoutTargets();
     else
         runWithTargets();
@@ -48,6 +51,27 @@ void SPSP::runWithoutTargets() {
     }
 }
 
+void SPSP::runWithDeltaStepping() {
+    // The sources are processed sequentially, the parallelism is within each search.
+    DeltaStepping deltaStepping(*G, sources.empty() ? 0 : sources.front(), false);
+    for (index i = 0; i < sources.size(); ++i) {
+        deltaStepping.setSource(sources[i]);
+        if (targets.size() == 1)
+            deltaStepping.setTarget(targets.front());
+        deltaStepping.run();
+
+        const auto &dists = deltaStepping.getDistances();
+        if (targets.empty()) {
+            distances[i] = dists;
+        } else {
+            distances[i].clear();
+            distances[i].reserve(targets.size());
+            for (node target : targets)
+                distances[i].push_back(dists[target]);
+        }
+    }
+}
+
 void SPSP::runWithTargets() {
 #pragma omp parallel
     {
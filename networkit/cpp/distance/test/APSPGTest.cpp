@@ -5,6 +5,7 @@
  *      Author: Arie Slobbe, Elisabetta Bergamini
  */
 
+#include <cstdio>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -13,6 +14,7 @@
 #include <networkit/auxiliary/Random.hpp>
 #include <networkit/distance/APSP.hpp>
 #include <networkit/distance/BFS.hpp>
+#include <networkit/distance/BlockedAPSP.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/DynAPSP.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
@@ -428,4 +430,69 @@ TEST_F(APSPGTest, testAPSPEventTypeError) {
     EXPECT_ANY_THROW(apsp.update(event3));
 }
 
+TEST_F(APSPGTest, testBlockedAPSP) {
+    Aux::Random::setSeed(42, false);
+    for (const bool directed : {false, true}) {
+        for (const bool weighted : {false, true}) {
+            auto G = ErdosRenyiGenerator(300, 0.01, directed).generate();
+            G.removeNode(GraphTools::randomNode(G));
+            if (weighted)
+                GraphTools::randomizeWeights(G);
+
+            APSP apsp(G);
+            apsp.run();
+
+            // Small tiles that do not fill whole batches of the bit-parallel BFS
+            BlockedAPSP blocked(G);
+            blocked.tileSize = 100;
+            blocked.outputPath = "output/apsp_matrix.bin";
+            node nextSource = 0;
+            blocked.tileHandler = [&](const BlockedAPSP::Tile &tile) {
+                EXPECT_EQ(tile.first, nextSource);
+                EXPECT_EQ(tile.columns, G.upperNodeIdBound());
+                nextSource += tile.rows;
+                for (index row = 0; row < tile.rows; ++row)
+                    G.forNodes([&](node v) {
+                        if (G.hasNode(tile.first + row))
+                            EXPECT_EQ(tile.distance(row, v),
+                                      apsp.getDistance(tile.first + row, v));
+                    });
+            };
+            blocked.run();
+            EXPECT_EQ(nextSource, G.upperNodeIdBound());
+            EXPECT_EQ(blocked.getEncoding(),
+                      weighted ? BlockedAPSP::FLOAT64
+                               : (directed ? BlockedAPSP::UINT16 : BlockedAPSP::UINT8));
+
+            const BlockedAPSP loaded(blocked.outputPath);
+            EXPECT_EQ(loaded.numberOfNodes(), G.upperNodeIdBound());
+            EXPECT_EQ(loaded.getEncoding(), blocked.getEncoding());
+            G.forNodePairs([&](node u, node v) {
+                EXPECT_EQ(blocked.getDistance(u, v), apsp.getDistance(u, v));
+                EXPECT_EQ(loaded.getDistance(v, u), apsp.getDistance(v, u));
+            });
+            std::remove(blocked.outputPath.c_str());
+        }
+    }
+}
+
+TEST_F(APSPGTest, testBlockedAPSPEncodingOverflow) {
+    Graph G(300);
+    for (node u = 0; u + 1 < G.numberOfNodes(); ++u)
+        G.addEdge(u, u + 1);
+
+    BlockedAPSP blocked(G);
+    blocked.run();
+    EXPECT_EQ(blocked.getEncoding(), BlockedAPSP::UINT16);
+    EXPECT_THROW(blocked.getDistance(0, 1), std::runtime_error);
+
+    blocked.encoding = BlockedAPSP::UINT8;
+    EXPECT_THROW(blocked.run(), std::runtime_error);
+
+    GraphTools::randomizeWeights(G);
+    BlockedAPSP weighted(G);
+    weighted.encoding = BlockedAPSP::UINT16;
+    EXPECT_THROW(weighted.run(), std::runtime_error);
+}
+
 } /* namespace NetworKit */
@@ -5,6 +5,9 @@
  *      Author: Maximilian Vogel
  */
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <limits>
 #include <gtest/gtest.h>
 
@@ -15,6 +18,8 @@
 #include <networkit/distance/BFS.hpp>
 #include <networkit/distance/BidirectionalBFS.hpp>
 #include <networkit/distance/BidirectionalDijkstra.hpp>
+#include <networkit/distance/ContractionHierarchy.hpp>
+#include <networkit/distance/ContractionHierarchyQuery.hpp>
 #include <networkit/distance/Diameter.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/DynPrunedLandmarkLabeling.hpp>
@@ -24,6 +29,7 @@
 #include <networkit/distance/HopPlotApproximation.hpp>
 #include <networkit/distance/IncompleteDijkstra.hpp>
 #include <networkit/distance/JaccardDistance.hpp>
+#include <networkit/distance/MultiSourceBFS.hpp>
 #include <networkit/distance/MultiTargetBFS.hpp>
 #include <networkit/distance/MultiTargetDijkstra.hpp>
 #include <networkit/distance/NeighborhoodFunction.hpp>
@@ -35,6 +41,7 @@
 
 #include <networkit/generators/DorogovtsevMendesGenerator.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/CSRGraph.hpp>
 #include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 
@@ -56,6 +63,21 @@ protected:
 
         return G;
     }
+
+    // Reads and overwrites 64 bit words of index files to test the validation on loading.
+    static uint64_t readWord(const std::string &path, uint64_t position) {
+        std::ifstream file(path, std::ios::binary);
+        uint64_t word = 0;
+        file.seekg(position);
+        file.read(reinterpret_cast<char *>(&word), sizeof(word));
+        return word;
+    }
+
+    static void writeWord(const std::string &path, uint64_t position, uint64_t word) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(position);
+        file.write(reinterpret_cast<const char *>(&word), sizeof(word));
+    }
 };
 
 constexpr edgeweight DistanceGTest::infdist;
@@ -351,6 +373,143 @@ TEST_P(DistanceGTest, testBidirectionalDijkstra) {
     };
 }
 
+TEST_P(DistanceGTest, testContractionHierarchy) {
+    Aux::Random::setSeed(42, false);
+    auto G = generateERGraph(400, isDirected() ? 0.01 : 0.005);
+    G.removeNode(GraphTools::randomNode(G));
+
+    for (bool hubLabels : {false, true}) {
+        ContractionHierarchy ch(G, hubLabels);
+        ch.run();
+        EXPECT_EQ(ch.hasHubLabels(), hubLabels);
+
+        G.forNodes([&](node source) {
+            Dijkstra dij(G, source, false);
+            dij.run();
+            ContractionHierarchyQuery query(G, ch, source, source, false);
+            G.forNodes([&](node target) {
+                query.setTarget(target);
+                query.run();
+                EXPECT_DOUBLE_EQ(query.getDistance(), dij.distance(target));
+                if (hubLabels)
+                    EXPECT_DOUBLE_EQ(ch.distance(source, target), dij.distance(target));
+            });
+        });
+    }
+}
+
+TEST_P(DistanceGTest, testContractionHierarchyPaths) {
+    Aux::Random::setSeed(42, false);
+    const auto G = generateERGraph(500, isDirected() ? 0.01 : 0.005);
+    ContractionHierarchy ch(G);
+    ch.run();
+    EXPECT_GT(ch.numberOfShortcuts(), 0);
+
+    for (int i = 0; i < 50; ++i) {
+        const node source = GraphTools::randomNode(G);
+        node target = GraphTools::randomNode(G);
+        while (source == target)
+            target = GraphTools::randomNode(G);
+        ContractionHierarchyQuery query(G, ch, source, target);
+        query.run();
+        Dijkstra dij(G, source, false, true, target);
+        dij.run();
+
+        EXPECT_DOUBLE_EQ(query.getDistance(), dij.distance(target));
+        if (dij.distance(target) == infdist)
+            continue;
+
+        // The unpacked path consists of edges of the graph and has the shortest length.
+        auto path = query.getPath();
+        path.insert(path.begin(), source);
+        path.push_back(target);
+        edgeweight length = 0;
+        for (size_t j = 0; j + 1 < path.size(); ++j) {
+            ASSERT_TRUE(G.hasEdge(path[j], path[j + 1]));
+            length += G.weight(path[j], path[j + 1]);
+        }
+        EXPECT_NEAR(length, dij.distance(target), 1e-9);
+    }
+
+    const node source = GraphTools::randomNode(G);
+    const auto targets = GraphTools::randomNodes(G, 20);
+    Dijkstra dij(G, source, false);
+    dij.run();
+    ContractionHierarchyQuery query(G, ch, source, targets.begin(), targets.end());
+    query.run();
+    const auto &distances = query.getDistances();
+    const auto &targetIdx = query.getTargetIndexMap();
+    for (const node target : targets)
+        EXPECT_DOUBLE_EQ(distances[targetIdx.at(target)], dij.distance(target));
+}
+
+TEST_P(DistanceGTest, testContractionHierarchySaveLoad) {
+    Aux::Random::setSeed(42, false);
+    const auto G = generateERGraph(300, isDirected() ? 0.01 : 0.005);
+
+    for (bool hubLabels : {false, true}) {
+        ContractionHierarchy ch(G, hubLabels);
+        ch.run();
+
+        const std::string path = "output/ch_index.bin";
+        ch.save(path);
+        const ContractionHierarchy loaded(path);
+        EXPECT_EQ(loaded.hasHubLabels(), hubLabels);
+        EXPECT_EQ(loaded.numberOfShortcuts(), ch.numberOfShortcuts());
+        EXPECT_EQ(loaded.numberOfLabels(), ch.numberOfLabels());
+
+        G.forNodes([&](node source) {
+            EXPECT_EQ(loaded.rank(source), ch.rank(source));
+            for (int i = 0; i < 10; ++i) {
+                const node target = GraphTools::randomNode(G);
+                ContractionHierarchyQuery query(G, ch, source, target),
+                    loadedQuery(G, loaded, source, target);
+                query.run();
+                loadedQuery.run();
+                EXPECT_EQ(loadedQuery.getDistance(), query.getDistance());
+                EXPECT_EQ(loadedQuery.getPath(), query.getPath());
+                if (hubLabels)
+                    EXPECT_EQ(loaded.distance(source, target), ch.distance(source, target));
+            }
+        });
+
+        std::remove(path.c_str());
+    }
+
+    EXPECT_THROW(ContractionHierarchy{"input/lesmis.graph"}, std::runtime_error);
+}
+
+TEST_P(DistanceGTest, testContractionHierarchyCorruptIndex) {
+    Aux::Random::setSeed(42, false);
+    const auto G = generateERGraph(100, 0.05);
+    ContractionHierarchy ch(G, true);
+    ch.run();
+
+    // The section offsets follow the magic value and seven counters in the header; sections 0,
+    // 2 and 10 are the ranks, the targets of the upward out-edges and the hubs of the out-labels.
+    const std::string path = "output/ch_index.bin";
+    auto sectionOffset = [&](index section) { return readWord(path, 64 + 8 * section); };
+
+    ch.save(path);
+    EXPECT_NO_THROW(ContractionHierarchy{path});
+
+    // Duplicate rank
+    writeWord(path, sectionOffset(0), readWord(path, sectionOffset(0) + 8));
+    EXPECT_THROW(ContractionHierarchy{path}, std::runtime_error);
+
+    // Target out of range
+    ch.save(path);
+    writeWord(path, sectionOffset(2), G.upperNodeIdBound());
+    EXPECT_THROW(ContractionHierarchy{path}, std::runtime_error);
+
+    // Hub out of range or missing sentinel
+    ch.save(path);
+    writeWord(path, sectionOffset(10), G.upperNodeIdBound() + 1);
+    EXPECT_THROW(ContractionHierarchy{path}, std::runtime_error);
+
+    std::remove(path.c_str());
+}
+
 TEST_F(DistanceGTest, testExactDiameter) {
     using namespace std;
 
@@ -662,6 +821,37 @@ TEST_P(DistanceGTest, testSPSPWithUnreachableTarget) {
             EXPECT_DOUBLE_EQ(apsp.getDistance(source, target), spsp.getDistance(source, target));
 }
 
+TEST_P(DistanceGTest, testSPSPDeltaStepping) {
+    Aux::Random::setSeed(42, true);
+    const auto G = generateERGraph(100, 0.15);
+
+    APSP apsp(G);
+    apsp.run();
+
+    for (count nSources : {1, 3}) {
+        const auto sources = GraphTools::randomNodes(G, nSources);
+        for (count nTargets : {0, 1, 50}) {
+            const auto targets = GraphTools::randomNodes(G, nTargets);
+
+            SPSP spsp(G, sources.begin(), sources.end(), targets.begin(), targets.end());
+            spsp.useDeltaStepping = true;
+            spsp.run();
+            EXPECT_EQ(spsp.getDistances().size(), nSources);
+
+            for (node source : sources) {
+                if (targets.empty())
+                    G.forNodes([&](node target) {
+                        EXPECT_DOUBLE_EQ(apsp.getDistance(source, target),
+                                         spsp.getDistance(source, target));
+                    });
+                for (node target : targets)
+                    EXPECT_DOUBLE_EQ(apsp.getDistance(source, target),
+                                     spsp.getDistance(source, target));
+            }
+        }
+    }
+}
+
 TEST_P(DistanceGTest, testMultiTargetBFS) {
     Aux::Random::setSeed(42, true);
     const auto G = generateERGraph(100, 0.15);
@@ -683,6 +873,85 @@ TEST_P(DistanceGTest, testMultiTargetBFS) {
     }
 }
 
+TEST_P(DistanceGTest, testMultiSourceBFS) {
+    Aux::Random::setSeed(42, true);
+    auto G = generateERGraph(200, 0.02);
+    G.removeNode(GraphTools::randomNode(G));
+    const auto sources = GraphTools::randomNodes(G, MultiSourceBFS::maxSources);
+
+    std::vector<std::vector<edgeweight>> distances(
+        sources.size(), std::vector<edgeweight>(G.upperNodeIdBound(), infdist));
+    std::vector<std::vector<double>> numberOfPaths(sources.size(),
+                                                   std::vector<double>(G.upperNodeIdBound(), 0));
+    MultiSourceBFS msBFS(G);
+    msBFS.run(
+        sources,
+        [&](node u, count dist, MultiSourceBFS::SourceMask mask) {
+            for (index i = 0; i < sources.size(); ++i) {
+                if (!(mask >> i & 1))
+                    continue;
+                EXPECT_EQ(distances[i][u], infdist);
+                distances[i][u] = static_cast<edgeweight>(dist);
+                if (dist == 0)
+                    numberOfPaths[i][u] = 1;
+            }
+        },
+        [&](node u, node v, MultiSourceBFS::SourceMask mask) {
+            for (index i = 0; i < sources.size(); ++i)
+                if (mask >> i & 1)
+                    numberOfPaths[i][v] += numberOfPaths[i][u];
+        });
+
+    for (index i = 0; i < sources.size(); ++i) {
+        BFS bfs(G, sources[i], true);
+        bfs.run();
+        G.forNodes([&](node u) {
+            EXPECT_EQ(distances[i][u], bfs.distance(u));
+            EXPECT_DOUBLE_EQ(numberOfPaths[i][u], bfs.numberOfPaths(u).ToDouble());
+        });
+    }
+
+    // Shortest path edges reported level by level
+    count numberOfEdges = 0;
+    for (count level = 0; level < msBFS.numberOfLevels(); ++level) {
+        msBFS.forNodesAtLevel(level, [&](node u, MultiSourceBFS::SourceMask mask) {
+            for (index i = 0; i < sources.size(); ++i)
+                if (mask >> i & 1)
+                    EXPECT_EQ(distances[i][u], static_cast<edgeweight>(level));
+        });
+        msBFS.forShortestPathEdgesFromLevel(
+            level, [&](node u, node v, edgeid, MultiSourceBFS::SourceMask mask) {
+                for (index i = 0; i < sources.size(); ++i) {
+                    if (!(mask >> i & 1))
+                        continue;
+                    EXPECT_EQ(distances[i][u], static_cast<edgeweight>(level));
+                    EXPECT_EQ(distances[i][v], static_cast<edgeweight>(level + 1));
+                    ++numberOfEdges;
+                }
+            });
+    }
+
+    count expectedNumberOfEdges = 0;
+    for (index i = 0; i < sources.size(); ++i)
+        G.forEdges([&](node u, node v) {
+            const auto &dist = distances[i];
+            expectedNumberOfEdges += dist[u] != infdist && dist[v] == dist[u] + 1;
+            if (!G.isDirected())
+                expectedNumberOfEdges += dist[v] != infdist && dist[u] == dist[v] + 1;
+        });
+    EXPECT_EQ(numberOfEdges, expectedNumberOfEdges);
+
+    // The same searches on a CSR snapshot
+    const CSRGraph csr = G.freeze();
+    MultiSourceBFS csrBFS(csr);
+    csrBFS.run(sources, [&](node u, count dist, MultiSourceBFS::SourceMask mask) {
+        for (index i = 0; i < sources.size(); ++i)
+            if (mask >> i & 1)
+                EXPECT_EQ(distances[i][u], static_cast<edgeweight>(dist));
+    });
+    EXPECT_EQ(csrBFS.numberOfLevels(), msBFS.numberOfLevels());
+}
+
 TEST_P(DistanceGTest, testMultiTargetDijkstra) {
     Aux::Random::setSeed(42, true);
     const auto G = generateERGraph(100, 0.15);
@@ -715,18 +984,83 @@ TEST_P(DistanceGTest, testPrunedLandmarkLabeling) {
     APSP apsp(G);
     apsp.run();
 
-    const count infDistInt = std::numeric_limits<count>::max();
     const double infDistDouble = std::numeric_limits<double>::max();
 
     G.forNodePairs([&](node u, node v) {
         double distUV = apsp.getDistance(u, v);
         if (distUV == infDistDouble)
-            EXPECT_EQ(pll.query(u, v), infDistInt);
+            EXPECT_EQ(pll.query(u, v), none);
         else
             EXPECT_EQ(pll.query(u, v), distUV);
     });
 }
 
+TEST_P(DistanceGTest, testPrunedLandmarkLabelingSaveLoad) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator{300, 0.01, isDirected()}.generate();
+    G.removeNode(GraphTools::randomNode(G));
+    PrunedLandmarkLabeling pll(G);
+    pll.run();
+
+    const std::string path = "output/pll_index.bin";
+    pll.save(path);
+    const PrunedLandmarkLabeling loaded(path);
+    EXPECT_EQ(loaded.numberOfLabels(), pll.numberOfLabels());
+    G.forNodePairs([&](node u, node v) {
+        EXPECT_EQ(loaded.query(u, v), pll.query(u, v));
+        EXPECT_EQ(loaded.query(v, u), pll.query(v, u));
+    });
+
+    // A loaded index has no graph to recompute the labels from.
+    PrunedLandmarkLabeling reloaded(path);
+    EXPECT_THROW(reloaded.run(), std::runtime_error);
+    EXPECT_EQ(reloaded.query(0, 0), 0);
+
+    // Labels of the dynamic variant are kept in lists and flattened when saving.
+    DynPrunedLandmarkLabeling dynPll(G);
+    dynPll.run();
+    EXPECT_EQ(dynPll.numberOfLabels(), pll.numberOfLabels());
+    const node u = GraphTools::randomNode(G), w = GraphTools::randomNode(G);
+    if (w != u && !G.hasEdge(u, w)) {
+        G.addEdge(u, w);
+        dynPll.update(GraphEvent(GraphEvent::EDGE_ADDITION, u, w));
+    }
+    dynPll.save(path);
+    const PrunedLandmarkLabeling loadedDyn(path);
+    G.forNodePairs([&](node x, node y) {
+        EXPECT_EQ(loadedDyn.query(x, y), dynPll.query(x, y));
+        EXPECT_EQ(loadedDyn.query(y, x), dynPll.query(y, x));
+    });
+
+    std::remove(path.c_str());
+    EXPECT_THROW(PrunedLandmarkLabeling{"input/lesmis.graph"}, std::runtime_error);
+}
+
+TEST_P(DistanceGTest, testPrunedLandmarkLabelingCorruptIndex) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator{100, 0.05, isDirected()}.generate();
+    PrunedLandmarkLabeling pll(G);
+    pll.run();
+
+    // The header consists of the magic value, four 64 bit fields and the section offsets; the
+    // offsets of the out-labels come first and the hubs second.
+    const std::string path = "output/pll_index.bin";
+    pll.save(path);
+    const uint64_t offsets = readWord(path, 40), hubs = readWord(path, 48);
+    EXPECT_NO_THROW(PrunedLandmarkLabeling{path});
+
+    // Decreasing offsets
+    writeWord(path, offsets + 8, readWord(path, offsets + 16) + 1);
+    EXPECT_THROW(PrunedLandmarkLabeling{path}, std::runtime_error);
+
+    // Hub out of range or missing sentinel
+    pll.save(path);
+    writeWord(path, hubs, G.upperNodeIdBound() + 1);
+    EXPECT_THROW(PrunedLandmarkLabeling{path}, std::runtime_error);
+
+    std::remove(path.c_str());
+}
+
 TEST_P(DistanceGTest, testDynPrunedLandmarkLabelingThrowsWithEdgeRemoval) {
     Graph G(2, isWeighted(), isDirected());
     G.addEdge(0, 1);
@@ -789,7 +1123,7 @@ TEST_P(DistanceGTest, testDynPrunedLandmarkLabelingBuildClique) {
         G.parallelForNodePairs([&apsp, &pll](node u, node v) {
             double distUV = apsp.getDistance(u, v);
             if (distUV == std::numeric_limits<double>::max())
-                EXPECT_EQ(pll.query(u, v), std::numeric_limits<count>::max());
+                EXPECT_EQ(pll.query(u, v), none);
             else
                 EXPECT_EQ(pll.query(u, v), distUV);
         });
@@ -7,13 +7,17 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
 #include <stack>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/distance/BFS.hpp>
+#include <networkit/distance/DeltaStepping.hpp>
 #include <networkit/distance/Dijkstra.hpp>
 #include <networkit/distance/DynBFS.hpp>
 #include <networkit/distance/DynDijkstra.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 
 #include <tlx/unused.hpp>
@@ -159,6 +163,39 @@ TEST_F(SSSPGTest, testDirectedBFS) {
     EXPECT_EQ(sssp.distance(7), 3);
 }
 
+TEST_F(SSSPGTest, testDirectionOptimizingBFS) {
+    Aux::Random::setSeed(42, false);
+    for (const bool directed : {false, true}) {
+        for (const double p : {0.01, 0.1}) {
+            const auto G = ErdosRenyiGenerator(300, p, directed).generate();
+            const node source = GraphTools::randomNode(G);
+
+            BFS expected(G, source, true, true);
+            expected.run();
+            BFS bfs(G, source, true, true);
+            bfs.strategy = BFS::DIRECTION_OPTIMIZING;
+            bfs.run();
+
+            EXPECT_EQ(bfs.getDistances(), expected.getDistances());
+            EXPECT_EQ(bfs.getReachableNodes(), expected.getReachableNodes());
+            EXPECT_DOUBLE_EQ(bfs.getSumOfDistances(), expected.getSumOfDistances());
+
+            const auto &sorted = bfs.getNodesSortedByDistance();
+            EXPECT_EQ(sorted.size(), expected.getNodesSortedByDistance().size());
+            for (index i = 1; i < sorted.size(); ++i)
+                EXPECT_LE(bfs.distance(sorted[i - 1]), bfs.distance(sorted[i]));
+
+            G.forNodes([&](node u) {
+                EXPECT_EQ(bfs.numberOfPaths(u), expected.numberOfPaths(u));
+                const auto &pred = bfs.getPredecessors(u);
+                const auto &expectedPred = expected.getPredecessors(u);
+                EXPECT_EQ(std::set<node>(pred.begin(), pred.end()),
+                          std::set<node>(expectedPred.begin(), expectedPred.end()));
+            });
+        }
+    }
+}
+
 TEST_F(SSSPGTest, testDirectedDijkstra) {
     /* Graph:
              ________
@@ -194,4 +231,46 @@ TEST_F(SSSPGTest, testDirectedDijkstra) {
     EXPECT_EQ(sssp.distance(6), 1);
     EXPECT_EQ(sssp.distance(7), 3);
 }
+
+TEST_F(SSSPGTest, testDeltaStepping) {
+    Aux::Random::setSeed(42, false);
+    for (const bool directed : {false, true}) {
+        auto G = GraphTools::toWeighted(ErdosRenyiGenerator(500, 0.02, directed).generate());
+        G.removeNode(GraphTools::randomNode(G));
+        // Small integer weights yield many shortest paths of equal length.
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::integer(1, 10)); });
+
+        for (const edgeweight delta : {0., 0.5, 3., 100.}) {
+            const node source = GraphTools::randomNode(G);
+            Dijkstra expected(G, source, true, true);
+            expected.run();
+            DeltaStepping sssp(G, source, true, true);
+            sssp.delta = delta;
+            sssp.run();
+
+            EXPECT_EQ(sssp.getDistances(), expected.getDistances());
+            EXPECT_EQ(sssp.getReachableNodes(), expected.getReachableNodes());
+            EXPECT_DOUBLE_EQ(sssp.getSumOfDistances(), expected.getSumOfDistances());
+
+            const auto &sorted = sssp.getNodesSortedByDistance();
+            EXPECT_EQ(sorted.size(), expected.getNodesSortedByDistance().size());
+            for (index i = 1; i < sorted.size(); ++i)
+                EXPECT_LE(sssp.distance(sorted[i - 1]), sssp.distance(sorted[i]));
+
+            G.forNodes([&](node u) {
+                EXPECT_EQ(sssp.numberOfPaths(u), expected.numberOfPaths(u));
+                const auto &pred = sssp.getPredecessors(u);
+                const auto &expectedPred = expected.getPredecessors(u);
+                EXPECT_EQ(std::set<node>(pred.begin(), pred.end()),
+                          std::set<node>(expectedPred.begin(), expectedPred.end()));
+            });
+
+            const node target = GraphTools::randomNode(G);
+            DeltaStepping toTarget(G, source, false, false, target);
+            toTarget.delta = delta;
+            toTarget.run();
+            EXPECT_EQ(toTarget.distance(target), expected.distance(target));
+        }
+    }
+}
 } // namespace NetworKit
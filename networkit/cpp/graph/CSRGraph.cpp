@@ -0,0 +1,240 @@
+/*
+ * CSRGraph.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <networkit/graph/CSRGraph.hpp>
+
+namespace NetworKit {
+
+struct CSRGraph::Storage {
+    std::vector<uint8_t> exists;
+
+    std::vector<index> outOffsets;
+    std::vector<node> outTargets;
+    std::vector<edgeweight> outWeights;
+    std::vector<edgeid> outIds;
+
+    std::vector<index> inOffsets;
+    std::vector<node> inTargets;
+    std::vector<edgeweight> inWeights;
+    std::vector<edgeid> inIds;
+};
+
+CSRGraph::CSRGraph(const Graph &G)
+    : n(G.numberOfNodes()), m(G.numberOfEdges()), storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+      z(G.upperNodeIdBound()), omega(G.upperEdgeIdBound()), weighted(G.isWeighted()),
+      directed(G.isDirected()), edgesIndexed(G.hasEdgeIds()) {
+
+    auto data = std::make_shared<Storage>();
+
+    if (n != z) {
+        data->exists.resize(z, 0);
+        G.parallelForNodes([&](node u) { data->exists[u] = 1; });
+    }
+
+    const auto pack = [&](bool inEdges, std::vector<index> &offsets, std::vector<node> &targets,
+                          std::vector<edgeweight> &weights, std::vector<edgeid> &ids) {
+        // offsets[u + 1] is the degree of u, turned into offsets by the prefix sum
+        offsets.assign(z + 1, 0);
+        G.parallelForNodes(
+            [&](node u) { offsets[u + 1] = inEdges ? G.degreeIn(u) : G.degreeOut(u); });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        const count numEntries = offsets.back();
+        targets.resize(numEntries);
+        if (weighted)
+            weights.resize(numEntries);
+        if (edgesIndexed)
+            ids.resize(numEntries);
+
+        G.balancedParallelForNodes([&](node u) {
+            index pos = offsets[u];
+            const auto store = [&](node, node v, edgeweight ew, edgeid eid) {
+                targets[pos] = v;
+                if (weighted)
+                    weights[pos] = ew;
+                if (edgesIndexed)
+                    ids[pos] = eid;
+                ++pos;
+            };
+
+            if (inEdges)
+                G.forInEdgesOf(u, store);
+            else
+                G.forEdgesOf(u, store);
+
+            assert(pos == offsets[u + 1]);
+        });
+    };
+
+    pack(false, data->outOffsets, data->outTargets, data->outWeights, data->outIds);
+    if (directed)
+        pack(true, data->inOffsets, data->inTargets, data->inWeights, data->inIds);
+
+    exists = data->exists;
+    outOffsets = data->outOffsets;
+    outTargets = data->outTargets;
+    outWeights = data->outWeights;
+    outIds = data->outIds;
+    inOffsets = data->inOffsets;
+    inTargets = data->inTargets;
+    inWeights = data->inWeights;
+    inIds = data->inIds;
+
+    storage = std::move(data);
+}
+
+CSRGraph::CSRGraph(const Arrays &arrays, std::shared_ptr<const void> owner)
+    : n(arrays.numberOfNodes), m(arrays.numberOfEdges),
+      storedNumberOfSelfLoops(arrays.numberOfSelfLoops),
+      z(arrays.outOffsets.empty() ? 0 : arrays.outOffsets.size() - 1),
+      omega(arrays.upperEdgeIdBound), weighted(arrays.weighted), directed(arrays.directed),
+      edgesIndexed(arrays.edgesIndexed), storage(std::move(owner)), exists(arrays.exists),
+      outOffsets(arrays.outOffsets), outTargets(arrays.outTargets), outWeights(arrays.outWeights),
+      outIds(arrays.outIds), inOffsets(arrays.inOffsets), inTargets(arrays.inTargets),
+      inWeights(arrays.inWeights), inIds(arrays.inIds) {
+
+    const auto checkAdjacency = [&](std::span<const index> offsets, std::span<const node> targets,
+                                    std::span<const edgeweight> weights,
+                                    std::span<const edgeid> ids) {
+        if (offsets.empty()) {
+            if (z || !targets.empty())
+                throw std::runtime_error("CSRGraph: missing offsets array");
+        } else if (offsets.size() != z + 1 || offsets.front() != 0
+                   || offsets.back() != targets.size()) {
+            throw std::runtime_error("CSRGraph: offsets do not match the targets array");
+        }
+        if (weights.size() != (weighted ? targets.size() : 0))
+            throw std::runtime_error("CSRGraph: weights do not match the targets array");
+        if (ids.size() != (edgesIndexed ? targets.size() : 0))
+            throw std::runtime_error("CSRGraph: edge ids do not match the targets array");
+    };
+
+    if (!exists.empty() && exists.size() != z)
+        throw std::runtime_error("CSRGraph: node flags do not match the number of nodes");
+    if (n > z || (exists.empty() && n != z))
+        throw std::runtime_error("CSRGraph: invalid number of nodes");
+
+    checkAdjacency(outOffsets, outTargets, outWeights, outIds);
+    if (directed) {
+        checkAdjacency(inOffsets, inTargets, inWeights, inIds);
+    } else if (!inOffsets.empty() || !inTargets.empty() || !inWeights.empty() || !inIds.empty()) {
+        throw std::runtime_error("CSRGraph: undirected graphs have no in-arrays");
+    }
+}
+
+Graph CSRGraph::toGraph() const {
+    Graph G(z, weighted, directed);
+    if (edgesIndexed)
+        G.indexEdges();
+    for (node u = 0; u < z; ++u) {
+        if (!hasNode(u))
+            G.removeNode(u);
+    }
+
+    G.balancedParallelForNodes([&](node u) {
+        if (directed) {
+            G.preallocateDirected(u, degreeOut(u), degreeIn(u));
+            forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                G.addPartialOutEdge(unsafe, u, v, ew, eid);
+            });
+            forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                G.addPartialInEdge(unsafe, u, v, ew, eid);
+            });
+        } else {
+            G.preallocateUndirected(u, degree(u));
+            forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                G.addPartialEdge(unsafe, u, v, ew, eid);
+            });
+        }
+    });
+
+    G.setEdgeCount(unsafe, m);
+    G.setNumberOfSelfLoops(unsafe, storedNumberOfSelfLoops);
+    if (edgesIndexed)
+        G.setUpperEdgeIdBound(unsafe, omega);
+    return G;
+}
+
+CSRGraph Graph::freeze() const {
+    return CSRGraph(*this);
+}
+
+edgeweight CSRGraph::weightedDegree(node u, bool countSelfLoopsTwice) const {
+    assert(hasNode(u));
+    if (weighted) {
+        edgeweight sum = 0.0;
+        forNeighborsOf(u, [&](node v, edgeweight ew) {
+            sum += (countSelfLoopsTwice && u == v) ? 2. * ew : ew;
+        });
+        return sum;
+    }
+
+    count sum = degree(u);
+    if (countSelfLoopsTwice && storedNumberOfSelfLoops) {
+        const auto neighbors = neighborRange(u);
+        sum += std::count(neighbors.begin(), neighbors.end(), u);
+    }
+    return static_cast<edgeweight>(sum);
+}
+
+edgeweight CSRGraph::weightedDegreeIn(node u, bool countSelfLoopsTwice) const {
+    if (!directed)
+        return weightedDegree(u, countSelfLoopsTwice);
+
+    assert(hasNode(u));
+    if (weighted) {
+        edgeweight sum = 0.0;
+        forInNeighborsOf(u, [&](node v, edgeweight ew) {
+            sum += (countSelfLoopsTwice && u == v) ? 2. * ew : ew;
+        });
+        return sum;
+    }
+
+    count sum = degreeIn(u);
+    if (countSelfLoopsTwice && storedNumberOfSelfLoops) {
+        const auto neighbors = inNeighborRange(u);
+        sum += std::count(neighbors.begin(), neighbors.end(), u);
+    }
+    return static_cast<edgeweight>(sum);
+}
+
+edgeweight CSRGraph::totalEdgeWeight() const noexcept {
+    if (weighted)
+        return parallelSumForEdges([](node, node, edgeweight ew) { return ew; });
+    return numberOfEdges() * defaultEdgeWeight;
+}
+
+bool CSRGraph::hasEdge(node u, node v) const noexcept {
+    if (!hasNode(u) || !hasNode(v))
+        return false;
+
+    // scan the shorter of the two adjacency arrays
+    if (degreeIn(v) < degree(u)) {
+        const auto neighbors = directed ? inNeighborRange(v) : neighborRange(v);
+        return std::find(neighbors.begin(), neighbors.end(), u) != neighbors.end();
+    }
+
+    const auto neighbors = neighborRange(u);
+    return std::find(neighbors.begin(), neighbors.end(), v) != neighbors.end();
+}
+
+edgeweight CSRGraph::weight(node u, node v) const {
+    assert(hasNode(u));
+    const index begin = outOffsets[u];
+    const index end = outOffsets[u + 1];
+    for (index i = begin; i < end; ++i) {
+        if (outTargets[i] == v)
+            return weighted ? outWeights[i] : defaultEdgeWeight;
+    }
+    return nullWeight;
+}
+
+} // namespace NetworKit
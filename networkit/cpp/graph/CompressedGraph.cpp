@@ -0,0 +1,418 @@
+/*
+ * CompressedGraph.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/CompressedGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+count varIntSize(uint64_t value) noexcept {
+    count size = 1;
+    for (; value >= 0x80; value >>= 7)
+        ++size;
+    return size;
+}
+
+uint8_t *encodeVarInt(uint64_t value, uint8_t *out) noexcept {
+    for (; value >= 0x80; value >>= 7)
+        *out++ = static_cast<uint8_t>(value | 0x80);
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+}
+
+uint64_t zigzagEncode(int64_t value) noexcept {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t firstGap(node u, node v) noexcept {
+    return static_cast<int64_t>(v) - static_cast<int64_t>(u);
+}
+
+using Neighbor = std::pair<node, edgeweight>;
+
+// Returns the number of bytes of the encoded neighborhood of u; the neighbors must be sorted.
+count encodedSize(node u, std::span<const Neighbor> neighbors) noexcept {
+    if (neighbors.empty())
+        return 0;
+    count size = varIntSize(neighbors.size())
+                 + varIntSize(zigzagEncode(firstGap(u, neighbors.front().first)));
+    for (index i = 1; i < neighbors.size(); ++i)
+        size += varIntSize(neighbors[i].first - neighbors[i - 1].first);
+    return size;
+}
+
+// Encodes the sorted, nonempty neighborhood of u at out and returns the end of the encoding.
+uint8_t *encodeNeighbors(node u, std::span<const Neighbor> neighbors, uint8_t *out) noexcept {
+    out = encodeVarInt(neighbors.size(), out);
+    out = encodeVarInt(zigzagEncode(firstGap(u, neighbors.front().first)), out);
+    for (index i = 1; i < neighbors.size(); ++i)
+        out = encodeVarInt(neighbors[i].first - neighbors[i - 1].first, out);
+    return out;
+}
+
+} // namespace
+
+struct CompressedGraph::Storage {
+    std::vector<uint8_t> exists;
+
+    std::vector<index> outOffsets;
+    std::vector<uint8_t> outBytes;
+    std::vector<index> outWeightOffsets;
+    std::vector<edgeweight> outWeights;
+
+    std::vector<index> inOffsets;
+    std::vector<uint8_t> inBytes;
+    std::vector<index> inWeightOffsets;
+    std::vector<edgeweight> inWeights;
+};
+
+CompressedGraph::CompressedGraph(const Graph &G)
+    : n(G.numberOfNodes()), m(G.numberOfEdges()), storedNumberOfSelfLoops(G.numberOfSelfLoops()),
+      z(G.upperNodeIdBound()), weighted(G.isWeighted()), directed(G.isDirected()) {
+
+    auto data = std::make_shared<Storage>();
+
+    if (n != z) {
+        data->exists.resize(z, 0);
+        G.parallelForNodes([&](node u) { data->exists[u] = 1; });
+    }
+
+    // Sorted neighborhoods are only materialized for one node per thread at a time.
+    std::vector<std::vector<Neighbor>> buffers(omp_get_max_threads());
+
+    const auto pack = [&](bool inEdges, std::vector<index> &offsets, std::vector<uint8_t> &bytes,
+                          std::vector<index> &weightOffsets, std::vector<edgeweight> &weights) {
+        const auto sortedNeighbors = [&](node u) -> std::vector<Neighbor> & {
+            auto &neighbors = buffers[omp_get_thread_num()];
+            neighbors.clear();
+            const auto collect = [&](node v, edgeweight ew) { neighbors.emplace_back(v, ew); };
+            if (inEdges)
+                G.forInNeighborsOf(u, collect);
+            else
+                G.forNeighborsOf(u, collect);
+            std::sort(neighbors.begin(), neighbors.end());
+            return neighbors;
+        };
+
+        // First pass: offsets[u + 1] is the encoded size of the neighborhood of u, turned into
+        // offsets by the prefix sum.
+        offsets.assign(z + 1, 0);
+        if (weighted)
+            weightOffsets.assign(z + 1, 0);
+        G.balancedParallelForNodes([&](node u) {
+            const auto &neighbors = sortedNeighbors(u);
+            offsets[u + 1] = encodedSize(u, neighbors);
+            if (weighted)
+                weightOffsets[u + 1] = neighbors.size();
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        if (weighted)
+            std::partial_sum(weightOffsets.begin(), weightOffsets.end(), weightOffsets.begin());
+
+        // Second pass: encode the neighborhoods.
+        bytes.resize(offsets.back());
+        if (weighted)
+            weights.resize(weightOffsets.back());
+        G.balancedParallelForNodes([&](node u) {
+            const auto &neighbors = sortedNeighbors(u);
+            if (neighbors.empty())
+                return;
+
+            [[maybe_unused]] const uint8_t *out =
+                encodeNeighbors(u, neighbors, bytes.data() + offsets[u]);
+            assert(out == bytes.data() + offsets[u + 1]);
+
+            if (weighted) {
+                for (index i = 0; i < neighbors.size(); ++i)
+                    weights[weightOffsets[u] + i] = neighbors[i].second;
+            }
+        });
+    };
+
+    pack(false, data->outOffsets, data->outBytes, data->outWeightOffsets, data->outWeights);
+    if (directed)
+        pack(true, data->inOffsets, data->inBytes, data->inWeightOffsets, data->inWeights);
+
+    setStorage(std::move(data));
+}
+
+CompressedGraph::CompressedGraph(const EdgeStream &edges, count maxBufferedNeighbors) {
+    // First pass: count the degrees, including repeated edges. The number of nodes is only known
+    // at the end of the stream, so the arrays grow on demand.
+    std::vector<count> outDegree, inDegree;
+    const StreamProperties properties = edges([&](std::span<const WeightedEdge> batch) {
+        for (const WeightedEdge &e : batch) {
+            const count required = std::max(e.u, e.v) + 1;
+            if (outDegree.size() < required) {
+                outDegree.resize(std::max(required, 2 * outDegree.size()), 0);
+                inDegree.resize(outDegree.size(), 0);
+            }
+            ++outDegree[e.u];
+            ++inDegree[e.v];
+        }
+    });
+    if (outDegree.size() > properties.numberOfNodes
+        && std::any_of(outDegree.begin() + properties.numberOfNodes, outDegree.end(),
+                       [](count d) { return d > 0; }))
+        throw std::runtime_error("The edges exceed the number of nodes of the stream");
+
+    n = z = properties.numberOfNodes;
+    weighted = properties.weighted;
+    directed = properties.directed;
+    outDegree.resize(z, 0);
+    inDegree.resize(z, 0);
+    if (!directed) {
+        // Upper bound of the neighbors of each node (self-loops are counted twice)
+        for (node u = 0; u < z; ++u)
+            outDegree[u] += inDegree[u];
+        std::vector<count>().swap(inDegree);
+    }
+
+    auto data = std::make_shared<Storage>();
+    count arcs = 0;
+
+    // Collects the neighborhoods of one block of nodes at a time from the stream, sorts them,
+    // merges repeated edges and appends their encoding.
+    const auto pack = [&](bool inEdges, const std::vector<count> &degree,
+                          std::vector<index> &offsets, std::vector<uint8_t> &bytes,
+                          std::vector<index> &weightOffsets, std::vector<edgeweight> &weights) {
+        offsets.assign(z + 1, 0);
+        if (weighted)
+            weightOffsets.assign(z + 1, 0);
+
+        // The neighbors of node first + i are stored at slot[i], ..., slot[i] + filled[i] - 1.
+        std::vector<index> slot;
+        std::vector<count> filled;
+        std::vector<Neighbor> buffer;
+        for (node first = 0; first < z;) {
+            node last = first;
+            slot.assign(1, 0);
+            while (last < z
+                   && (last == first || slot.back() + degree[last] <= maxBufferedNeighbors)) {
+                slot.push_back(slot.back() + degree[last]);
+                ++last;
+            }
+            buffer.resize(slot.back());
+            filled.assign(last - first, 0);
+
+            edges([&](std::span<const WeightedEdge> batch) {
+                for (const WeightedEdge &e : batch) {
+                    const auto add = [&](node u, node v) {
+                        if (u < first || u >= last)
+                            return;
+                        const index i = u - first;
+                        if (v >= z || slot[i] + filled[i] == slot[i + 1])
+                            throw std::runtime_error("The edges of the stream have changed");
+                        buffer[slot[i] + filled[i]++] = {v, e.weight};
+                    };
+                    if (inEdges) {
+                        add(e.v, e.u);
+                    } else {
+                        add(e.u, e.v);
+                        if (!directed && e.u != e.v)
+                            add(e.v, e.u);
+                    }
+                }
+            });
+
+            // Sort the neighborhoods; the stable sort keeps repeated edges in stream order.
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : arcs)
+            for (omp_index i = 0; i < static_cast<omp_index>(last - first); ++i) {
+                const auto neighbors = buffer.begin() + slot[i];
+                std::stable_sort(neighbors, neighbors + filled[i],
+                                 [](const Neighbor &a, const Neighbor &b) {
+                                     return a.first < b.first;
+                                 });
+                count size = 0;
+                for (index j = 0; j < filled[i]; ++j) {
+                    if (size && neighbors[size - 1].first == neighbors[j].first) {
+                        if (properties.mergeWeights)
+                            neighbors[size - 1].second = properties.mergeWeights(
+                                neighbors[size - 1].second, neighbors[j].second);
+                    } else {
+                        neighbors[size++] = neighbors[j];
+                    }
+                }
+                filled[i] = size;
+                arcs += inEdges ? 0 : size;
+                offsets[first + i + 1] = encodedSize(
+                    first + i, std::span<const Neighbor>(&*neighbors, size));
+                if (weighted)
+                    weightOffsets[first + i + 1] = size;
+            }
+
+            for (node u = first; u < last; ++u) {
+                offsets[u + 1] += offsets[u];
+                if (weighted)
+                    weightOffsets[u + 1] += weightOffsets[u];
+            }
+            bytes.resize(offsets[last]);
+            if (weighted)
+                weights.resize(weightOffsets[last]);
+
+#pragma omp parallel for schedule(dynamic, 64)
+            for (omp_index i = 0; i < static_cast<omp_index>(last - first); ++i) {
+                if (!filled[i])
+                    continue;
+                const node u = first + i;
+                const std::span<const Neighbor> neighbors(buffer.data() + slot[i], filled[i]);
+                encodeNeighbors(u, neighbors, bytes.data() + offsets[u]);
+                if (weighted)
+                    for (index j = 0; j < neighbors.size(); ++j)
+                        weights[weightOffsets[u] + j] = neighbors[j].second;
+            }
+            first = last;
+        }
+        bytes.shrink_to_fit();
+        weights.shrink_to_fit();
+    };
+
+    pack(false, outDegree, data->outOffsets, data->outBytes, data->outWeightOffsets,
+         data->outWeights);
+    if (directed)
+        pack(true, inDegree, data->inOffsets, data->inBytes, data->inWeightOffsets,
+             data->inWeights);
+
+    setStorage(std::move(data));
+    storedNumberOfSelfLoops = 0;
+    for (node u = 0; u < z; ++u)
+        storedNumberOfSelfLoops += hasEdge(u, u);
+    m = directed ? arcs : (arcs + storedNumberOfSelfLoops) / 2;
+}
+
+void CompressedGraph::setStorage(std::shared_ptr<Storage> data) {
+    exists = data->exists;
+    outOffsets = data->outOffsets;
+    outBytes = data->outBytes;
+    outWeightOffsets = data->outWeightOffsets;
+    outWeights = data->outWeights;
+    inOffsets = data->inOffsets;
+    inBytes = data->inBytes;
+    inWeightOffsets = data->inWeightOffsets;
+    inWeights = data->inWeights;
+
+    storage = std::move(data);
+}
+
+Graph CompressedGraph::toGraph() const {
+    Graph G(z, weighted, directed);
+    for (node u = 0; u < z; ++u) {
+        if (!hasNode(u))
+            G.removeNode(u);
+    }
+
+    G.balancedParallelForNodes([&](node u) {
+        if (directed) {
+            G.preallocateDirected(u, degreeOut(u), degreeIn(u));
+            forNeighborsOf(
+                u, [&](node v, edgeweight ew) { G.addPartialOutEdge(unsafe, u, v, ew); });
+            forInNeighborsOf(
+                u, [&](node v, edgeweight ew) { G.addPartialInEdge(unsafe, u, v, ew); });
+        } else {
+            G.preallocateUndirected(u, degree(u));
+            forNeighborsOf(u, [&](node v, edgeweight ew) { G.addPartialEdge(unsafe, u, v, ew); });
+        }
+    });
+
+    G.setEdgeCount(unsafe, m);
+    G.setNumberOfSelfLoops(unsafe, storedNumberOfSelfLoops);
+    return G;
+}
+
+CompressedGraph Graph::compress() const {
+    return CompressedGraph(*this);
+}
+
+count CompressedGraph::memoryUsage() const noexcept {
+    return exists.size_bytes() + outOffsets.size_bytes() + outBytes.size_bytes()
+           + outWeightOffsets.size_bytes() + outWeights.size_bytes() + inOffsets.size_bytes()
+           + inBytes.size_bytes() + inWeightOffsets.size_bytes() + inWeights.size_bytes();
+}
+
+edgeweight CompressedGraph::weightedDegree(node u, bool countSelfLoopsTwice) const {
+    assert(hasNode(u));
+    if (weighted) {
+        edgeweight sum = 0.0;
+        forNeighborsOf(u, [&](node v, edgeweight ew) {
+            sum += (countSelfLoopsTwice && u == v) ? 2. * ew : ew;
+        });
+        return sum;
+    }
+
+    const auto neighbors = neighborRange(u);
+    count sum = neighbors.size();
+    if (countSelfLoopsTwice && storedNumberOfSelfLoops)
+        sum += std::count(neighbors.begin(), neighbors.end(), u);
+    return static_cast<edgeweight>(sum);
+}
+
+edgeweight CompressedGraph::weightedDegreeIn(node u, bool countSelfLoopsTwice) const {
+    if (!directed)
+        return weightedDegree(u, countSelfLoopsTwice);
+
+    assert(hasNode(u));
+    if (weighted) {
+        edgeweight sum = 0.0;
+        forInNeighborsOf(u, [&](node v, edgeweight ew) {
+            sum += (countSelfLoopsTwice && u == v) ? 2. * ew : ew;
+        });
+        return sum;
+    }
+
+    const auto neighbors = inNeighborRange(u);
+    count sum = neighbors.size();
+    if (countSelfLoopsTwice && storedNumberOfSelfLoops)
+        sum += std::count(neighbors.begin(), neighbors.end(), u);
+    return static_cast<edgeweight>(sum);
+}
+
+edgeweight CompressedGraph::totalEdgeWeight() const noexcept {
+    if (weighted)
+        return parallelSumForEdges([](node, node, edgeweight ew) { return ew; });
+    return numberOfEdges() * defaultEdgeWeight;
+}
+
+bool CompressedGraph::hasEdge(node u, node v) const noexcept {
+    if (!hasNode(u) || !hasNode(v))
+        return false;
+
+    const auto contains = [](const NeighborRange &neighbors, node x) {
+        for (node y : neighbors) {
+            if (y >= x)
+                return y == x;
+        }
+        return false;
+    };
+
+    // decode the shorter of the two neighborhoods
+    if (degreeIn(v) < degree(u))
+        return contains(directed ? inNeighborRange(v) : neighborRange(v), u);
+    return contains(neighborRange(u), v);
+}
+
+edgeweight CompressedGraph::weight(node u, node v) const {
+    assert(hasNode(u));
+    index i = 0;
+    for (node x : neighborRange(u)) {
+        if (x == v)
+            return weighted ? outWeights[outWeightOffsets[u] + i] : defaultEdgeWeight;
+        if (x > v)
+            break;
+        ++i;
+    }
+    return nullWeight;
+}
+
+} // namespace NetworKit
@@ -449,6 +449,91 @@ void Graph::removeNode(node v) {
     n--;
 }
 
+void Graph::removeNodes(std::span<const node> nodes) {
+    if (maintainCompactEdges && !edgesIndexed) {
+        throw std::runtime_error("Edges have to be indexed if maintainCompactEdges is set to true");
+    }
+
+    const auto numberOfRemovedNodes = static_cast<omp_index>(nodes.size());
+    std::vector<uint8_t> removed(z, 0);
+#pragma omp parallel for
+    for (omp_index i = 0; i < numberOfRemovedNodes; ++i) {
+        assert(hasNode(nodes[i]));
+        removed[nodes[i]] = 1;
+    }
+
+    // Every removed edge is accounted to exactly one of its removed endpoints: edges between two
+    // removed nodes to their (out-)edge of the smaller endpoint.
+    auto accountedTo = [&](node u, node v, bool incoming) {
+        if (directed)
+            return !incoming || !removed[v];
+        return !removed[v] || u <= v;
+    };
+
+    std::vector<index> offsets(nodes.size() + 1, 0);
+    count removedSelfLoops = 0;
+#pragma omp parallel for reduction(+ : removedSelfLoops)
+    for (omp_index i = 0; i < numberOfRemovedNodes; ++i) {
+        const node u = nodes[i];
+        for (const node v : outEdges[u]) {
+            offsets[i + 1] += accountedTo(u, v, false);
+            removedSelfLoops += (u == v);
+        }
+        if (directed)
+            for (const node v : inEdges[u])
+                offsets[i + 1] += accountedTo(u, v, true);
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    if (edgesIndexed) {
+        std::vector<edgeid> removedIds(offsets.back());
+#pragma omp parallel for
+        for (omp_index i = 0; i < numberOfRemovedNodes; ++i) {
+            const node u = nodes[i];
+            index next = offsets[i];
+            for (index j = 0; j < outEdges[u].size(); ++j)
+                if (accountedTo(u, outEdges[u][j], false))
+                    removedIds[next++] = outEdgeIds[u][j];
+            if (directed)
+                for (index j = 0; j < inEdges[u].size(); ++j)
+                    if (accountedTo(u, inEdges[u][j], true))
+                        removedIds[next++] = inEdgeIds[u][j];
+        }
+        removeEdgeIds(std::move(removedIds));
+    }
+
+    // Sweep over the remaining nodes and drop the neighbors that are removed
+    auto isRemoved = [&](const std::vector<node> &adjacency) {
+        return [&](index i) { return removed[adjacency[i]] != 0; };
+    };
+    balancedParallelForNodes([&](node u) {
+        if (removed[u])
+            return;
+        if (std::ranges::any_of(outEdges[u], [&](node v) { return removed[v] != 0; }))
+            compactAdjacency(u, false, isRemoved(outEdges[u]));
+        if (directed && std::ranges::any_of(inEdges[u], [&](node v) { return removed[v] != 0; }))
+            compactAdjacency(u, true, isRemoved(inEdges[u]));
+    });
+
+#pragma omp parallel for
+    for (omp_index i = 0; i < numberOfRemovedNodes; ++i) {
+        removePartialOutEdges(unsafe, nodes[i]);
+        if (directed)
+            removePartialInEdges(unsafe, nodes[i]);
+    }
+
+    for (const node u : nodes) {
+        // Make the attributes of this node invalid
+        for (auto &attribute : nodeAttributeMap.attrMap)
+            attribute.second->invalidate(u);
+        exists[u] = false;
+    }
+
+    n -= nodes.size();
+    m -= offsets.back();
+    storedNumberOfSelfLoops -= removedSelfLoops;
+}
+
 void Graph::restoreNode(node v) {
     assert(v < z);
     assert(!exists[v]);
@@ -524,6 +609,123 @@ bool Graph::addEdge(node u, node v, edgeweight ew, bool checkForMultiEdges) {
 
     return true;
 }
+
+namespace {
+
+// Groups the indices of a batch of edges by the nodes whose adjacency arrays they affect
+// (counting sort). forOwnersOf(edge, handle) calls handle for each of these nodes. Within a
+// group, the indices keep the order of the batch.
+template <typename ForOwners>
+void groupBatchByNode(std::span<const std::pair<node, node>> edges, count z,
+                      ForOwners forOwnersOf, std::vector<index> &offsets,
+                      std::vector<index> &batchIndices) {
+    const auto batchSize = static_cast<omp_index>(edges.size());
+
+    offsets.assign(z + 1, 0);
+#pragma omp parallel for
+    for (omp_index i = 0; i < batchSize; ++i) {
+        forOwnersOf(edges[i], [&](node owner) {
+#pragma omp atomic
+            ++offsets[owner + 1];
+        });
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    batchIndices.resize(offsets.back());
+    std::vector<index> next(offsets.begin(), offsets.end() - 1);
+#pragma omp parallel for
+    for (omp_index i = 0; i < batchSize; ++i) {
+        forOwnersOf(edges[i], [&](node owner) {
+            index position;
+#pragma omp atomic capture
+            position = next[owner]++;
+            batchIndices[position] = static_cast<index>(i);
+        });
+    }
+
+#pragma omp parallel for schedule(guided)
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        std::sort(batchIndices.begin() + offsets[u], batchIndices.begin() + offsets[u + 1]);
+}
+
+// Owners of an edge in the out-, in- and undirected adjacency arrays
+constexpr auto forSource = [](std::pair<node, node> edge, auto handle) { handle(edge.first); };
+constexpr auto forTarget = [](std::pair<node, node> edge, auto handle) { handle(edge.second); };
+constexpr auto forEndpoints = [](std::pair<node, node> edge, auto handle) {
+    handle(edge.first);
+    if (edge.first != edge.second)
+        handle(edge.second);
+};
+
+count countSelfLoops(std::span<const std::pair<node, node>> edges) {
+    count selfLoops = 0;
+#pragma omp parallel for reduction(+ : selfLoops)
+    for (omp_index i = 0; i < static_cast<omp_index>(edges.size()); ++i)
+        selfLoops += (edges[i].first == edges[i].second);
+    return selfLoops;
+}
+
+} // namespace
+
+void Graph::addEdges(std::span<const std::pair<node, node>> edges,
+                     std::span<const edgeweight> weights) {
+    if (!weights.empty() && weights.size() != edges.size())
+        throw std::runtime_error("Expected either no weights or one weight per edge");
+#ifndef NDEBUG
+    for (const auto &[u, v] : edges)
+        assert(hasNode(u) && hasNode(v));
+#endif
+
+    const edgeid firstId = omega;
+    std::vector<index> offsets;
+    std::vector<index> batchIndices;
+
+    // Appends the grouped edges to the given adjacency arrays, every node is handled by one thread.
+    auto appendEdges = [&](std::vector<std::vector<node>> &adjacencies,
+                           std::vector<std::vector<edgeweight>> &adjacencyWeights,
+                           std::vector<std::vector<edgeid>> &adjacencyIds) {
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            const index begin = offsets[u], end = offsets[u + 1];
+            if (begin == end)
+                continue;
+
+            const count newDegree = adjacencies[u].size() + (end - begin);
+            adjacencies[u].reserve(newDegree);
+            if (weighted)
+                adjacencyWeights[u].reserve(newDegree);
+            if (edgesIndexed)
+                adjacencyIds[u].reserve(newDegree);
+
+            for (index j = begin; j < end; ++j) {
+                const index i = batchIndices[j];
+                const auto [x, y] = edges[i];
+                adjacencies[u].push_back(x == static_cast<node>(u) ? y : x);
+                if (weighted)
+                    adjacencyWeights[u].push_back(weights.empty() ? defaultEdgeWeight
+                                                                  : weights[i]);
+                if (edgesIndexed)
+                    adjacencyIds[u].push_back(firstId + i);
+            }
+        }
+    };
+
+    if (directed) {
+        groupBatchByNode(edges, z, forSource, offsets, batchIndices);
+        appendEdges(outEdges, outEdgeWeights, outEdgeIds);
+        groupBatchByNode(edges, z, forTarget, offsets, batchIndices);
+        appendEdges(inEdges, inEdgeWeights, inEdgeIds);
+    } else {
+        groupBatchByNode(edges, z, forEndpoints, offsets, batchIndices);
+        appendEdges(outEdges, outEdgeWeights, outEdgeIds);
+    }
+
+    m += edges.size();
+    storedNumberOfSelfLoops += countSelfLoops(edges);
+    if (edgesIndexed)
+        omega += edges.size();
+}
+
 bool Graph::addPartialEdge(Unsafe, node u, node v, edgeweight ew, uint64_t index,
                            bool checkForMultiEdges) {
     assert(u < z);
@@ -730,6 +932,183 @@ void Graph::removeEdge(node u, node v) {
     }
 }
 
+void Graph::removeEdges(std::span<const std::pair<node, node>> edges) {
+    if (maintainCompactEdges && !edgesIndexed) {
+        throw std::runtime_error("Edges have to be indexed if maintainCompactEdges is set to true");
+    }
+#ifndef NDEBUG
+    for (const auto &[u, v] : edges)
+        assert(hasNode(u) && hasNode(v));
+#endif
+
+    // The removed edges grouped by the node whose adjacency array contains them, together with
+    // their positions in these arrays
+    struct Removals {
+        std::vector<index> offsets;
+        std::vector<index> batchIndices;
+        std::vector<index> positions;
+    };
+
+    auto neighborIn = [&](node u, index i) {
+        const auto [x, y] = edges[i];
+        return x == u ? y : x;
+    };
+
+    // Phase 1 (read-only): find the positions of the edges to remove. Each group is sorted by
+    // neighbor, every entry of the adjacency array is matched with the first unmatched removal of
+    // the same neighbor.
+    bool allFound = true;
+    index missing = none;
+    auto findPositions = [&](const std::vector<std::vector<node>> &adjacencies, auto forOwnersOf,
+                             Removals &removals) {
+        groupBatchByNode(edges, z, forOwnersOf, removals.offsets, removals.batchIndices);
+        removals.positions.assign(removals.batchIndices.size(), none);
+
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            const auto begin = removals.batchIndices.begin() + removals.offsets[u];
+            const auto end = removals.batchIndices.begin() + removals.offsets[u + 1];
+            if (begin == end)
+                continue;
+
+            auto byNeighbor = [&](index i, index j) {
+                return std::make_pair(neighborIn(u, i), i) < std::make_pair(neighborIn(u, j), j);
+            };
+            std::sort(begin, end, byNeighbor);
+
+            for (index pos = 0; pos < adjacencies[u].size(); ++pos) {
+                const node v = adjacencies[u][pos];
+                auto it = std::lower_bound(begin, end, v, [&](index i, node w) {
+                    return neighborIn(u, i) < w;
+                });
+                for (; it != end && neighborIn(u, *it) == v; ++it) {
+                    index &position =
+                        removals.positions[static_cast<index>(it - removals.batchIndices.begin())];
+                    if (position == none) {
+                        position = pos;
+                        break;
+                    }
+                }
+            }
+
+            for (auto it = begin; it != end; ++it) {
+                if (removals.positions[static_cast<index>(it - removals.batchIndices.begin())]
+                    == none) {
+#pragma omp critical
+                    {
+                        allFound = false;
+                        missing = *it;
+                    }
+                    break;
+                }
+            }
+        }
+    };
+
+    Removals outRemovals, inRemovals;
+    if (directed) {
+        findPositions(outEdges, forSource, outRemovals);
+        if (allFound)
+            findPositions(inEdges, forTarget, inRemovals);
+    } else {
+        findPositions(outEdges, forEndpoints, outRemovals);
+    }
+
+    if (!allFound) {
+        std::stringstream strm;
+        strm << "edge (" << edges[missing].first << "," << edges[missing].second
+             << ") does not exist";
+        throw std::runtime_error(strm.str());
+    }
+
+    // Phase 2: compact every affected adjacency array once
+    std::vector<edgeid> removedIds(edgesIndexed ? edges.size() : 0);
+    auto removeAtPositions = [&](Removals &removals, bool incoming) {
+#pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u) {
+            const index begin = removals.offsets[u], end = removals.offsets[u + 1];
+            if (begin == end)
+                continue;
+
+            if (edgesIndexed && !incoming) {
+                for (index j = begin; j < end; ++j) {
+                    const index i = removals.batchIndices[j];
+                    if (edges[i].first == static_cast<node>(u))
+                        removedIds[i] = outEdgeIds[u][removals.positions[j]];
+                }
+            }
+
+            std::sort(removals.positions.begin() + begin, removals.positions.begin() + end);
+            index next = begin;
+            compactAdjacency(u, incoming, [&](index pos) {
+                if (next < end && removals.positions[next] == pos) {
+                    ++next;
+                    return true;
+                }
+                return false;
+            });
+        }
+    };
+
+    removeAtPositions(outRemovals, false);
+    if (directed)
+        removeAtPositions(inRemovals, true);
+
+    m -= edges.size();
+    storedNumberOfSelfLoops -= countSelfLoops(edges);
+    if (edgesIndexed)
+        removeEdgeIds(std::move(removedIds));
+}
+
+template <typename Remove>
+void Graph::compactAdjacency(node u, bool incoming, Remove remove) {
+    auto &adjacency = incoming ? inEdges[u] : outEdges[u];
+    auto &adjacencyWeights = incoming ? inEdgeWeights : outEdgeWeights;
+    auto &adjacencyIds = incoming ? inEdgeIds : outEdgeIds;
+
+    index kept = 0;
+    for (index i = 0; i < adjacency.size(); ++i) {
+        if (remove(i))
+            continue;
+        adjacency[kept] = adjacency[i];
+        if (weighted)
+            adjacencyWeights[u][kept] = adjacencyWeights[u][i];
+        if (edgesIndexed)
+            adjacencyIds[u][kept] = adjacencyIds[u][i];
+        ++kept;
+    }
+
+    adjacency.resize(kept);
+    if (weighted)
+        adjacencyWeights[u].resize(kept);
+    if (edgesIndexed)
+        adjacencyIds[u].resize(kept);
+}
+
+void Graph::removeEdgeIds(std::vector<edgeid> removedIds) {
+    // Make the attributes of the removed edges invalid
+    for (auto &attribute : edgeAttributeMap.attrMap)
+        for (const edgeid eid : removedIds)
+            attribute.second->invalidate(eid);
+
+    if (!maintainCompactEdges)
+        return;
+
+    // Every id is decreased by the number of smaller removed ids
+    std::ranges::sort(removedIds);
+    auto shiftIds = [&](std::vector<edgeid> &ids) {
+        for (edgeid &eid : ids)
+            eid -= static_cast<edgeid>(std::ranges::upper_bound(removedIds, eid)
+                                       - removedIds.begin());
+    };
+    balancedParallelForNodes([&](node u) {
+        shiftIds(outEdgeIds[u]);
+        if (directed)
+            shiftIds(inEdgeIds[u]);
+    });
+    omega -= removedIds.size();
+}
+
 void Graph::removeAllEdges() {
     parallelForNodes([&](const node u) {
         removePartialOutEdges(unsafe, u);
@@ -101,7 +101,7 @@ void GraphBuilder::addHalfEdge(index a, index b, edgeweight ew) {
     if (autoCompleteEdges) {
         if (directed) {
             addHalfOutEdge(a, b, ew);
-            addHalfInEdge(b, a);
+            addHalfInEdge(b, a, ew);
         } else {
             addHalfOutEdge(a, b, ew);
             if (a != b)
@@ -490,9 +490,9 @@ void GraphBuilder::addHalfEdgesToGraph(Graph &G) {
                     G.addPartialOutEdge(Unsafe{}, edges[j].source, edges[j].destination,
                                         weights[j]);
                     if (!autoCompleteEdges) {
-                        inEdgesPerThread[edges[j].destination % max_threads][thread_num]
+                        inEdgesPerThread[thread_num][edges[j].destination % max_threads]
                             .emplace_back(edges[j].destination, edges[j].source);
-                        inEdgeWeightsPerThread[edges[j].destination % max_threads][thread_num]
+                        inEdgeWeightsPerThread[thread_num][edges[j].destination % max_threads]
                             .emplace_back(weights[j]);
                     }
                 }
@@ -500,7 +500,7 @@ void GraphBuilder::addHalfEdgesToGraph(Graph &G) {
                 for (HalfEdge edge : edges) {
                     G.addPartialOutEdge(Unsafe{}, edge.source, edge.destination);
                     if (!autoCompleteEdges) {
-                        inEdgesPerThread[edge.destination % max_threads][thread_num].emplace_back(
+                        inEdgesPerThread[thread_num][edge.destination % max_threads].emplace_back(
                             edge.destination, edge.source);
                     }
                 }
@@ -510,11 +510,12 @@ void GraphBuilder::addHalfEdgesToGraph(Graph &G) {
 #pragma omp barrier // this is required as inEdgesPerThreads are potentially being added
         }
         if (directed || !autoCompleteEdges) {
+            // inEdgesPerThread[i][thread_num] contains the in-edges added by thread i whose source
+            // is handled by this thread
             if (directed) {
                 std::vector<count> edgeCounts(n / max_threads + 1);
-                auto &edgesfromThread = inEdgesPerThread[thread_num];
-                for (auto &edges : edgesfromThread) {
-                    for (HalfEdge edge : edges) {
+                for (auto &edgesfromThread : inEdgesPerThread) {
+                    for (HalfEdge edge : edgesfromThread[thread_num]) {
                         ++edgeCounts[edge.source / max_threads];
                     }
                 }
@@ -524,17 +525,25 @@ void GraphBuilder::addHalfEdgesToGraph(Graph &G) {
                         break;
                     G.preallocateDirectedInEdges(v, edgeCounts[i] + G.degreeIn(v));
                 }
-                for (auto &edges : edgesfromThread) {
-                    for (HalfEdge edge : edges) {
-                        G.addPartialInEdge(Unsafe{}, edge.source, edge.destination);
+                for (index i = 0; i < inEdgesPerThread.size(); ++i) {
+                    auto &edges = inEdgesPerThread[i][thread_num];
+                    if (weighted) {
+                        auto &weights = inEdgeWeightsPerThread[i][thread_num];
+                        for (index j = 0; j < edges.size(); ++j) {
+                            G.addPartialInEdge(Unsafe{}, edges[j].source, edges[j].destination,
+                                               weights[j]);
+                        }
+                    } else {
+                        for (HalfEdge edge : edges) {
+                            G.addPartialInEdge(Unsafe{}, edge.source, edge.destination);
+                        }
                     }
                 }
             } else { // collect "second" half of the edges
-                auto &edgesfromThread = inEdgesPerThread[thread_num];
-                for (index i = 0; i < edgesfromThread.size(); ++i) {
-                    auto &edges = edgesfromThread[i];
+                for (index i = 0; i < inEdgesPerThread.size(); ++i) {
+                    auto &edges = inEdgesPerThread[i][thread_num];
                     if (weighted) {
-                        auto &weights = inEdgeWeightsPerThread[thread_num][i];
+                        auto &weights = inEdgeWeightsPerThread[i][thread_num];
                         for (index j = 0; j < edges.size(); ++j) {
                             if (edges[j].source != edges[j].destination)
                                 G.addPartialOutEdge(Unsafe{}, edges[j].source, edges[j].destination,
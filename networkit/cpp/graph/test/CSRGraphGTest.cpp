@@ -0,0 +1,213 @@
+/*
+ * CSRGraphGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+class CSRGraphGTest : public testing::TestWithParam<std::tuple<bool, bool>> {
+protected:
+    bool isWeighted() const { return std::get<0>(GetParam()); }
+    bool isDirected() const { return std::get<1>(GetParam()); }
+
+    Graph generateGraph(count n, double p) const;
+    void checkEqual(const Graph &G, const CSRGraph &C) const;
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, CSRGraphGTest,
+                         testing::Values(std::make_tuple(false, false),
+                                         std::make_tuple(true, false), std::make_tuple(false, true),
+                                         std::make_tuple(true, true)));
+
+Graph CSRGraphGTest::generateGraph(count n, double p) const {
+    Aux::Random::setSeed(42, false);
+    Graph G(ErdosRenyiGenerator(n, p, isDirected()).generate(), isWeighted(), isDirected());
+    if (isWeighted())
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+    G.addEdge(3, 3);
+    return G;
+}
+
+void CSRGraphGTest::checkEqual(const Graph &G, const CSRGraph &C) const {
+    EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+    EXPECT_EQ(C.upperNodeIdBound(), G.upperNodeIdBound());
+    EXPECT_EQ(C.upperEdgeIdBound(), G.upperEdgeIdBound());
+    EXPECT_EQ(C.isWeighted(), G.isWeighted());
+    EXPECT_EQ(C.isDirected(), G.isDirected());
+    EXPECT_EQ(C.hasEdgeIds(), G.hasEdgeIds());
+    EXPECT_DOUBLE_EQ(C.totalEdgeWeight(), G.totalEdgeWeight());
+
+    for (node u = 0; u < G.upperNodeIdBound(); ++u)
+        EXPECT_EQ(C.hasNode(u), G.hasNode(u));
+
+    using EdgeTuple = std::tuple<node, node, edgeweight, edgeid>;
+
+    G.forNodes([&](node u) {
+        EXPECT_EQ(C.degree(u), G.degree(u));
+        EXPECT_EQ(C.degreeIn(u), G.degreeIn(u));
+        EXPECT_DOUBLE_EQ(C.weightedDegree(u, true), G.weightedDegree(u, true));
+        EXPECT_DOUBLE_EQ(C.weightedDegreeIn(u), G.weightedDegreeIn(u));
+
+        std::vector<EdgeTuple> expected, actual;
+        const auto collect = [](std::vector<EdgeTuple> &out) {
+            return [&out](node x, node y, edgeweight ew, edgeid eid) {
+                out.emplace_back(x, y, ew, eid);
+            };
+        };
+
+        G.forEdgesOf(u, collect(expected));
+        C.forEdgesOf(u, collect(actual));
+        EXPECT_EQ(actual, expected);
+
+        expected.clear();
+        actual.clear();
+        G.forInEdgesOf(u, collect(expected));
+        C.forInEdgesOf(u, collect(actual));
+        EXPECT_EQ(actual, expected);
+
+        index i = 0;
+        for (node v : C.neighborRange(u)) {
+            EXPECT_EQ(v, G.getIthNeighbor(u, i));
+            EXPECT_EQ(C.getIthNeighborWeight(unsafe, u, i), G.getIthNeighborWeight(u, i));
+            EXPECT_TRUE(C.hasEdge(u, v));
+            EXPECT_EQ(C.weight(u, v), G.weight(u, v));
+            ++i;
+        }
+    });
+
+    std::vector<EdgeTuple> expected, actual;
+    G.forEdges(
+        [&](node u, node v, edgeweight ew, edgeid eid) { expected.emplace_back(u, v, ew, eid); });
+    C.forEdges(
+        [&](node u, node v, edgeweight ew, edgeid eid) { actual.emplace_back(u, v, ew, eid); });
+    EXPECT_EQ(actual, expected);
+
+    count numEdges = 0;
+    C.parallelForEdges([&](node, node) {
+#pragma omp atomic
+        ++numEdges;
+    });
+    EXPECT_EQ(numEdges, G.numberOfEdges());
+    EXPECT_EQ(C.parallelSumForNodes([](node) { return 1.0; }), G.numberOfNodes());
+}
+
+TEST_P(CSRGraphGTest, testFreeze) {
+    const Graph G = generateGraph(200, 0.05);
+    checkEqual(G, G.freeze());
+}
+
+TEST_P(CSRGraphGTest, testFreezeWithEdgeIds) {
+    Graph G = generateGraph(200, 0.05);
+    G.indexEdges();
+    checkEqual(G, CSRGraph(G));
+}
+
+TEST_P(CSRGraphGTest, testFreezeWithDeletedNodes) {
+    Graph G = generateGraph(200, 0.05);
+    G.removeNode(0);
+    G.removeNode(17);
+    G.removeNode(199);
+
+    const CSRGraph C(G);
+    EXPECT_FALSE(C.hasNode(17));
+    checkEqual(G, C);
+
+    count visited = 0;
+    C.forNodes([&](node) { ++visited; });
+    EXPECT_EQ(visited, G.numberOfNodes());
+}
+
+TEST_P(CSRGraphGTest, testSnapshotIsImmutable) {
+    Graph G = generateGraph(100, 0.1);
+    const Graph original = G;
+    const CSRGraph C = G.freeze();
+    const CSRGraph copy = C;
+
+    G.addNode();
+    G.addEdge(0, 100);
+    G.removeNode(5);
+
+    checkEqual(original, C);
+    checkEqual(original, copy);
+}
+
+TEST_P(CSRGraphGTest, testEmptyGraph) {
+    const CSRGraph empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty.numberOfEdges(), 0);
+
+    const Graph G(0, isWeighted(), isDirected());
+    const CSRGraph C(G);
+    EXPECT_TRUE(C.isEmpty());
+    checkEqual(G, C);
+}
+
+TEST_P(CSRGraphGTest, testToGraph) {
+    Graph G = generateGraph(100, 0.1);
+    G.indexEdges();
+    G.removeNode(7);
+
+    const Graph G2 = G.freeze().toGraph();
+    EXPECT_EQ(G2.isWeighted(), G.isWeighted());
+    EXPECT_EQ(G2.isDirected(), G.isDirected());
+    checkEqual(G2, G.freeze());
+}
+
+TEST_P(CSRGraphGTest, testExternalArrays) {
+    // Path 0 -> 1 -> 2, stored in arrays owned by the caller.
+    const std::vector<index> offsets{0, 1, 2, 2};
+    const std::vector<index> undirectedOffsets{0, 1, 3, 4};
+    const std::vector<node> targets{1, 2};
+    const std::vector<node> undirectedTargets{1, 0, 2, 1};
+    const std::vector<index> inOffsets{0, 0, 1, 2};
+    const std::vector<node> inTargets{0, 1};
+    const std::vector<edgeweight> weights{0.5, 2.0};
+    const std::vector<edgeweight> undirectedWeights{0.5, 0.5, 2.0, 2.0};
+
+    CSRGraph::Arrays arrays;
+    arrays.numberOfNodes = 3;
+    arrays.numberOfEdges = 2;
+    arrays.weighted = isWeighted();
+    arrays.directed = isDirected();
+    if (isDirected()) {
+        arrays.outOffsets = offsets;
+        arrays.outTargets = targets;
+        arrays.inOffsets = inOffsets;
+        arrays.inTargets = inTargets;
+        if (isWeighted())
+            arrays.outWeights = arrays.inWeights = weights;
+    } else {
+        arrays.outOffsets = undirectedOffsets;
+        arrays.outTargets = undirectedTargets;
+        if (isWeighted())
+            arrays.outWeights = undirectedWeights;
+    }
+
+    const CSRGraph C(arrays, nullptr);
+    EXPECT_EQ(C.numberOfNodes(), 3);
+    EXPECT_EQ(C.numberOfEdges(), 2);
+    EXPECT_TRUE(C.hasEdge(1, 2));
+    EXPECT_EQ(C.weight(1, 2), isWeighted() ? 2.0 : defaultEdgeWeight);
+    EXPECT_EQ(C.hasEdge(1, 0), !isDirected());
+    checkEqual(C.toGraph(), C);
+
+    // The targets array does not match the offsets.
+    arrays.outTargets = arrays.outTargets.first(1);
+    EXPECT_THROW(CSRGraph(arrays, nullptr), std::runtime_error);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,267 @@
+/*
+ * CompressedGraphGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/CompressedGraph.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+class CompressedGraphGTest : public testing::TestWithParam<std::tuple<bool, bool>> {
+protected:
+    bool isWeighted() const { return std::get<0>(GetParam()); }
+    bool isDirected() const { return std::get<1>(GetParam()); }
+
+    Graph generateGraph(count n, double p) const;
+    void checkEqual(const Graph &G, const CompressedGraph &C) const;
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, CompressedGraphGTest,
+                         testing::Values(std::make_tuple(false, false),
+                                         std::make_tuple(true, false), std::make_tuple(false, true),
+                                         std::make_tuple(true, true)));
+
+Graph CompressedGraphGTest::generateGraph(count n, double p) const {
+    Aux::Random::setSeed(42, false);
+    Graph G(ErdosRenyiGenerator(n, p, isDirected()).generate(), isWeighted(), isDirected());
+    if (isWeighted())
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+    G.addEdge(3, 3);
+    // multi-edge and edges between distant nodes
+    G.addEdge(1, 2, 0.25);
+    G.addEdge(1, 2, 0.75);
+    G.addEdge(0, n - 1);
+    G.addEdge(n - 1, 1);
+    return G;
+}
+
+void CompressedGraphGTest::checkEqual(const Graph &G, const CompressedGraph &C) const {
+    EXPECT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+    EXPECT_EQ(C.upperNodeIdBound(), G.upperNodeIdBound());
+    EXPECT_EQ(C.isWeighted(), G.isWeighted());
+    EXPECT_EQ(C.isDirected(), G.isDirected());
+    EXPECT_NEAR(C.totalEdgeWeight(), G.totalEdgeWeight(), 1e-9);
+
+    for (node u = 0; u < G.upperNodeIdBound(); ++u)
+        EXPECT_EQ(C.hasNode(u), G.hasNode(u));
+
+    using EdgeTuple = std::tuple<node, node, edgeweight>;
+    const auto collect = [](std::vector<EdgeTuple> &out) {
+        return [&out](node x, node y, edgeweight ew) { out.emplace_back(x, y, ew); };
+    };
+
+    G.forNodes([&](node u) {
+        EXPECT_EQ(C.degree(u), G.degree(u));
+        EXPECT_EQ(C.degreeIn(u), G.degreeIn(u));
+        EXPECT_NEAR(C.weightedDegree(u, true), G.weightedDegree(u, true), 1e-9);
+        EXPECT_NEAR(C.weightedDegreeIn(u), G.weightedDegreeIn(u), 1e-9);
+
+        // The compressed neighborhoods are sorted.
+        std::vector<EdgeTuple> expected, actual;
+        G.forEdgesOf(u, collect(expected));
+        C.forEdgesOf(u, collect(actual));
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(actual, expected);
+
+        expected.clear();
+        actual.clear();
+        G.forInEdgesOf(u, collect(expected));
+        C.forInEdgesOf(u, collect(actual));
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(actual, expected);
+
+        const auto neighbors = C.neighborRange(u);
+        EXPECT_EQ(neighbors.size(), G.degree(u));
+        EXPECT_TRUE(std::is_sorted(neighbors.begin(), neighbors.end()));
+        for (node v : neighbors) {
+            EXPECT_TRUE(C.hasEdge(u, v));
+            EXPECT_TRUE(G.hasEdge(u, v));
+            if (!isWeighted())
+                EXPECT_EQ(C.weight(u, v), defaultEdgeWeight);
+        }
+    });
+
+    std::vector<EdgeTuple> expected, actual;
+    G.forEdges(collect(expected));
+    C.forEdges(collect(actual));
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    EXPECT_EQ(actual, expected);
+
+    count numEdges = 0;
+    C.parallelForEdges([&](node, node) {
+#pragma omp atomic
+        ++numEdges;
+    });
+    EXPECT_EQ(numEdges, G.numberOfEdges());
+    EXPECT_EQ(C.parallelSumForNodes([](node) { return 1.0; }), G.numberOfNodes());
+}
+
+TEST_P(CompressedGraphGTest, testCompress) {
+    const Graph G = generateGraph(300, 0.05);
+    const CompressedGraph C = G.compress();
+    checkEqual(G, C);
+
+    EXPECT_TRUE(C.hasEdge(0, 299));
+    EXPECT_EQ(C.hasEdge(299, 0), !isDirected());
+    EXPECT_FALSE(C.hasEdge(0, 300));
+
+    // The weight of the first copy in sorted order is returned for multi-edges.
+    edgeweight minWeight = 1.0;
+    G.forNeighborsOf(1, [&](node v, edgeweight ew) {
+        if (v == 2)
+            minWeight = std::min(minWeight, ew);
+    });
+    EXPECT_EQ(C.weight(1, 2), minWeight);
+}
+
+TEST_P(CompressedGraphGTest, testCompressWithDeletedNodes) {
+    Graph G = generateGraph(200, 0.05);
+    G.removeNode(0);
+    G.removeNode(17);
+    G.removeNode(199);
+
+    const CompressedGraph C(G);
+    EXPECT_FALSE(C.hasNode(17));
+    checkEqual(G, C);
+
+    count visited = 0;
+    C.forNodes([&](node) { ++visited; });
+    EXPECT_EQ(visited, G.numberOfNodes());
+}
+
+TEST_P(CompressedGraphGTest, testEmptyGraph) {
+    const CompressedGraph empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty.numberOfEdges(), 0);
+
+    const Graph G(0, isWeighted(), isDirected());
+    const CompressedGraph C(G);
+    EXPECT_TRUE(C.isEmpty());
+    checkEqual(G, C);
+}
+
+TEST_P(CompressedGraphGTest, testStreamingConstruction) {
+    Graph G = generateGraph(300, 0.05);
+    G.removeMultiEdges();
+
+    // Every edge of node 5 is repeated at the end of the stream, undirected ones reversed.
+    std::vector<WeightedEdge> edges;
+    G.forEdges([&](node u, node v, edgeweight ew) { edges.emplace_back(u, v, ew); });
+    G.forEdgesOf(5, [&](node u, node v) {
+        if (isDirected())
+            edges.emplace_back(u, v, 1.0);
+        else
+            edges.emplace_back(v, u, 1.0);
+    });
+
+    const auto stream = [&](bool sumWeights) {
+        return [&, sumWeights](const CompressedGraph::EdgeBatchHandler &handler) {
+            for (index i = 0; i < edges.size(); i += 7)
+                handler(std::span<const WeightedEdge>(edges).subspan(
+                    i, std::min<count>(7, edges.size() - i)));
+            CompressedGraph::StreamProperties properties;
+            properties.numberOfNodes = G.upperNodeIdBound();
+            properties.weighted = isWeighted();
+            properties.directed = isDirected();
+            if (sumWeights)
+                properties.mergeWeights = [](edgeweight a, edgeweight b) { return a + b; };
+            return properties;
+        };
+    };
+
+    // Small buffers split the nodes into many blocks.
+    for (const count maxBufferedNeighbors : {count{0}, count{50}, count{1} << 20}) {
+        checkEqual(G, CompressedGraph(stream(false), maxBufferedNeighbors));
+
+        Graph summed = G;
+        if (isWeighted())
+            G.forEdgesOf(5, [&](node u, node v, edgeweight ew) { summed.setWeight(u, v, ew + 1); });
+        checkEqual(summed, CompressedGraph(stream(true), maxBufferedNeighbors));
+    }
+
+    // Edges beyond the number of nodes are rejected.
+    edges.emplace_back(0, G.upperNodeIdBound(), 1.0);
+    EXPECT_THROW(CompressedGraph{stream(false)}, std::runtime_error);
+}
+
+TEST_P(CompressedGraphGTest, testToGraph) {
+    Graph G = generateGraph(100, 0.1);
+    G.removeNode(7);
+
+    const Graph G2 = G.compress().toGraph();
+    EXPECT_EQ(G2.isWeighted(), G.isWeighted());
+    EXPECT_EQ(G2.isDirected(), G.isDirected());
+    checkEqual(G2, G.compress());
+    checkEqual(G, CompressedGraph(G2));
+}
+
+TEST_P(CompressedGraphGTest, testLargeGaps) {
+    // Neighbor ids that need several bytes per gap, in both directions.
+    Graph G(1 << 18, isWeighted(), isDirected());
+    const node last = G.upperNodeIdBound() - 1;
+    G.addEdge(0, last, 2.0);
+    G.addEdge(last, 1, 3.0);
+    G.addEdge(last, last);
+    G.addEdge(1 << 10, 1 << 17, 4.0);
+    G.addEdge(1 << 10, 5);
+
+    const CompressedGraph C(G);
+    checkEqual(G, C);
+    EXPECT_TRUE(C.hasEdge(1 << 10, 1 << 17));
+    EXPECT_EQ(C.weight(last, 1), isWeighted() ? 3.0 : defaultEdgeWeight);
+}
+
+TEST_P(CompressedGraphGTest, testMemoryUsage) {
+    // In a graph with local edges, most gaps fit into a single byte.
+    Graph G(100000, isWeighted(), isDirected());
+    for (node u = 1; u < G.upperNodeIdBound(); ++u) {
+        G.addEdge(u - 1, u);
+        if (u >= 10)
+            G.addEdge(u, u - 10);
+    }
+
+    const CompressedGraph C(G);
+    checkEqual(G, C);
+
+    // Each edge is stored twice, as out- and in-edge or in both directions.
+    const count entries = 2 * G.numberOfEdges();
+    const count csrBytes = (isDirected() ? 2 : 1) * (G.upperNodeIdBound() + 1) * sizeof(index)
+                           + entries * (sizeof(node) + (isWeighted() ? sizeof(edgeweight) : 0));
+    EXPECT_LT(C.memoryUsage(), csrBytes);
+}
+
+TEST_P(CompressedGraphGTest, testBFS) {
+    const Graph G = generateGraph(500, 0.01);
+    const CompressedGraph C(G);
+
+    std::vector<count> expected(G.upperNodeIdBound(), none), actual(G.upperNodeIdBound(), none);
+    Traversal::BFSfrom(G, 0, [&](node u, count dist) { expected[u] = dist; });
+    Traversal::BFSfrom(C, 0, [&](node u, count dist) { actual[u] = dist; });
+    EXPECT_EQ(actual, expected);
+
+    count visitedEdges = 0;
+    Traversal::BFSEdgesFrom(C, 0, [&](node, node v, edgeweight, edgeid) {
+        EXPECT_NE(actual[v], none);
+        ++visitedEdges;
+    });
+    EXPECT_EQ(visitedEdges + 1, std::count_if(actual.begin(), actual.end(),
+                                              [](count dist) { return dist != none; }));
+}
+
+} // namespace NetworKit
@@ -63,6 +63,21 @@ TEST_F(GraphBenchmark, edgeInsertions_standard_seq) {
     EXPECT_EQ((n * (n - 1)) / 2, G.numberOfEdges());
 }
 
+TEST_F(GraphBenchmark, edgeInsertions_batch_par) {
+    count n = this->n;
+    Aux::Timer runtime;
+
+    Graph G(n);
+    std::vector<std::pair<node, node>> edges;
+    G.forNodePairs([&](node u, node v) { edges.emplace_back(u, v); });
+    runtime.start();
+    G.addEdges(edges);
+    runtime.stop();
+
+    INFO("[DONE] edgeInsertions_batch_par (", runtime.elapsed().count(), " ms)");
+    EXPECT_EQ((n * (n - 1)) / 2, G.numberOfEdges());
+}
+
 // Task: precompute incident weights with different methods
 
 TEST_F(GraphBenchmark, weightedDegree_standard_seq) {
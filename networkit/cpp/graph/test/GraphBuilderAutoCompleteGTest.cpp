@@ -386,6 +386,7 @@ TEST_P(GraphBuilderAutoCompleteGTest, testSameAsGraph) {
             ASSERT_NEAR(G_expected.weightedDegree(v), G_actual.weightedDegree(v), epsilon);
             ASSERT_NEAR(G_expected.weightedDegree(v, true), G_actual.weightedDegree(v, true),
                         epsilon);
+            ASSERT_NEAR(G_expected.weightedDegreeIn(v), G_actual.weightedDegreeIn(v), epsilon);
         });
         G_expected.forEdges([&](node u, node v, edgeweight ew) {
             ASSERT_TRUE(G_actual.hasEdge(u, v));
@@ -398,6 +399,37 @@ TEST_P(GraphBuilderAutoCompleteGTest, testSameAsGraph) {
     }
 }
 
+TEST_P(GraphBuilderAutoCompleteGTest, testParallelAddHalfEdgeWithAutoComplete) {
+    Aux::Random::setSeed(1, true);
+    const count n = 500;
+    Graph G_expected(n, isWeighted(), isDirected());
+    G_expected.forNodePairs([&](node u, node v) {
+        if (Aux::Random::probability() < 0.05)
+            G_expected.addEdge(u, v, Aux::Random::probability());
+    });
+
+    // every edge is added by an arbitrary thread, possibly not the one owning its endpoints
+    GraphBuilder b(n, isWeighted(), isDirected(), true);
+    std::vector<WeightedEdge> edges;
+    G_expected.forEdges([&](node u, node v, edgeweight ew) { edges.emplace_back(u, v, ew); });
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(edges.size()); ++i)
+        b.addHalfEdge(edges[i].u, edges[i].v, edges[i].weight);
+
+    Graph G_actual = b.completeGraph();
+    ASSERT_EQ(G_expected.numberOfEdges(), G_actual.numberOfEdges());
+    G_expected.forNodes([&](node v) {
+        ASSERT_EQ(G_expected.degreeIn(v), G_actual.degreeIn(v));
+        ASSERT_EQ(G_expected.degreeOut(v), G_actual.degreeOut(v));
+        ASSERT_NEAR(G_expected.weightedDegree(v), G_actual.weightedDegree(v), 1e-6);
+        ASSERT_NEAR(G_expected.weightedDegreeIn(v), G_actual.weightedDegreeIn(v), 1e-6);
+    });
+    G_expected.forEdges([&](node u, node v, edgeweight ew) {
+        ASSERT_TRUE(G_actual.hasEdge(u, v));
+        ASSERT_DOUBLE_EQ(ew, G_actual.weight(u, v));
+    });
+}
+
 TEST_P(GraphBuilderAutoCompleteGTest, testForValidStateAfterToGraph) {
     Graph Ghouse = toGraph(this->bHouse);
 
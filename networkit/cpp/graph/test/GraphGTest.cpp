@@ -7,6 +7,7 @@
  */
 
 #include <algorithm>
+#include <numeric>
 #include <tuple>
 
 #include <gtest/gtest.h>
@@ -43,6 +44,7 @@ protected:
     Graph createGraph(count n = 0) const;
     Graph createGraph(count n, count m) const;
     count countSelfLoopsManually(const Graph &G);
+    void expectSameNeighborhoods(const Graph &G, const Graph &expected) const;
 };
 
 INSTANTIATE_TEST_SUITE_P(InstantiationName, GraphGTest,
@@ -90,6 +92,37 @@ count GraphGTest::countSelfLoopsManually(const Graph &G) {
     return c;
 }
 
+void GraphGTest::expectSameNeighborhoods(const Graph &G, const Graph &expected) const {
+    EXPECT_EQ(G.numberOfNodes(), expected.numberOfNodes());
+    EXPECT_EQ(G.numberOfEdges(), expected.numberOfEdges());
+    EXPECT_EQ(G.numberOfSelfLoops(), expected.numberOfSelfLoops());
+    EXPECT_EQ(G.upperEdgeIdBound(), expected.upperEdgeIdBound());
+    EXPECT_TRUE(G.checkConsistency());
+
+    // Neighborhoods as sorted lists, the order of the neighbors may differ.
+    auto neighborhood = [](const Graph &H, node u, bool incoming) {
+        std::vector<std::tuple<node, edgeweight, edgeid>> result;
+        auto collect = [&](node, node v, edgeweight ew, edgeid eid) {
+            result.emplace_back(v, ew, H.hasEdgeIds() ? eid : none);
+        };
+        if (incoming)
+            H.forInEdgesOf(u, collect);
+        else
+            H.forEdgesOf(u, collect);
+        std::ranges::sort(result);
+        return result;
+    };
+
+    for (node u = 0; u < expected.upperNodeIdBound(); ++u) {
+        ASSERT_EQ(G.hasNode(u), expected.hasNode(u));
+        if (!G.hasNode(u))
+            continue;
+        EXPECT_EQ(neighborhood(G, u, false), neighborhood(expected, u, false));
+        if (G.isDirected())
+            EXPECT_EQ(neighborhood(G, u, true), neighborhood(expected, u, true));
+    }
+}
+
 void GraphGTest::SetUp() {
     /*
      *    0
@@ -346,6 +379,41 @@ TEST_P(GraphGTest, testRemoveNode) {
     testGraph(G2);
 }
 
+TEST_P(GraphGTest, testRemoveNodes) {
+    Aux::Random::setSeed(42, false);
+    for (bool indexed : {false, true}) {
+        Graph G = createGraph(200, 2000);
+        G.addEdge(5, 5);
+        G.addEdge(17, 17);
+        if (indexed)
+            G.indexEdges();
+        G.sortEdges();
+        Graph expected(G);
+
+        std::vector<node> nodes(G.upperNodeIdBound());
+        std::iota(nodes.begin(), nodes.end(), 0);
+        std::ranges::shuffle(nodes, Aux::Random::getURNG());
+        nodes.resize(50);
+        if (std::ranges::find(nodes, 5) == nodes.end())
+            nodes.push_back(5); // has a self-loop
+
+        for (node u : nodes)
+            expected.removeNode(u);
+        G.removeNodes(nodes);
+
+        expectSameNeighborhoods(G, expected);
+        // The remaining neighborhoods keep their order
+        G.forNodes([&](node u) {
+            EXPECT_TRUE(std::ranges::is_sorted(G.neighborRange(u)));
+            if (G.isDirected())
+                EXPECT_TRUE(std::ranges::is_sorted(G.inNeighborRange(u)));
+        });
+
+        G.removeNodes(std::vector<node>{});
+        expectSameNeighborhoods(G, expected);
+    }
+}
+
 TEST_P(GraphGTest, testHasNode) {
     Graph G = createGraph(5);
 
@@ -647,6 +715,66 @@ TEST_P(GraphGTest, testAddEdge) {
     }
 }
 
+TEST_P(GraphGTest, testAddEdges) {
+    Aux::Random::setSeed(42, false);
+    for (bool indexed : {false, true}) {
+        Graph G = createGraph(100, 200);
+        G.removeNode(7);
+        if (indexed)
+            G.indexEdges();
+        Graph expected(G);
+
+        std::vector<std::pair<node, node>> edges;
+        std::vector<edgeweight> weights;
+        while (edges.size() < 1000) {
+            const node u = GraphTools::randomNode(G);
+            const node v = edges.size() % 100 == 0 ? u : GraphTools::randomNode(G);
+            const edgeweight ew = Aux::Random::probability();
+            if (expected.addEdge(u, v, ew, true)) {
+                edges.emplace_back(u, v);
+                weights.push_back(ew);
+            }
+        }
+        G.addEdges(edges, weights);
+
+        EXPECT_EQ(G.numberOfEdges(), expected.numberOfEdges());
+        EXPECT_EQ(G.numberOfSelfLoops(), expected.numberOfSelfLoops());
+        EXPECT_EQ(G.upperEdgeIdBound(), expected.upperEdgeIdBound());
+        EXPECT_TRUE(G.checkConsistency());
+
+        // The adjacencies are identical to the ones of sequential insertion, including the order.
+        G.forNodes([&](node u) {
+            ASSERT_EQ(G.degreeOut(u), expected.degreeOut(u));
+            ASSERT_EQ(G.degreeIn(u), expected.degreeIn(u));
+            for (index i = 0; i < G.degreeOut(u); ++i) {
+                EXPECT_EQ(G.getIthNeighbor(u, i), expected.getIthNeighbor(u, i));
+                EXPECT_EQ(G.getIthNeighborWeight(u, i), expected.getIthNeighborWeight(u, i));
+                if (indexed)
+                    EXPECT_EQ(G.getIthNeighborWithId(u, i), expected.getIthNeighborWithId(u, i));
+            }
+            if (G.isDirected()) {
+                std::vector<std::tuple<node, edgeweight, edgeid>> inEdges, expectedInEdges;
+                G.forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                    inEdges.emplace_back(v, ew, eid);
+                });
+                expected.forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                    expectedInEdges.emplace_back(v, ew, eid);
+                });
+                EXPECT_EQ(inEdges, expectedInEdges);
+            }
+        });
+
+        // Without weights, every edge gets the default weight
+        Graph H = createGraph(10);
+        H.addEdges(std::vector<std::pair<node, node>>{{0, 1}, {2, 2}, {3, 1}});
+        EXPECT_EQ(H.numberOfEdges(), 3);
+        EXPECT_EQ(H.numberOfSelfLoops(), 1);
+        H.forEdges([&](node, node, edgeweight ew) { EXPECT_EQ(ew, defaultEdgeWeight); });
+
+        EXPECT_THROW(H.addEdges(edges, std::vector<edgeweight>(1)), std::runtime_error);
+    }
+}
+
 TEST_P(GraphGTest, testRemoveEdge) {
     double epsilon = 1e-6;
     Graph G = createGraph(3);
@@ -740,6 +868,78 @@ TEST_P(GraphGTest, testRemoveEdge) {
         << "Weighted, directed: " << G.isWeighted() << ", " << G.isDirected();
 }
 
+TEST_P(GraphGTest, testRemoveEdges) {
+    Aux::Random::setSeed(42, false);
+    for (bool indexed : {false, true}) {
+        Graph G = createGraph(100, 1000);
+        std::vector<std::pair<node, node>> edges;
+        G.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+        std::ranges::shuffle(edges, Aux::Random::getURNG());
+        edges.resize(300);
+
+        G.addEdge(5, 5);
+        G.addEdge(17, 17);
+        G.addEdge(3, 4);
+        G.addEdge(3, 4); // multi-edge
+        edges.emplace_back(5, 5);
+        edges.emplace_back(3, 4);
+        edges.emplace_back(G.isDirected() ? 3 : 4, G.isDirected() ? 4 : 3);
+        if (indexed)
+            G.indexEdges();
+        G.sortEdges();
+
+        Graph expected(G);
+        for (auto [u, v] : edges)
+            expected.removeEdge(u, v);
+        G.removeEdges(edges);
+
+        expectSameNeighborhoods(G, expected);
+        // The remaining neighborhoods keep their order
+        G.forNodes([&](node u) {
+            EXPECT_TRUE(std::ranges::is_sorted(G.neighborRange(u)));
+            if (G.isDirected())
+                EXPECT_TRUE(std::ranges::is_sorted(G.inNeighborRange(u)));
+        });
+
+        // Nothing is removed if one of the edges does not exist
+        const count m = G.numberOfEdges();
+        EXPECT_THROW(G.removeEdges(std::vector<std::pair<node, node>>{{0, 0}, {5, 5}}),
+                     std::runtime_error);
+        EXPECT_EQ(G.numberOfEdges(), m);
+    }
+}
+
+TEST_P(GraphGTest, testRemoveEdgesCompactEdgeIds) {
+    Aux::Random::setSeed(42, false);
+    Graph G = createGraph(100, 1000);
+    G.indexEdges();
+    G.setMaintainCompactEdges(true);
+
+    std::vector<std::pair<node, node>> edges;
+    G.forEdges([&](node u, node v) {
+        if (Aux::Random::probability() < 0.3)
+            edges.emplace_back(u, v);
+    });
+    G.removeEdges(edges);
+    G.removeNodes(std::vector<node>{3, 50});
+
+    // The remaining ids are compact and keep their relative order
+    EXPECT_EQ(G.upperEdgeIdBound(), G.numberOfEdges());
+    std::vector<bool> seen(G.numberOfEdges(), false);
+    edgeid previous = 0;
+    bool first = true;
+    G.forEdges([&](node, node, edgeid eid) {
+        ASSERT_LT(eid, G.numberOfEdges());
+        EXPECT_FALSE(seen[eid]);
+        seen[eid] = true;
+        if (!first)
+            EXPECT_GT(eid, previous);
+        previous = eid;
+        first = false;
+    });
+    EXPECT_TRUE(G.checkConsistency());
+}
+
 TEST_P(GraphGTest, testRemoveAllEdges) {
     constexpr count n = 100;
     constexpr double p = 0.2;
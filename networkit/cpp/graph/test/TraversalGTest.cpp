@@ -87,6 +87,33 @@ TEST_P(TraversalGTest, testBFSfrom) {
     }
 }
 
+TEST_P(TraversalGTest, testParallelBFSfrom) {
+    constexpr count n = 500;
+    Aux::Random::setSeed(42, false);
+
+    // The dense graph makes the search switch to bottom-up expansion.
+    for (const double p : {0.005, 0.2}) {
+        auto G = ErdosRenyiGenerator(n, p, directed()).generate();
+        G.removeNode(GraphTools::randomNode(G));
+
+        for (count numSources : {1, 3}) {
+            std::vector<node> sources;
+            for (count i = 0; i < numSources; ++i)
+                sources.push_back(GraphTools::randomNode(G));
+
+            std::vector<count> expected(n, none), actual(n, none);
+            Traversal::BFSfrom(G, sources.begin(), sources.end(),
+                               [&](node u, count dist) { expected[u] = dist; });
+            Traversal::parallelBFSfrom(G, sources.begin(), sources.end(),
+                                       [&](node u, count dist) {
+                                           EXPECT_EQ(actual[u], none);
+                                           actual[u] = dist;
+                                       });
+            EXPECT_EQ(expected, actual);
+        }
+    }
+}
+
 TEST_P(TraversalGTest, testDFSfrom) {
     constexpr count n = 200;
     constexpr double p = 0.15;
@@ -5,17 +5,185 @@
  *      Author: cls
  */
 
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <numeric>
+#include <omp.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
-#include <networkit/graph/GraphTools.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
 #include <networkit/io/EdgeListReader.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
 
 namespace NetworKit {
 
+namespace {
+
+struct ParsedEdge {
+    node source;
+    node target;
+    edgeweight weight;
+};
+
+// Edges and (if ids are not continuous) node ids of one chunk of the file, in file order.
+struct ChunkData {
+    std::vector<ParsedEdge> edges;
+    std::unordered_map<std::string_view, node> localIds;
+    std::vector<std::string_view> idsInOrder;
+    node maxId = 0;
+    std::exception_ptr error;
+};
+
+// Parses the edge lines of a range of the file; shared by read() and forEdgeBatches().
+class EdgeListParser {
+public:
+    EdgeListParser(char separator, char commentChar, node firstNode, bool continuous)
+        : separator(separator), commentChar(commentChar), firstNode(firstNode),
+          continuous(continuous) {}
+
+    // The first edge line determines whether the graph is weighted.
+    bool detectWeighted(const char *it, const char *end) const {
+        while (it < end) {
+            const char *lineEnd = findLineEnd(it, end);
+            it = skipDelimiters(it, lineEnd);
+            if (isEdgeLine(it, lineEnd)) {
+                count words = 0;
+                while (it != lineEnd) {
+                    it = skipDelimiters(scanWord(it, lineEnd), lineEnd);
+                    ++words;
+                }
+                return words > 2;
+            }
+            if (lineEnd == end)
+                break;
+            it = lineEnd + 1;
+        }
+        return false;
+    }
+
+    // Returns the beginning of the line following it, or end.
+    static const char *nextLine(const char *it, const char *end) {
+        it = std::find(it, end, '\n');
+        return it == end ? end : it + 1;
+    }
+
+    // Parses the lines of [it, chunkEnd); errors report the line number within the file starting
+    // at fileBegin.
+    void parseChunk(ChunkData &chunk, const char *fileBegin, const char *it, const char *chunkEnd,
+                    bool weighted) const {
+        auto scanId = [&](const char *wordBegin, const char *wordEnd) -> node {
+            if (continuous) {
+                node value;
+                if (!parseNumber(wordBegin, wordEnd, value) || value < firstNode)
+                    throw std::runtime_error("Scanning node failed. The file may be corrupt.");
+                chunk.maxId = std::max(chunk.maxId, value - firstNode);
+                return value - firstNode;
+            }
+
+            const std::string_view word(wordBegin, wordEnd - wordBegin);
+            const auto [pos, inserted] = chunk.localIds.try_emplace(word, chunk.idsInOrder.size());
+            if (inserted)
+                chunk.idsInOrder.push_back(word);
+            return pos->second;
+        };
+
+        auto scanWeight = [](const char *wordBegin, const char *wordEnd) -> edgeweight {
+            if (wordBegin != wordEnd && *wordBegin == '+')
+                ++wordBegin;
+            edgeweight value;
+            if (!parseNumber(wordBegin, wordEnd, value))
+                throw std::runtime_error("Error in parsing file - looking for weight failed");
+            return value;
+        };
+
+        const char *lineBegin = it;
+        try {
+            while (it < chunkEnd) {
+                lineBegin = it;
+                const char *lineEnd = findLineEnd(it, chunkEnd);
+                it = skipDelimiters(it, lineEnd);
+                if (isEdgeLine(it, lineEnd)) {
+                    const char *wordEnd = scanWord(it, lineEnd);
+                    const node source = scanId(it, wordEnd);
+                    it = skipDelimiters(wordEnd, lineEnd);
+                    if (it == lineEnd)
+                        throw std::runtime_error("Error in parsing file - missing target node");
+
+                    wordEnd = scanWord(it, lineEnd);
+                    const node target = scanId(it, wordEnd);
+                    it = skipDelimiters(wordEnd, lineEnd);
+
+                    edgeweight weight = defaultEdgeWeight;
+                    if (weighted) {
+                        if (it == lineEnd)
+                            throw std::runtime_error("Error in parsing file - missing weight");
+                        weight = scanWeight(it, scanWord(it, lineEnd));
+                    }
+
+                    chunk.edges.push_back({source, target, weight});
+                }
+                if (lineEnd == chunkEnd)
+                    break;
+                it = lineEnd + 1;
+            }
+        } catch (const std::runtime_error &e) {
+            // Lines are only counted on errors, the chunks do not know their first line.
+            const auto line = std::count(fileBegin, lineBegin, '\n') + 1;
+            throw std::runtime_error(std::string(e.what()) + " (line " + std::to_string(line)
+                                     + ")");
+        }
+    }
+
+private:
+    char separator;
+    char commentChar;
+    node firstNode;
+    bool continuous;
+
+    // Parses the word [wordBegin, wordEnd) as a number of type T. Returns false if the word is
+    // not a single number or if the number does not fit into T.
+    template <typename T>
+    static bool parseNumber(const char *wordBegin, const char *wordEnd, T &value) {
+        const auto [past, error] = std::from_chars(wordBegin, wordEnd, value);
+        return error == std::errc{} && past == wordEnd;
+    }
+
+    bool isDelimiter(char c) const { return c == ' ' || c == separator; }
+
+    const char *skipDelimiters(const char *it, const char *lineEnd) const {
+        while (it != lineEnd && isDelimiter(*it))
+            ++it;
+        return it;
+    }
+
+    // Returns the end of the word starting at it.
+    const char *scanWord(const char *it, const char *lineEnd) const {
+        while (it != lineEnd && !isDelimiter(*it))
+            ++it;
+        return it;
+    }
+
+    static const char *findLineEnd(const char *it, const char *chunkEnd) {
+        return std::find_if(it, chunkEnd, [](char c) { return c == '\n' || c == '\r'; });
+    }
+
+    // Empty lines and comment lines contain no edge.
+    bool isEdgeLine(const char *it, const char *lineEnd) const {
+        return it != lineEnd && *it != commentChar;
+    }
+};
+
+} // namespace
+
 EdgeListReader::EdgeListReader(char separator, node firstNode, std::string_view commentPrefix,
                                bool continuous, bool directed)
     : separator(separator), commentPrefix(commentPrefix), firstNode(firstNode),
@@ -37,132 +205,180 @@ const std::map<std::string, node> &EdgeListReader::getNodeMap() const {
 Graph EdgeListReader::read(std::string_view path) {
     this->mapNodeIds.clear();
     MemoryMappedFile mmfile(path);
-    auto it = mmfile.cbegin();
-    auto end = mmfile.cend();
-
-    bool weighted = false;
-    bool checkedWeighted = false;
-    Graph graph(0, weighted, directed);
+    const char *const begin = mmfile.cbegin();
+    const char *const end = mmfile.cend();
 
     DEBUG("separator: ", this->separator);
     DEBUG("first node: ", this->firstNode);
 
-    auto skipWhitespaceAndSeparator = [this, &it, &end]() -> void {
-        while (it != end && (*it == ' ' || *it == separator))
-            ++it;
-    };
+    const EdgeListParser parser(separator, commentPrefix[0], firstNode, continuous);
+    const bool weighted = parser.detectWeighted(begin, end);
+    if (weighted)
+        DEBUG("Detected graph as weighted");
 
-    // This function parses in whole words
-    auto scanWord = [this, &it, &end]() -> std::string {
-        std::string word = "";
-        while (it != end && *it != ' ' && *it != separator && *it != '\n' && *it != '\r') {
-            word += *it;
-            ++it;
-        }
-        return word;
-    };
+    // Split the file into chunks that start at the beginning of a line.
+    const count numberOfChunks =
+        std::min<count>(4 * omp_get_max_threads(), (end - begin) / (1 << 16) + 1);
+    std::vector<const char *> chunkBegin(numberOfChunks + 1, end);
+    for (index c = 0; c < numberOfChunks; ++c) {
+        const char *it = begin + c * (end - begin) / numberOfChunks;
+        if (it != begin)
+            it = EdgeListParser::nextLine(it - 1, end);
+        chunkBegin[c] = it;
+    }
 
-    auto scanId = [&, this]() -> node {
-        if (continuous) {
-            char *past;
-            auto value = strtol(it, &past, 10);
-            if (past <= it)
-                throw std::runtime_error("Scanning node failed. The file may be corrupt.");
-            it = past;
-            return value;
-        } else {
-            auto word = scanWord();
-            auto it = mapNodeIds.find(word);
-            if (it != mapNodeIds.end())
-                return it->second;
-            auto result = mapNodeIds.insert({word, graph.addNode()});
-            if (!result.second)
-                throw std::runtime_error("Error in mapping nodes");
-            return result.first->second;
+    std::vector<ChunkData> chunks(numberOfChunks);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numberOfChunks); ++c) {
+        try {
+            parser.parseChunk(chunks[c], begin, chunkBegin[c], chunkBegin[c + 1], weighted);
+        } catch (...) {
+            chunks[c].error = std::current_exception();
         }
-    };
+    }
 
-    auto scanWeight = [&it]() -> edgeweight {
-        char *past;
-        auto value = strtod(it, &past);
-        if (past <= it)
-            throw std::runtime_error("Error in parsing file - looking for weight failed");
-        it = past;
-        return value;
-    };
+    for (const auto &chunk : chunks) {
+        if (chunk.error)
+            std::rethrow_exception(chunk.error);
+    }
 
-    // Returns
-    // 0 iff it does not point to a line ending
-    // 1 iff it is a single-char ending ('\r' or '\n')
-    // 2 iff it is two-char ending ("\r\n")
-    auto detectLineEnding = [&it, &end]() -> size_t {
-        if (*it == '\r') {
-            if ((it + 1) != end && *(it + 1) == '\n')
-                return 2;
-            return 1;
+    // Assign global node ids. Ids are merged in file order, hence every node receives the same id
+    // as if the file was read sequentially.
+    count numberOfNodes = 0;
+    if (continuous) {
+        for (const auto &chunk : chunks) {
+            if (!chunk.edges.empty())
+                numberOfNodes = std::max<count>(numberOfNodes, chunk.maxId + 1);
+        }
+    } else {
+        std::unordered_map<std::string_view, node> globalIds;
+        std::vector<std::vector<node>> localToGlobal(numberOfChunks);
+        for (index c = 0; c < numberOfChunks; ++c) {
+            localToGlobal[c].reserve(chunks[c].idsInOrder.size());
+            for (const auto word : chunks[c].idsInOrder) {
+                const auto pos = globalIds.try_emplace(word, globalIds.size()).first;
+                localToGlobal[c].push_back(pos->second);
+            }
+            chunks[c].localIds.clear();
         }
-        if (*it == '\n')
-            return 1;
+        numberOfNodes = globalIds.size();
 
-        return 0;
-    };
+#pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index c = 0; c < static_cast<omp_index>(numberOfChunks); ++c) {
+            for (auto &edge : chunks[c].edges) {
+                edge.source = localToGlobal[c][edge.source];
+                edge.target = localToGlobal[c][edge.target];
+            }
+        }
 
-    // Map nodes and increase graph size
-    auto mapNode = [&](node in) -> node {
-        if (graph.upperNodeIdBound() <= in - firstNode)
-            graph.addNodes(in - firstNode - graph.upperNodeIdBound() + 1);
+        for (const auto &[word, u] : globalIds)
+            mapNodeIds.emplace(word, u);
+    }
 
-        return in - firstNode;
-    };
+    // Concatenate the chunks in file order.
+    std::vector<index> chunkOffset(numberOfChunks + 1, 0);
+    for (index c = 0; c < numberOfChunks; ++c)
+        chunkOffset[c + 1] = chunkOffset[c] + chunks[c].edges.size();
 
-    // This function modifies the graph on input.
-    auto handleEdge = [&graph](node source, node target, edgeweight weight) -> void {
-        if (!graph.hasEdge(source, target)) {
-            graph.addEdge(source, target, weight);
-        }
+    std::vector<ParsedEdge> edges(chunkOffset.back());
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numberOfChunks); ++c) {
+        std::copy(chunks[c].edges.begin(), chunks[c].edges.end(), edges.begin() + chunkOffset[c]);
+        std::vector<ParsedEdge>().swap(chunks[c].edges);
+    }
+
+    // Multiple occurrences of an edge are ignored, only the first one in the file is kept. The
+    // occurrences are found by sorting the positions of the edges; the edges themselves stay in
+    // file order, which determines the order of the neighbors (and thus the edge ids).
+    auto edgeKey = [&](const ParsedEdge &edge) -> std::pair<node, node> {
+        if (directed || edge.source <= edge.target)
+            return {edge.source, edge.target};
+        return {edge.target, edge.source};
     };
+    std::vector<index> positions(edges.size());
+    std::iota(positions.begin(), positions.end(), 0);
+    Aux::Parallel::sort(positions.begin(), positions.end(), [&](index a, index b) {
+        const auto keyA = edgeKey(edges[a]), keyB = edgeKey(edges[b]);
+        return keyA < keyB || (keyA == keyB && a < b);
+    });
+    std::vector<uint8_t> isRepetition(edges.size(), 0);
+#pragma omp parallel for
+    for (omp_index i = 1; i < static_cast<omp_index>(positions.size()); ++i)
+        if (edgeKey(edges[positions[i]]) == edgeKey(edges[positions[i - 1]]))
+            isRepetition[positions[i]] = 1;
+    std::vector<index>().swap(positions);
+
+    // The builder keeps the order of the edges added by each thread and concatenates the threads
+    // in order, so contiguous blocks of edges per thread preserve the file order.
+    GraphBuilder builder(numberOfNodes, weighted, directed, true);
+#pragma omp parallel for schedule(static)
+    for (omp_index i = 0; i < static_cast<omp_index>(edges.size()); ++i)
+        if (!isRepetition[i])
+            builder.addHalfEdge(edges[i].source, edges[i].target, edges[i].weight);
+
+    return builder.completeGraph();
+}
+
+StreamingGraphReader::StreamProperties
+EdgeListReader::forEdgeBatches(std::string_view path, const EdgeBatchCallback &callback,
+                               count batchSize) {
+    this->mapNodeIds.clear();
+    MemoryMappedFile mmfile(path);
+    const char *const begin = mmfile.cbegin();
+    const char *const end = mmfile.cend();
 
-    while (it < end) {
-        skipWhitespaceAndSeparator();
-        if (detectLineEnding()) {
-            // Comment line
-        } else if (*it == commentPrefix[0]) {
-            while (it != end && !detectLineEnding())
-                ++it;
+    const EdgeListParser parser(separator, commentPrefix[0], firstNode, continuous);
+    const bool weighted = parser.detectWeighted(begin, end);
+
+    std::unordered_map<std::string_view, node> globalIds;
+    std::vector<node> localToGlobal;
+    std::vector<WeightedEdge> batch;
+    batch.reserve(std::min<count>(batchSize, defaultBatchSize));
+    count numberOfNodes = 0;
+
+    // The file is parsed in slices of whole lines, so that only one slice is held in memory.
+    constexpr std::ptrdiff_t sliceSize = 1 << 20;
+    for (const char *it = begin; it < end;) {
+        const char *sliceEnd =
+            end - it > sliceSize ? EdgeListParser::nextLine(it + sliceSize - 1, end) : end;
+
+        ChunkData slice;
+        parser.parseChunk(slice, begin, it, sliceEnd, weighted);
+        it = sliceEnd;
+
+        if (continuous) {
+            if (!slice.edges.empty())
+                numberOfNodes = std::max<count>(numberOfNodes, slice.maxId + 1);
         } else {
-            auto sourceId = scanId();
-            if (it == end)
-                throw std::runtime_error("Unexpected end of file");
-            if (!(*it == ' ' || *it == separator))
-                throw std::runtime_error(
-                    "Error in parsing file - pointer is whitespace or separator");
-            skipWhitespaceAndSeparator();
-
-            auto targetId = scanId();
-            skipWhitespaceAndSeparator();
-
-            if (!checkedWeighted) {
-                checkedWeighted = true;
-                if (!detectLineEnding()) {
-                    weighted = true;
-                    DEBUG("Detected graph as weighted");
-                    graph = GraphTools::toWeighted(graph);
-                }
+            localToGlobal.clear();
+            for (const auto word : slice.idsInOrder) {
+                const auto pos = globalIds.try_emplace(word, globalIds.size()).first;
+                localToGlobal.push_back(pos->second);
             }
-            if (weighted) {
-                auto edgeWeight = scanWeight();
-                skipWhitespaceAndSeparator();
+            numberOfNodes = globalIds.size();
+        }
 
-                handleEdge(mapNode(sourceId), mapNode(targetId), edgeWeight);
-            } else {
-                handleEdge(mapNode(sourceId), mapNode(targetId), defaultEdgeWeight);
+        for (const ParsedEdge &edge : slice.edges) {
+            if (continuous)
+                batch.emplace_back(edge.source, edge.target, edge.weight);
+            else
+                batch.emplace_back(localToGlobal[edge.source], localToGlobal[edge.target],
+                                   edge.weight);
+            if (batch.size() >= batchSize) {
+                callback(batch);
+                batch.clear();
             }
         }
-        ++it;
     }
 
-    graph.shrinkToFit();
-    return graph;
+    if (!batch.empty())
+        callback(batch);
+
+    for (const auto &[word, u] : globalIds)
+        mapNodeIds.emplace(word, u);
+
+    return {numberOfNodes, weighted, directed, DISCARD_EDGES};
 }
 
 } /* namespace NetworKit */
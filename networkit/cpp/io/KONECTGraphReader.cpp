@@ -9,6 +9,11 @@
  *
  */
 
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <tlx/unused.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
@@ -16,31 +21,45 @@
 #include <networkit/io/MemoryMappedFile.hpp>
 
 namespace NetworKit {
-KONECTGraphReader::KONECTGraphReader(bool remapNodes, MultipleEdgesHandling handlingmethod)
-    : remapNodes(remapNodes), multipleEdgesHandlingMethod(handlingmethod) {}
 
-Graph KONECTGraphReader::read(std::string_view path) {
+namespace {
+
+// Parser shared by read() and forEdgeBatches(). The constructor parses the property lines,
+// forEdges() the edge lines.
+class KONECTParser {
+public:
     std::string graphFormat = "";
     std::string graphType = "";
     count numberOfNodes = -1;
     count numberOfEdges = -1;
-
     bool directed = true;
     bool weighted = false;
     bool multiple = false;
     int valuesPerLine = 2;
     bool secondPropertyLine = false;
-    std::unordered_map<node, node> nodeIdMap;
 
-    MemoryMappedFile mmfile(path);
-    auto it = mmfile.cbegin();
-    auto end = mmfile.cend();
+    KONECTParser(const char *begin, const char *end,
+                 GraphReader::MultipleEdgesHandling multipleEdgesHandlingMethod);
+
+    // Number of nodes of the graph: the declared number of nodes (if any) or the number of nodes
+    // mapped so far.
+    count mappedNodes() const { return secondPropertyLine ? numberOfNodes : nodesAdded; }
+
+    // Calls handle(source, target, weight) for every edge line in file order.
+    template <typename Handler>
+    void forEdges(bool remapNodes, Handler &&handle);
+
+private:
+    const char *it;
+    const char *const end;
+    std::unordered_map<node, node> nodeIdMap;
+    count nodesAdded = 0;
 
     // Returns
     // 0 iff it does not point to a line ending
     // 1 iff it is a single-char ending ('\r' or '\n')
     // 2 iff it is two-char ending ("\r\n")
-    auto detectLineEnding = [&]() -> size_t {
+    size_t detectLineEnding() const {
         if (*it == '\r') {
             if ((it + 1) != end && *(it + 1) == '\n')
                 return 2;
@@ -48,44 +67,41 @@ Graph KONECTGraphReader::read(std::string_view path) {
         }
         if (*it == '\n')
             return 1;
-
         return 0;
-    };
+    }
 
     // Returns true if a line ending was found and skipped
-    auto skipLineEnding = [&](bool required) -> bool {
+    bool skipLineEnding(bool required) {
         auto length = detectLineEnding();
         if (length) {
             it += length;
             return true;
         }
-
         if (required)
             throw std::runtime_error("No break symbol after first property line");
-
         return false;
-    };
+    }
 
     // The following functions are helpers for parsing.
-    auto skipWhitespace = [&] {
+    void skipWhitespace() {
         while (it != end && (*it == ' ' || *it == '\t'))
             ++it;
         if (it == end) { // proper error message if file ends unexpected
             throw std::runtime_error("Unexpected end of file. Whitespace at end of file found");
         }
-    };
+    }
 
     // This function parses in whole words
-    auto scanWord = [&]() {
+    std::string scanWord() {
         std::string word = "";
         while (it != end && *it != ' ' && *it != '\t' && *it != '\n' && *it != '\r') {
             word += *it;
             ++it;
         }
         return word;
-    };
+    }
 
-    auto scanId = [&]() -> node {
+    node scanId() {
         char *past;
         auto value = strtol(it, &past, 10);
         if (past <= it) {
@@ -93,9 +109,9 @@ Graph KONECTGraphReader::read(std::string_view path) {
         }
         it = past;
         return value;
-    };
+    }
 
-    auto scanWeight = [&]() -> edgeweight {
+    edgeweight scanWeight() {
         char *past;
         auto value = strtod(it, &past);
         if (past <= it) {
@@ -103,16 +119,48 @@ Graph KONECTGraphReader::read(std::string_view path) {
         }
         it = past;
         return value;
-    };
+    }
+
+    // Map nodes and increase graph size if no second property is defined
+    node mapNode(node in, bool remapNodes) {
+        if (secondPropertyLine) {
+            if (in <= numberOfNodes)
+                return in - 1; // minus firstNode
 
+            // if file is corrupted secondPropertyLine is made useless
+            ERROR("Given number of nodes by file does not match actual graph");
+            secondPropertyLine = false;
+            nodesAdded = numberOfNodes;
+            if (remapNodes) { // if remapNodes is selected true, the map has to be initalized
+                              // with the existing nodes
+                nodeIdMap.reserve(numberOfNodes);
+                for (node u = 0; u < numberOfNodes; ++u)
+                    nodeIdMap.insert({u, u});
+            }
+        }
+
+        if (remapNodes) {
+            auto pos = nodeIdMap.find(in);
+            if (pos != nodeIdMap.end())
+                return pos->second;
+            auto result = nodeIdMap.insert({in, nodesAdded++});
+            assert(result.second);
+            return result.first->second;
+        }
+        nodesAdded = std::max<count>(nodesAdded, in);
+        return in - 1;
+    }
+};
+
+KONECTParser::KONECTParser(const char *begin, const char *end,
+                           GraphReader::MultipleEdgesHandling multipleEdgesHandlingMethod)
+    : it(begin), end(end) {
     // parse graph properties
     if (*it == '%') {
         ++it;
         skipWhitespace();
-
         // Parse graph format directed / undirected
         graphFormat = scanWord();
-
         if (graphFormat == "sym" || graphFormat == "bip") {
             directed = false;
         } else if (graphFormat != "asym") {
@@ -127,7 +175,7 @@ Graph KONECTGraphReader::read(std::string_view path) {
             weighted = true;
             valuesPerLine = 3;
         } else if (graphType == "positive") { // multiple edges
-            if (multipleEdgesHandlingMethod == SUM_WEIGHTS_UP) {
+            if (multipleEdgesHandlingMethod == GraphReader::SUM_WEIGHTS_UP) {
                 weighted = true;
             }
             multiple = true; // weights will be added
@@ -154,7 +202,6 @@ Graph KONECTGraphReader::read(std::string_view path) {
     } else {
         throw std::runtime_error("No graph properties line found. This line is mandatory.");
     }
-
     skipWhitespace();
     skipLineEnding(true);
     skipWhitespace();
@@ -171,75 +218,15 @@ Graph KONECTGraphReader::read(std::string_view path) {
         if (it >= end) { // proper error message if file ends unexpected
             throw std::runtime_error("Unexpected end of file");
         }
-
         skipLineEnding(true);
         DEBUG("Second property line read in. Edges: " + std::to_string(numberOfEdges)
               + " / Nodes: " + std::to_string(numberOfNodes));
         tlx::unused(numberOfEdges);
     }
+}
 
-    Graph graph((secondPropertyLine ? numberOfNodes : 0), weighted, directed);
-
-    // Map nodes and increase graph size if no second property is defined
-    std::function<node(node)> mapNode = [&](node in) -> node {
-        if (secondPropertyLine) {
-            if (in > numberOfNodes) { // if file is corrupted
-                // secondPropertyLine is made useless
-                ERROR("Given number of nodes by file does not match actual graph");
-                secondPropertyLine = false;
-                if (remapNodes) { // if remapNodes is selected true, the map has to be initalized
-                                  // with the existing nodes
-                    nodeIdMap.reserve(numberOfNodes);
-                    graph.forNodes([&](node u) { nodeIdMap.insert({u, u}); });
-                }
-                return mapNode(in);
-            } else {
-                return in - 1; // minus firstNode
-            }
-        } else {
-            if (remapNodes) {
-                auto it = nodeIdMap.find(in);
-                if (it != nodeIdMap.end())
-                    return it->second;
-                auto result = nodeIdMap.insert({in, graph.addNode()});
-                assert(result.second);
-                return result.first->second;
-            } else {
-                for (count i = graph.upperNodeIdBound(); i < in; i++)
-                    graph.addNode();
-                return in - 1;
-            }
-        }
-    };
-
-    // Helper function for handling edges
-    auto handleEdge = [&](node source, node target, edgeweight weight) {
-        if (!graph.hasEdge(source, target)) {
-            if (!graph.addEdge(source, target, weight, true))
-                WARN("Not adding edge ", source, "-", target, " since it is already present.");
-        } else if (multiple) {
-            switch (multipleEdgesHandlingMethod) {
-            case DISCARD_EDGES:
-                break; // Do nothing
-            case SUM_WEIGHTS_UP:
-                graph.increaseWeight(source, target, weight);
-                break;
-            case KEEP_MINIMUM_WEIGHT:
-                if (graph.weight(source, target) > weight) {
-                    graph.setWeight(source, target, weight);
-                }
-                break;
-            default:
-                throw std::runtime_error("Invalid multipleEdgesHandlingMethod: "
-                                         + std::to_string(multipleEdgesHandlingMethod));
-            }
-        } else {
-            DEBUG("[" + std::to_string(source) + "->" + std::to_string(target)
-                  + "] Multiple edges detected but declared as: " + graphFormat + " and "
-                  + graphType);
-        }
-    };
-
+template <typename Handler>
+void KONECTParser::forEdges(bool remapNodes, Handler &&handle) {
     while (it != end) {
         skipWhitespace();
         if (skipLineEnding(false)) {
@@ -259,25 +246,91 @@ Graph KONECTGraphReader::read(std::string_view path) {
                 throw std::runtime_error("Target ID cannot be parsed, maybe the file is corrupt");
             }
             skipWhitespace();
-
             auto targetId = scanId();
             if (it >= end) { // proper error message if file ends unexpected
                 throw std::runtime_error("Unexpected end of file");
             }
             skipWhitespace();
-            if (valuesPerLine > 2) {
-                auto edgeWeight = scanWeight();
-                handleEdge(mapNode(sourceId), mapNode(targetId), edgeWeight);
-            } else {
-                handleEdge(mapNode(sourceId), mapNode(targetId), defaultEdgeWeight);
-            }
+            edgeweight edgeWeight = defaultEdgeWeight;
+            if (valuesPerLine > 2)
+                edgeWeight = scanWeight();
+            const node source = mapNode(sourceId, remapNodes);
+            handle(source, mapNode(targetId, remapNodes), edgeWeight);
         }
         // break lines
         skipWhitespace();
         skipLineEnding(true);
     }
+}
+
+} // namespace
+
+KONECTGraphReader::KONECTGraphReader(bool remapNodes, MultipleEdgesHandling handlingmethod)
+    : remapNodes(remapNodes), multipleEdgesHandlingMethod(handlingmethod) {}
+
+Graph KONECTGraphReader::read(std::string_view path) {
+    MemoryMappedFile mmfile(path);
+    KONECTParser parser(mmfile.cbegin(), mmfile.cend(), multipleEdgesHandlingMethod);
+
+    Graph graph(parser.mappedNodes(), parser.weighted, parser.directed);
+
+    // Helper function for handling edges
+    auto handleEdge = [&](node source, node target, edgeweight weight) {
+        if (parser.mappedNodes() > graph.upperNodeIdBound())
+            graph.addNodes(parser.mappedNodes() - graph.upperNodeIdBound());
+
+        if (!graph.hasEdge(source, target)) {
+            if (!graph.addEdge(source, target, weight, true))
+                WARN("Not adding edge ", source, "-", target, " since it is already present.");
+        } else if (parser.multiple) {
+            switch (multipleEdgesHandlingMethod) {
+            case DISCARD_EDGES:
+                break; // Do nothing
+            case SUM_WEIGHTS_UP:
+                graph.increaseWeight(source, target, weight);
+                break;
+            case KEEP_MINIMUM_WEIGHT:
+                if (graph.weight(source, target) > weight) {
+                    graph.setWeight(source, target, weight);
+                }
+                break;
+            default:
+                throw std::runtime_error("Invalid multipleEdgesHandlingMethod: "
+                                         + std::to_string(multipleEdgesHandlingMethod));
+            }
+        } else {
+            DEBUG("[" + std::to_string(source) + "->" + std::to_string(target)
+                  + "] Multiple edges detected but declared as: " + parser.graphFormat + " and "
+                  + parser.graphType);
+        }
+    };
+
+    parser.forEdges(remapNodes, handleEdge);
 
     graph.shrinkToFit();
     return graph;
 }
+
+StreamingGraphReader::StreamProperties
+KONECTGraphReader::forEdgeBatches(std::string_view path, const EdgeBatchCallback &callback,
+                                  count batchSize) {
+    MemoryMappedFile mmfile(path);
+    KONECTParser parser(mmfile.cbegin(), mmfile.cend(), multipleEdgesHandlingMethod);
+
+    std::vector<WeightedEdge> batch;
+    batch.reserve(std::min<count>(batchSize, defaultBatchSize));
+    parser.forEdges(remapNodes, [&](node source, node target, edgeweight weight) {
+        batch.emplace_back(source, target, weight);
+        if (batch.size() >= batchSize) {
+            callback(batch);
+            batch.clear();
+        }
+    });
+    if (!batch.empty())
+        callback(batch);
+
+    return {parser.mappedNodes(), parser.weighted, parser.directed,
+            parser.multiple ? multipleEdgesHandlingMethod : DISCARD_EDGES};
+}
+
 } // namespace NetworKit
@@ -5,11 +5,21 @@
  *      Author: Christian Staudt
  */
 
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <numeric>
+#include <omp.h>
+#include <utility>
+#include <vector>
+
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/NumberParsing.hpp>
 #include <networkit/auxiliary/StringTools.hpp>
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/io/METISParser.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
 
 namespace NetworKit {
 
@@ -42,73 +52,128 @@ Graph METISGraphReader::read(std::string_view path) {
 
     INFO("\n[BEGIN] reading graph G(n=", n, ", m=", m, ") from METIS file: ", graphName);
 
-#ifndef NETWORKIT_RELEASE_LOGGING
-    double p = 0.0; // percentage for progress bar
-#endif
-    node u = 0; // begin with 0
-    count edgeCounter = 0;
-    count selfLoops = 0;
-    if (weighted == 0) {
-        while (parser.hasNext() && u < n) {
-            std::vector<node> adjacencies = parser.getNext(ignoreFirst);
-            edgeCounter += adjacencies.size();
-            for (index i = 0; i < adjacencies.size(); i++) {
-                if (adjacencies[i] == 0) {
-                    ERROR("METIS Node ID should not be 0, edge ignored.");
-                    continue;
-                }
-                Aux::Checkers::Enforcer::enforce(adjacencies[i] > 0 && adjacencies[i] <= n);
-                node v = adjacencies[i] - 1; // METIS-indices are 1-based
-                // correct edgeCounter for selfloops
-                if (u == v) {
-                    edgeCounter++;
-                    selfLoops++;
+    // The adjacency lines are parsed in parallel from the mapped file. Line i (not counting
+    // comments) holds the neighbors of node i, hence every line can be added to the graph
+    // independently.
+    MemoryMappedFile mmfile(path);
+    const char *const end = mmfile.cend();
+
+    auto nextLine = [](const char *it, const char *chunkEnd) -> const char * {
+        it = std::find(it, chunkEnd, '\n');
+        return it == chunkEnd ? chunkEnd : it + 1;
+    };
+
+    // Skip the comments and the header line, they have already been read by the parser.
+    const char *begin = mmfile.cbegin();
+    while (begin != end && *begin == '%')
+        begin = nextLine(begin, end);
+    begin = nextLine(begin, end);
+
+    // Split the file into chunks that start at the beginning of a line.
+    const count numberOfChunks =
+        std::min<count>(4 * omp_get_max_threads(), (end - begin) / (1 << 16) + 1);
+    std::vector<const char *> chunkBegin(numberOfChunks + 1, end);
+    for (index c = 0; c < numberOfChunks; ++c) {
+        const char *it = begin + c * (end - begin) / numberOfChunks;
+        if (it != begin)
+            it = nextLine(it - 1, end);
+        chunkBegin[c] = it;
+    }
+
+    // firstNode[c] is the node described by the first adjacency line of chunk c.
+    std::vector<node> firstNode(numberOfChunks + 1, 0);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numberOfChunks); ++c) {
+        count lines = 0;
+        for (const char *it = chunkBegin[c]; it < chunkBegin[c + 1];
+             it = nextLine(it, chunkBegin[c + 1])) {
+            if (*it != '%')
+                ++lines;
+        }
+        firstNode[c + 1] = lines;
+    }
+    std::partial_sum(firstNode.begin(), firstNode.end(), firstNode.begin());
+
+    auto dropSpaces = [](const char *it, const char *lineEnd) -> const char * {
+        while (it != lineEnd && std::isspace(*it))
+            ++it;
+        return it;
+    };
+
+    // Adds the adjacencies of u listed in [it, lineEnd) to the graph.
+    auto parseLine = [&](node u, const char *it, const char *lineEnd,
+                         std::vector<std::pair<node, edgeweight>> &adjacencies, count &edgeCounter,
+                         count &selfLoops) {
+        adjacencies.clear();
+        for (index i = 0; i < ignoreFirst; ++i) {
+            // parse first values but ignore them.
+            it = std::get<1>(Aux::Parsing::strTo<double>(it, lineEnd));
+        }
+        for (it = dropSpaces(it, lineEnd); it != lineEnd; it = dropSpaces(it, lineEnd)) {
+            node v;
+            edgeweight weight = defaultEdgeWeight;
+            if (!weighted) {
+                std::tie(v, it) = Aux::Parsing::strTo<node>(it, lineEnd);
+            } else {
+                try {
+                    std::tie(v, it) = Aux::Parsing::strTo<node>(it, lineEnd);
+                    std::tie(weight, it) =
+                        Aux::Parsing::strTo<double, const char *, Aux::Checkers::Enforcer>(
+                            it, lineEnd);
+                } catch (const std::exception &) {
+                    ERROR("malformed line; not all edges have been read correctly");
+                    break;
                 }
-                if (!G.addPartialEdge(unsafe, u, v, defaultEdgeWeight, 0, true))
-                    WARN("Not adding edge ", u, "-", v, " since it is already present.");
             }
-            u++; // next node
-#ifndef NETWORKIT_RELEASE_LOGGING
-            if ((u % ((n + 10) / 10)) == 0) {
-                p = ((double)(u - 1) / (double)n) * 100;
-                DEBUG(p, "% ");
+            adjacencies.emplace_back(v, weight);
+        }
+
+        edgeCounter += adjacencies.size();
+        G.preallocateUndirected(u, adjacencies.size());
+        for (const auto &[v1, weight] : adjacencies) {
+            if (v1 == 0) {
+                ERROR("METIS Node ID should not be 0, edge ignored.");
+                continue;
+            }
+            Aux::Checkers::Enforcer::enforce(v1 <= n);
+            node v = v1 - 1; // METIS-indices are 1-based
+            // correct edgeCounter for selfloops
+            if (u == v) {
+                edgeCounter++;
+                selfLoops++;
             }
-#endif
+            if (!G.addPartialEdge(unsafe, u, v, weight, 0, true))
+                WARN("Not adding edge ", u, "-", v, " since it is already present.");
         }
-    } else {
-        while (parser.hasNext() && u < n) {
-            std::vector<std::pair<node, double>> adjacencies =
-                parser.getNextWithWeights(ignoreFirst);
-            edgeCounter += adjacencies.size();
-            DEBUG("node ", u, " has ", adjacencies.size(), " edges");
-            for (index i = 0; i < adjacencies.size(); i++) {
-                if (adjacencies[i].first == 0) {
-                    ERROR("METIS Node ID should not be 0, edge ignored.");
+    };
+
+    std::vector<std::exception_ptr> errors(numberOfChunks);
+    count edgeCounter = 0;
+    count selfLoops = 0;
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : edgeCounter, selfLoops)
+    for (omp_index c = 0; c < static_cast<omp_index>(numberOfChunks); ++c) {
+        std::vector<std::pair<node, edgeweight>> adjacencies;
+        const char *const chunkEnd = chunkBegin[c + 1];
+        node u = firstNode[c];
+        try {
+            for (const char *it = chunkBegin[c]; it < chunkEnd && u < n;
+                 it = nextLine(it, chunkEnd)) {
+                if (*it == '%')
                     continue;
-                }
-                Aux::Checkers::Enforcer::enforce(adjacencies[i].first > 0
-                                                 && adjacencies[i].first <= n);
-                node v = adjacencies[i].first - 1; // METIS-indices are 1-based
-                // correct edgeCounter for selfloops
-                if (u == v) {
-                    edgeCounter++;
-                    selfLoops++;
-                }
-                double weight = adjacencies[i].second;
-                if (!G.addPartialEdge(unsafe, u, v, weight, 0, true))
-                    WARN("Not adding edge ", u, "-", v, " since it is already present.");
-                else
-                    TRACE("(", u, ",", v, ",", adjacencies[i].second, ")");
-            }
-            u += 1; // next node
-#ifndef NETWORKIT_RELEASE_LOGGING
-            if ((u % ((n + 10) / 10)) == 0) {
-                p = ((double)(u - 1) / (double)n) * 100;
-                DEBUG(p, "% ");
+                const char *lineEnd = std::find(it, chunkEnd, '\n');
+                parseLine(u, it, lineEnd, adjacencies, edgeCounter, selfLoops);
+                ++u; // next node
             }
-#endif
+        } catch (...) {
+            errors[c] = std::current_exception();
         }
     }
+
+    for (const auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
     G.setEdgeCount(unsafe, edgeCounter / 2);
     G.setNumberOfSelfLoops(unsafe, selfLoops);
     if (G.numberOfEdges() != m) {
@@ -1,8 +1,17 @@
-#include <networkit/auxiliary/Enforce.hpp>
-#include <networkit/auxiliary/Log.hpp>
-#include <networkit/auxiliary/StringTools.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <exception>
+#include <omp.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <networkit/auxiliary/NumberParsing.hpp>
+#include <networkit/graph/GraphBuilder.hpp>
 #include <networkit/io/MTXGraphReader.hpp>
 #include <networkit/io/MTXParser.hpp>
+#include <networkit/io/MemoryMappedFile.hpp>
 
 namespace NetworKit {
 
@@ -19,18 +28,98 @@ Graph MTXGraphReader::read(std::string_view path) {
     if (header.symmetry == MTXParser::Symmetry::General)
         symmetric = false;
 
-    Graph G(std::max(size.rows, size.columns), weighted, !symmetric);
-    std::string graphName =
-        Aux::StringTools::split(Aux::StringTools::split(path, '/').back(), '.').front();
+    const count n = std::max(size.rows, size.columns);
+
+    // The entries are parsed in parallel from the mapped file, every thread adds its entries to
+    // the GraphBuilder.
+    MemoryMappedFile mmfile(path);
+    const char *const end = mmfile.cend();
+
+    auto nextLine = [](const char *it, const char *chunkEnd) -> const char * {
+        it = std::find(it, chunkEnd, '\n');
+        return it == chunkEnd ? chunkEnd : it + 1;
+    };
+
+    // Skip the header, the comments and the size line, they have already been read by the parser.
+    const char *begin = nextLine(mmfile.cbegin(), end);
+    while (begin != end && *begin == '%')
+        begin = nextLine(begin, end);
+    begin = nextLine(begin, end);
+
+    // Split the file into chunks that start at the beginning of a line.
+    const count numberOfChunks =
+        std::min<count>(4 * omp_get_max_threads(), (end - begin) / (1 << 16) + 1);
+    std::vector<const char *> chunkBegin(numberOfChunks + 1, end);
+    for (index c = 0; c < numberOfChunks; ++c) {
+        const char *it = begin + c * (end - begin) / numberOfChunks;
+        if (it != begin)
+            it = nextLine(it - 1, end);
+        chunkBegin[c] = it;
+    }
+
+    auto dropSpaces = [](const char *it, const char *lineEnd) -> const char * {
+        while (it != lineEnd && std::isspace(*it))
+            ++it;
+        return it;
+    };
+
+    auto parseNode = [&](const char *&it, const char *lineEnd) -> node {
+        if (it == lineEnd || !std::isdigit(static_cast<unsigned char>(*it)))
+            throw std::runtime_error("Invalid MTX file structure. Missing node index.");
+        node v;
+        std::tie(v, it) = Aux::Parsing::strTo<node>(it, lineEnd);
+        if (v == 0 || v > n)
+            throw std::runtime_error("Invalid MTX file structure. Node index out of range.");
+        return v - 1; // MTX indices are 1-based
+    };
+
+    GraphBuilder builder(n, weighted, !symmetric, true);
+    std::vector<std::exception_ptr> errors(numberOfChunks);
 
-    auto current_edge = parser.getNext(weighted);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index c = 0; c < static_cast<omp_index>(numberOfChunks); ++c) {
+        const char *const chunkEnd = chunkBegin[c + 1];
+        std::string token; // strtod requires a null-terminated string
+        const char *it = chunkBegin[c];
+        try {
+            for (; it < chunkEnd; it = nextLine(it, chunkEnd)) {
+                const char *lineEnd = std::find(it, chunkEnd, '\n');
+                const char *pos = dropSpaces(it, lineEnd);
+                if (pos == lineEnd)
+                    continue;
+                if (*pos == '%')
+                    throw std::runtime_error(
+                        "Invalid MTX file structure. No comments allowed after size line.");
 
-    while (current_edge.has_value()) {
-        WeightedEdge e = current_edge.value();
-        G.addEdge(e.u, e.v, e.weight);
-        current_edge = parser.getNext(weighted);
+                const node u = parseNode(pos, lineEnd);
+                const node v = parseNode(pos, lineEnd);
+                edgeweight w = defaultEdgeWeight;
+                if (weighted) {
+                    token.assign(pos, std::find_if(pos, lineEnd,
+                                                   [](char ch) { return std::isspace(ch); }));
+                    char *past;
+                    w = std::strtod(token.c_str(), &past);
+                    if (token.empty() || past == token.c_str())
+                        throw std::runtime_error("Invalid MTX file structure. Missing weight.");
+                }
+                builder.addHalfEdge(u, v, w);
+            }
+        } catch (const std::exception &e) {
+            // Lines are only counted on errors, the chunks do not know their first line.
+            const auto line = std::count(mmfile.cbegin(), it, '\n') + 1;
+            errors[c] = std::make_exception_ptr(
+                std::runtime_error(std::string(e.what()) + " (line " + std::to_string(line) + ")"));
+        } catch (...) {
+            errors[c] = std::current_exception();
+        }
     }
-    return G;
-} // namespace NetworKit
+
+    for (const auto &error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    return builder.completeGraph();
+}
 
 } /* namespace NetworKit */
@@ -157,6 +157,8 @@ void MemoryMappedFile::close() noexcept {
     if (beginIt) {
         munmap(reinterpret_cast<void *>(const_cast<value_type *>(beginIt)),
                std::distance(beginIt, endIt));
+        beginIt = nullptr;
+        endIt = nullptr;
     }
 }
 } // namespace NetworKit
@@ -6,7 +6,10 @@
  */
 
 #include <atomic>
+#include <cstdint>
 #include <fstream>
+#include <span>
+#include <stdexcept>
 
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
@@ -23,16 +26,101 @@ const char *accessData(const std::vector<uint8_t> &source) {
 
 namespace NetworKit {
 
+namespace {
+
+bool isCSRVariant(const char *data, size_t size) {
+    return size >= 8 && !memcmp("nkbgcsr", data, 8);
+}
+
+CSRGraph mapCSR(const char *data, size_t size, std::shared_ptr<const void> owner) {
+    nkbg::CSRHeader header;
+    if (size < sizeof(nkbg::CSRHeader))
+        throw std::runtime_error("File is too small to contain a CSR graph");
+    memcpy(&header, data, sizeof(nkbg::CSRHeader));
+    if (memcmp("nkbgcsr", header.magic, 8))
+        throw std::runtime_error("Reader expected another magic value");
+    if (reinterpret_cast<uintptr_t>(data) % alignof(uint64_t))
+        throw std::runtime_error("CSR graph data is not aligned");
+    if (static_cast<bool>(header.features & nkbg::INDEX_32BIT_MASK)
+        != (sizeof(index) == sizeof(uint32_t)))
+        throw std::runtime_error("CSR graph was written with a different node id width");
+
+    const auto weightFormat =
+        static_cast<nkbg::WeightFormat>((header.features & nkbg::WGHT_MASK) >> nkbg::WGHT_SHIFT);
+    if (weightFormat != nkbg::WeightFormat::NONE && weightFormat != nkbg::WeightFormat::DOUBLE)
+        throw std::runtime_error("CSR graphs only support double weights");
+
+    CSRGraph::Arrays arrays;
+    arrays.numberOfNodes = header.numberOfNodes;
+    arrays.numberOfEdges = header.numberOfEdges;
+    arrays.numberOfSelfLoops = header.numberOfSelfLoops;
+    arrays.upperEdgeIdBound = header.upperEdgeIdBound;
+    arrays.directed = header.features & nkbg::DIR_MASK;
+    arrays.weighted = weightFormat == nkbg::WeightFormat::DOUBLE;
+    arrays.edgesIndexed = (header.features & nkbg::INDEX_MASK) >> nkbg::INDEX_SHIFT;
+
+    if (header.nodes == none)
+        throw std::runtime_error("Invalid number of nodes");
+    arrays.exists = mappedSection<uint8_t>(data, size, header.offsetNodeFlags, header.nodes);
+
+    auto mapAdjacency = [&](uint64_t offsetOffsets, uint64_t offsetTargets,
+                            uint64_t offsetWeights, uint64_t offsetIds,
+                            std::span<const index> &offsets, std::span<const node> &targets,
+                            std::span<const edgeweight> &weights, std::span<const edgeid> &ids) {
+        offsets = mappedSection<index>(data, size, offsetOffsets, header.nodes + 1);
+        if (offsets.empty())
+            return; // absent, e.g., the in-edges of undirected graphs
+
+        // The graph accesses the arrays without bound checks, so the offsets and the targets are
+        // validated here; mappedSection ensures that the sections lie within the file.
+        const count entries = offsets.back();
+        targets = mappedSection<node>(data, size, offsetTargets, entries);
+        weights = mappedSection<edgeweight>(data, size, offsetWeights, entries);
+        ids = mappedSection<edgeid>(data, size, offsetIds, entries);
+        if (!validOffsets(offsets, entries) || targets.size() != entries)
+            throw std::runtime_error("Invalid adjacency arrays in the CSR graph file");
+        for (const node v : targets)
+            if (v >= header.nodes)
+                throw std::runtime_error("Invalid adjacency arrays in the CSR graph file");
+        for (const edgeid id : ids)
+            if (id >= header.upperEdgeIdBound)
+                throw std::runtime_error("Invalid adjacency arrays in the CSR graph file");
+    };
+
+    mapAdjacency(header.offsetOutOffsets, header.offsetOutTargets, header.offsetOutWeights,
+                 header.offsetOutIds, arrays.outOffsets, arrays.outTargets, arrays.outWeights,
+                 arrays.outIds);
+    mapAdjacency(header.offsetInOffsets, header.offsetInTargets, header.offsetInWeights,
+                 header.offsetInIds, arrays.inOffsets, arrays.inTargets, arrays.inWeights,
+                 arrays.inIds);
+
+    return CSRGraph(arrays, std::move(owner));
+}
+
+} // namespace
+
 Graph NetworkitBinaryReader::read(std::string_view path) {
     MemoryMappedFile mmfile(path);
+    if (isCSRVariant(mmfile.cbegin(), mmfile.size()))
+        return mapCSR(mmfile.cbegin(), mmfile.size(), nullptr).toGraph();
     Graph G = readData(mmfile);
     return G;
 }
 
 Graph NetworkitBinaryReader::readFromBuffer(const std::vector<uint8_t> &data) {
+    const char *begin = accessData(data);
+    if (isCSRVariant(begin, data.size()))
+        return mapCSR(begin, data.size(), nullptr).toGraph();
     return readData(data);
 }
 
+CSRGraph NetworkitBinaryReader::readCSR(std::string_view path) {
+    auto mmfile = std::make_shared<MemoryMappedFile>(path);
+    const char *begin = mmfile->cbegin();
+    const size_t size = mmfile->size();
+    return mapCSR(begin, size, std::move(mmfile));
+}
+
 template <class T>
 Graph NetworkitBinaryReader::readData(const T &source) {
     nkbg::Header header;
@@ -180,7 +268,7 @@ Graph NetworkitBinaryReader::readData(const T &source) {
             }
             // Read adjacency lists.
             for (uint64_t j = 0; j < outNbrs; j++) {
-                edgeid id = 0;
+                uint64_t id = 0;
                 uint64_t add;
                 double weight = defaultEdgeWeight;
                 off += nkbg::varIntDecode(reinterpret_cast<const uint8_t *>(adjIt + off), add);
@@ -230,7 +318,7 @@ Graph NetworkitBinaryReader::readData(const T &source) {
             // Read transpose lists.
             for (uint64_t j = 0; j < inNbrs; j++) {
                 uint64_t add;
-                edgeid id = 0;
+                uint64_t id = 0;
                 double weight = defaultEdgeWeight;
                 transpOff += nkbg::varIntDecode(
                     reinterpret_cast<const uint8_t *>(transpIt + transpOff), add);
@@ -36,6 +36,152 @@ std::vector<uint8_t> NetworkitBinaryWriter::writeToBuffer(const Graph &G) {
     return std::vector<uint8_t>(str.begin(), str.end());
 }
 
+void NetworkitBinaryWriter::writeCSR(const Graph &G, std::string_view path) {
+    std::ofstream outfile(path.data(), std::ios::binary);
+    Aux::enforceOpened(outfile);
+
+    const bool writeWeights = G.isWeighted() && weightsType != NetworkitBinaryWeights::NONE;
+    const bool writeIds = G.hasEdgeIds() && edgeIndex != NetworkitBinaryEdgeIDs::NO_EDGE_IDS;
+    const node z = G.upperNodeIdBound();
+
+    count outEntries = 0;
+    count inEntries = 0;
+    G.forNodes([&](node u) {
+        outEntries += G.degreeOut(u);
+        inEntries += G.degreeIn(u);
+    });
+
+    // Assign page-aligned offsets to all sections.
+    nkbg::CSRHeader header{};
+    uint64_t nextOffset = sizeof(nkbg::CSRHeader);
+    auto reserve = [&](uint64_t bytes) -> uint64_t {
+        nextOffset = (nextOffset + nkbg::CSR_ALIGNMENT - 1) / nkbg::CSR_ALIGNMENT
+                     * nkbg::CSR_ALIGNMENT;
+        const uint64_t offset = nextOffset;
+        nextOffset += bytes;
+        return offset;
+    };
+
+    strncpy(header.magic, "nkbgcsr", 8);
+    header.checksum = 0;
+    const auto weightFormat = writeWeights ? nkbg::WeightFormat::DOUBLE : nkbg::WeightFormat::NONE;
+    header.features =
+        (G.isDirected() & nkbg::DIR_MASK)
+        | ((static_cast<uint64_t>(weightFormat) << nkbg::WGHT_SHIFT) & nkbg::WGHT_MASK)
+        | ((static_cast<uint64_t>(writeIds) << nkbg::INDEX_SHIFT) & nkbg::INDEX_MASK)
+        | (sizeof(index) == sizeof(uint32_t) ? nkbg::INDEX_32BIT_MASK : 0);
+    header.nodes = z;
+    header.numberOfNodes = G.numberOfNodes();
+    header.numberOfEdges = G.numberOfEdges();
+    header.numberOfSelfLoops = G.numberOfSelfLoops();
+    header.upperEdgeIdBound = writeIds ? G.upperEdgeIdBound() : 0;
+
+    if (G.numberOfNodes() != z)
+        header.offsetNodeFlags = reserve(z * sizeof(uint8_t));
+    header.offsetOutOffsets = reserve((z + 1) * sizeof(index));
+    header.offsetOutTargets = reserve(outEntries * sizeof(node));
+    if (writeWeights)
+        header.offsetOutWeights = reserve(outEntries * sizeof(edgeweight));
+    if (writeIds)
+        header.offsetOutIds = reserve(outEntries * sizeof(edgeid));
+    if (G.isDirected()) {
+        header.offsetInOffsets = reserve((z + 1) * sizeof(index));
+        header.offsetInTargets = reserve(inEntries * sizeof(node));
+        if (writeWeights)
+            header.offsetInWeights = reserve(inEntries * sizeof(edgeweight));
+        if (writeIds)
+            header.offsetInIds = reserve(inEntries * sizeof(edgeid));
+    }
+
+    uint64_t position = 0;
+    auto writeBytes = [&](const void *data, uint64_t bytes) {
+        outfile.write(static_cast<const char *>(data), bytes);
+        position += bytes;
+    };
+    auto padTo = [&](uint64_t offset) {
+        assert(position <= offset);
+        const std::vector<char> zeros(offset - position, 0);
+        writeBytes(zeros.data(), zeros.size());
+    };
+
+    // The arrays are streamed through a small buffer, every value is stored with the width of
+    // its type (node ids, edge ids and offsets are 32 bit wide if NETWORKIT_INDEX_32BIT is set).
+    std::vector<char> buffer;
+    buffer.reserve(8192);
+    auto flush = [&]() {
+        writeBytes(buffer.data(), buffer.size());
+        buffer.clear();
+    };
+    auto push = [&](auto value) {
+        const auto *bytes = reinterpret_cast<const char *>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+        if (buffer.size() + sizeof(value) > buffer.capacity())
+            flush();
+    };
+
+    writeBytes(&header, sizeof(nkbg::CSRHeader));
+
+    if (header.offsetNodeFlags) {
+        padTo(header.offsetNodeFlags);
+        std::vector<uint8_t> nodeFlags(z, 0);
+        G.forNodes([&](node u) { nodeFlags[u] = nkbg::DELETED_BIT; });
+        writeBytes(nodeFlags.data(), z * sizeof(uint8_t));
+    }
+
+    auto writeAdjacency = [&](bool inEdges, uint64_t offsetOffsets, uint64_t offsetTargets,
+                              uint64_t offsetWeights, uint64_t offsetIds) {
+        auto forEdgesOf = [&](node u, auto handle) {
+            if (inEdges)
+                G.forInEdgesOf(u, handle);
+            else
+                G.forEdgesOf(u, handle);
+        };
+
+        padTo(offsetOffsets);
+        index sum = 0;
+        push(sum);
+        for (node u = 0; u < z; ++u) {
+            if (G.hasNode(u))
+                sum += inEdges ? G.degreeIn(u) : G.degreeOut(u);
+            push(sum);
+        }
+        flush();
+
+        padTo(offsetTargets);
+        G.forNodes([&](node u) {
+            forEdgesOf(u, [&](node, node v, edgeweight, edgeid) { push(v); });
+        });
+        flush();
+
+        if (offsetWeights) {
+            padTo(offsetWeights);
+            G.forNodes([&](node u) {
+                forEdgesOf(u, [&](node, node, edgeweight ew, edgeid) {
+                    push(ew);
+                });
+            });
+            flush();
+        }
+
+        if (offsetIds) {
+            padTo(offsetIds);
+            G.forNodes([&](node u) {
+                forEdgesOf(u, [&](node, node, edgeweight, edgeid eid) { push(eid); });
+            });
+            flush();
+        }
+    };
+
+    writeAdjacency(false, header.offsetOutOffsets, header.offsetOutTargets,
+                   header.offsetOutWeights, header.offsetOutIds);
+    if (G.isDirected())
+        writeAdjacency(true, header.offsetInOffsets, header.offsetInTargets,
+                       header.offsetInWeights, header.offsetInIds);
+
+    assert(position == nextOffset);
+    INFO("Written graph to ", path);
+}
+
 template <class T>
 void NetworkitBinaryWriter::writeData(T &outStream, const Graph &G) {
     nkbg::WEIGHT_FORMAT weightFormat;
@@ -5,6 +5,9 @@
  *      Author: Alexander van der Grinten
  */
 
+#include <algorithm>
+#include <vector>
+
 #include <networkit/auxiliary/Log.hpp>
 #include <networkit/auxiliary/StringTools.hpp>
 #include <networkit/io/MemoryMappedFile.hpp>
@@ -18,37 +21,56 @@ SNAPGraphReader::SNAPGraphReader(bool directed, const bool &remapNodes, const co
 Graph SNAPGraphReader::read(std::string_view path) {
     Graph graph(0, false, directed);
 
+    const StreamProperties properties = forEdgeBatches(path, [&](EdgeBatch batch) {
+        for (const WeightedEdge &e : batch) {
+            const node maxId = std::max(e.u, e.v);
+            if (maxId >= graph.upperNodeIdBound())
+                graph.addNodes(maxId + 1 - graph.upperNodeIdBound());
+
+            if (!graph.hasEdge(e.u, e.v)) {
+                graph.addEdge(e.u, e.v);
+            } else {
+                DEBUG("[" + std::to_string(e.u) + "->" + std::to_string(e.v)
+                      + "] Multiple edges detected");
+            }
+        }
+    });
+    if (properties.numberOfNodes > graph.upperNodeIdBound())
+        graph.addNodes(properties.numberOfNodes - graph.upperNodeIdBound());
+
+    graph.shrinkToFit();
+    return graph;
+}
+
+StreamingGraphReader::StreamProperties
+SNAPGraphReader::forEdgeBatches(std::string_view path, const EdgeBatchCallback &callback,
+                                count batchSize) {
+    nodeIdMap.clear();
     // In the actual state this parameter has very little influence on the reader performance.
     // There can be a significant boost if it is possible to reserve space in the graph
     // initialization
     if (nodeCount != 0 && remapNodes)
         nodeIdMap.reserve(nodeCount);
 
+    count numberOfNodes = 0;
+
     // Maps SNAP node IDs to consecutive NetworKit node IDs.
     auto mapNode = [&](node in) -> node {
         if (remapNodes) {
             auto it = nodeIdMap.find(in);
             if (it != nodeIdMap.end())
                 return it->second;
-            auto result = nodeIdMap.insert({in, graph.addNode()});
+            auto result = nodeIdMap.insert({in, numberOfNodes++});
             if (!result.second)
                 throw std::runtime_error("Error in mapping nodes");
             return result.first->second;
         }
-        for (count i = graph.upperNodeIdBound(); i < in + 1; i++)
-            graph.addNode();
+        numberOfNodes = std::max<count>(numberOfNodes, in + 1);
         return in;
     };
 
-    // This function modifies the graph on input.
-    auto handleEdge = [&](node source, node target) {
-        if (!graph.hasEdge(source, target)) {
-            graph.addEdge(source, target);
-        } else {
-            DEBUG("[" + std::to_string(source) + "->" + std::to_string(target)
-                  + "] Multiple edges detected");
-        }
-    };
+    std::vector<WeightedEdge> batch;
+    batch.reserve(std::min<count>(batchSize, defaultBatchSize));
 
     MemoryMappedFile mmfile(path);
     auto it = mmfile.cbegin();
@@ -59,7 +81,6 @@ Graph SNAPGraphReader::read(std::string_view path) {
         while (it != end && (*it == ' ' || *it == '\t'))
             ++it;
     };
-
     auto scanId = [&]() -> node {
         char *past;
         auto value = strtol(it, &past, 10);
@@ -73,9 +94,7 @@ Graph SNAPGraphReader::read(std::string_view path) {
     while (it != end) {
         if (it >= end)
             throw std::runtime_error("Unexpected end of file");
-
         skipWhitespace();
-
         if (it == end)
             throw std::runtime_error("Unexpected end of file");
 
@@ -91,15 +110,16 @@ Graph SNAPGraphReader::read(std::string_view path) {
                 throw std::runtime_error("Unexpected end of file");
             if (!(*it == ' ' || *it == '\t'))
                 throw std::runtime_error("Error in parsing file - pointer is whitespace");
-
             skipWhitespace();
-
             auto targetId = scanId();
             skipWhitespace();
-
-            handleEdge(mapNode(sourceId), mapNode(targetId));
+            const node source = mapNode(sourceId);
+            batch.emplace_back(source, mapNode(targetId), defaultEdgeWeight);
+            if (batch.size() >= batchSize) {
+                callback(batch);
+                batch.clear();
+            }
         }
-
         if (it == end)
             throw std::runtime_error("Unexpected end of file");
         if (!(*it == '\n' || *it == '\r'))
@@ -107,8 +127,10 @@ Graph SNAPGraphReader::read(std::string_view path) {
         ++it;
     }
 
-    graph.shrinkToFit();
-    return graph;
+    if (!batch.empty())
+        callback(batch);
+
+    return {numberOfNodes, false, directed, DISCARD_EDGES};
 }
 
 } // namespace NetworKit
@@ -0,0 +1,141 @@
+/*
+ * StreamingGraphReader.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <networkit/io/StreamingGraphReader.hpp>
+
+namespace NetworKit {
+
+Graph StreamingGraphReader::readStreaming(std::string_view path) {
+    // First pass: count the degrees. The number of nodes is only known at the end of the stream,
+    // so the arrays grow on demand. Self-loops are counted twice; this reserves one spare entry
+    // for undirected graphs.
+    std::vector<count> outDegree, inDegree;
+    const StreamProperties properties = forEdgeBatches(path, [&](EdgeBatch batch) {
+        for (const WeightedEdge &e : batch) {
+            const count required = std::max(e.u, e.v) + 1;
+            if (outDegree.size() < required) {
+                outDegree.resize(std::max(required, 2 * outDegree.size()), 0);
+                inDegree.resize(outDegree.size(), 0);
+            }
+            ++outDegree[e.u];
+            ++inDegree[e.v];
+        }
+    });
+
+    const count n = properties.numberOfNodes;
+    const bool directed = properties.directed;
+    outDegree.resize(n, 0);
+    inDegree.resize(n, 0);
+
+    Graph G(n, properties.weighted, directed);
+    G.parallelForNodes([&](node u) {
+        if (directed)
+            G.preallocateDirected(u, outDegree[u], inDegree[u]);
+        else
+            G.preallocateUndirected(u, outDegree[u] + inDegree[u]);
+    });
+    std::vector<count>().swap(outDegree);
+    std::vector<count>().swap(inDegree);
+
+    // Second pass: fill the adjacency arrays.
+    count numberOfEdges = 0;
+    count numberOfSelfLoops = 0;
+    forEdgeBatches(path, [&](EdgeBatch batch) {
+        for (const WeightedEdge &e : batch) {
+            if (e.u >= n || e.v >= n)
+                throw std::runtime_error("The file has changed between the two passes");
+            if (directed) {
+                G.addPartialOutEdge(unsafe, e.u, e.v, e.weight);
+                G.addPartialInEdge(unsafe, e.v, e.u, e.weight);
+            } else {
+                G.addPartialEdge(unsafe, e.u, e.v, e.weight);
+                if (e.u != e.v)
+                    G.addPartialEdge(unsafe, e.v, e.u, e.weight);
+            }
+            ++numberOfEdges;
+            numberOfSelfLoops += (e.u == e.v);
+        }
+    });
+    G.setEdgeCount(unsafe, numberOfEdges);
+    G.setNumberOfSelfLoops(unsafe, numberOfSelfLoops);
+
+    // All copies of a repeated edge get the weight read() would assign to the edge, then all but
+    // one copy are removed. Since the adjacency arrays are in file order, the copies of an edge
+    // appear in the same order in the arrays of both endpoints.
+    std::atomic<bool> hasMultiEdges{false};
+    const auto mergeWeights = [&](node u, bool inEdges) {
+        std::unordered_map<node, edgeweight> merged;
+        bool duplicates = false;
+        const auto collect = [&](node v, edgeweight w) {
+            const auto [it, inserted] = merged.try_emplace(v, w);
+            if (inserted)
+                return;
+            duplicates = true;
+            if (properties.multipleEdges == SUM_WEIGHTS_UP)
+                it->second += w;
+            else if (properties.multipleEdges == KEEP_MINIMUM_WEIGHT)
+                it->second = std::min(it->second, w);
+        };
+        if (inEdges)
+            G.forInNeighborsOf(u, collect);
+        else
+            G.forNeighborsOf(u, collect);
+
+        if (!duplicates)
+            return;
+        hasMultiEdges.store(true, std::memory_order_relaxed);
+        if (!G.isWeighted())
+            return;
+
+        index i = 0;
+        const auto assign = [&](node v) {
+            if (inEdges)
+                G.setWeightAtIthInNeighbor(unsafe, u, i++, merged[v]);
+            else
+                G.setWeightAtIthNeighbor(unsafe, u, i++, merged[v]);
+        };
+        if (inEdges)
+            G.forInNeighborsOf(u, assign);
+        else
+            G.forNeighborsOf(u, assign);
+    };
+
+    G.balancedParallelForNodes([&](node u) {
+        mergeWeights(u, false);
+        if (directed)
+            mergeWeights(u, true);
+    });
+
+    if (hasMultiEdges)
+        G.removeMultiEdges();
+    G.shrinkToFit();
+    return G;
+}
+
+CompressedGraph StreamingGraphReader::readCompressed(std::string_view path,
+                                                     count maxBufferedNeighbors) {
+    const auto edges = [&](const CompressedGraph::EdgeBatchHandler &handler) {
+        const StreamProperties properties = forEdgeBatches(path, handler);
+        CompressedGraph::StreamProperties result;
+        result.numberOfNodes = properties.numberOfNodes;
+        result.weighted = properties.weighted;
+        result.directed = properties.directed;
+        if (properties.multipleEdges == SUM_WEIGHTS_UP)
+            result.mergeWeights = [](edgeweight a, edgeweight b) { return a + b; };
+        else if (properties.multipleEdges == KEEP_MINIMUM_WEIGHT)
+            result.mergeWeights = [](edgeweight a, edgeweight b) { return std::min(a, b); };
+        return result;
+    };
+    return CompressedGraph(edges, maxBufferedNeighbors);
+}
+
+} /* namespace NetworKit */
@@ -7,19 +7,26 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
 #include <networkit/algebraic/CSRMatrix.hpp>
 #include <networkit/algebraic/MatrixTools.hpp>
 #include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/CompressedGraph.hpp>
 #include <networkit/io/BinaryEdgeListPartitionReader.hpp>
 #include <networkit/io/BinaryEdgeListPartitionWriter.hpp>
 #include <networkit/io/BinaryPartitionReader.hpp>
@@ -54,6 +61,7 @@
 #include <networkit/io/ThrillGraphBinaryWriter.hpp>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
 #include <networkit/community/ClusteringGenerator.hpp>
 #include <networkit/community/GraphClusteringTools.hpp>
 #include <networkit/community/Modularity.hpp>
@@ -249,6 +257,44 @@ TEST_F(IOGTest, testMETISGraphReaderWithTinyGraphs) {
     }
 }
 
+TEST_F(IOGTest, testMETISGraphReaderLargeFile) {
+    // The file is large enough to be split into several chunks which are parsed in parallel.
+    Aux::Random::setSeed(42, false);
+    Graph G(ErdosRenyiGenerator(5000, 0.005).generate(), true, false);
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, static_cast<edgeweight>(u + v + 1)); });
+    G.addEdge(3, 3, 2.0);
+
+    const std::string path = "output/large.graph";
+    {
+        std::ofstream file(path);
+        file << "% comment\n" << G.numberOfNodes() << " " << G.numberOfEdges() << " 1\n";
+        G.forNodes([&](node u) {
+            if (u % 100 == 0)
+                file << "% comment between adjacency lines\n";
+            // isolated nodes are written as empty lines
+            G.forNeighborsOf(u, [&](node v, edgeweight w) { file << v + 1 << " " << w << " "; });
+            file << "\n";
+        });
+    }
+
+    const Graph G2 = METISGraphReader{}.read(path);
+    EXPECT_TRUE(G2.isWeighted());
+    ASSERT_EQ(G2.numberOfNodes(), G.numberOfNodes());
+    ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(G2.numberOfSelfLoops(), 1);
+    G.forNodes([&](node u) {
+        ASSERT_EQ(G2.degree(u), G.degree(u));
+        G.forNeighborsOf(u, [&](node v, edgeweight w) { ASSERT_EQ(G2.weight(u, v), w); });
+    });
+
+    {
+        // node ids must not exceed the number of nodes
+        std::ofstream file(path);
+        file << "2 1\n2\n3\n";
+    }
+    EXPECT_THROW(METISGraphReader{}.read(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testMETISGraphWriter) {
     std::string path = "output/jazz1.graph";
     Graph G = Graph(3);
@@ -418,6 +464,91 @@ TEST_F(IOGTest, testEdgeListReader) {
     EXPECT_EQ(1, G5.weight(2, 3));
 }
 
+TEST_F(IOGTest, testEdgeListReaderLargeFile) {
+    // The file is large enough to be split into several chunks which are parsed in parallel.
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(2000, 0.02).generate();
+    std::vector<std::pair<node, node>> edges;
+    G.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+    std::shuffle(edges.begin(), edges.end(), Aux::Random::getURNG());
+
+    const std::string path = "output/large.edgelist";
+    {
+        std::ofstream file(path);
+        file << "# comment\n";
+        for (const auto &[u, v] : edges) {
+            file << u + 1 << "\t" << v + 1 << "\t" << u + v << "\r\n";
+            // Repetitions of an edge are ignored, the first occurrence determines the weight.
+            if (u % 10 == 0)
+                file << v + 1 << " \t" << u + 1 << "\t7\n";
+        }
+    }
+
+    EdgeListReader reader('\t', 1);
+    const Graph G2 = reader.read(path);
+    EXPECT_TRUE(G2.isWeighted());
+    ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+    G.forEdges([&](node u, node v) {
+        ASSERT_TRUE(G2.hasEdge(u, v));
+        ASSERT_EQ(G2.weight(u, v), u + v);
+    });
+
+    // The neighbors are in file order, as if the edges were added one by one.
+    Graph sequential(G.upperNodeIdBound(), true);
+    for (const auto &[u, v] : edges)
+        sequential.addEdge(u, v, static_cast<edgeweight>(u + v));
+    G.forNodes([&](node u) {
+        std::vector<node> expected, actual;
+        sequential.forNeighborsOf(u, [&](node v) { expected.push_back(v); });
+        G2.forNeighborsOf(u, [&](node v) { actual.push_back(v); });
+        ASSERT_EQ(actual, expected);
+    });
+
+    EdgeListReader mappingReader('\t', 0, "#", false, true);
+    const Graph G3 = mappingReader.read(path);
+    EXPECT_TRUE(G3.isDirected());
+    const auto &nodeMap = mappingReader.getNodeMap();
+    ASSERT_EQ(nodeMap.size(), G3.numberOfNodes());
+    EXPECT_EQ(nodeMap.at(std::to_string(edges[0].first + 1)), 0);
+    EXPECT_EQ(nodeMap.at(std::to_string(edges[0].second + 1)), 1);
+    count expectedEdges = 0;
+    for (const auto &[u, v] : edges) {
+        const node mappedU = nodeMap.at(std::to_string(u + 1));
+        const node mappedV = nodeMap.at(std::to_string(v + 1));
+        ASSERT_TRUE(G3.hasEdge(mappedU, mappedV));
+        ASSERT_EQ(G3.weight(mappedU, mappedV), u + v);
+        expectedEdges += (u % 10 == 0) ? 2 : 1;
+    }
+    EXPECT_EQ(G3.numberOfEdges(), expectedEdges);
+
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "1\tx\t1\n";
+    }
+    EXPECT_THROW(reader.read(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST_F(IOGTest, testEdgeListReaderInvalidLines) {
+    // Garbage and node ids that do not fit into a node are reported with their line.
+    const std::string path = "output/invalid.edgelist";
+    for (const char *line : {"3\tx\t1", "3\t99999999999999999999999\t1", "3\t1\t1x", "3\t-1\t1",
+                             "3\t1\t1e999"}) {
+        {
+            std::ofstream file(path);
+            file << "# comment\n1\t2\t0.5\n2\t3\t+2\n" << line << "\n4\t1\t1\n";
+        }
+        std::string message;
+        try {
+            EdgeListReader('\t', 1).read(path);
+        } catch (const std::runtime_error &e) {
+            message = e.what();
+        }
+        EXPECT_NE(message.find("(line 4)"), std::string::npos) << line << ": " << message;
+    }
+    std::remove(path.c_str());
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
     EdgeListPartitionReader reader(1);
 
@@ -826,6 +957,104 @@ TEST_F(IOGTest, testKONECTGraphReader) {
     ASSERT_EQ(G.weight(0, 1), 1.261404);
     ASSERT_EQ(G.weight(127, 48), 0.03050447);
 }
+TEST_F(IOGTest, testStreamingGraphReaders) {
+    const auto expectEqual = [](const Graph &G, const Graph &G2) {
+        EXPECT_EQ(G2.isDirected(), G.isDirected());
+        EXPECT_EQ(G2.isWeighted(), G.isWeighted());
+        ASSERT_EQ(G2.numberOfNodes(), G.numberOfNodes());
+        ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+        EXPECT_EQ(G2.numberOfSelfLoops(), G.numberOfSelfLoops());
+        G.forNodes([&](node u) {
+            ASSERT_EQ(G2.degreeOut(u), G.degreeOut(u));
+            ASSERT_EQ(G2.degreeIn(u), G.degreeIn(u));
+            G.forNeighborsOf(u, [&](node v, edgeweight w) { ASSERT_EQ(G2.weight(u, v), w); });
+        });
+    };
+
+    KONECTGraphReader konectReader;
+    const Graph konect = konectReader.read("input/foodweb-baydry.konect");
+    expectEqual(konect, konectReader.readStreaming("input/foodweb-baydry.konect"));
+    expectEqual(konect, konectReader.readCompressed("input/foodweb-baydry.konect").toGraph());
+
+    SNAPGraphReader snapReader(true);
+    const Graph snap = snapReader.read("input/wiki-Vote.txt");
+    expectEqual(snap, snapReader.readStreaming("input/wiki-Vote.txt"));
+    expectEqual(snap, snapReader.readCompressed("input/wiki-Vote.txt", 1000).toGraph());
+
+    // Repeated edges, self-loops and isolated nodes
+    const std::string path = "output/streaming.edgelist";
+    {
+        std::ofstream file(path);
+        file << "# comment\n";
+        for (node u = 0; u < 300; ++u) {
+            file << u << "\t" << (7 * u) % 300 << "\t" << u << "\n";
+            if (u % 3 == 0)
+                file << (7 * u) % 300 << "\t" << u << "\t" << 2 * u << "\n";
+        }
+        file << "310\t310\t1\n";
+    }
+
+    for (const bool directed : {false, true}) {
+        EdgeListReader reader('\t', 0, "#", true, directed);
+        const Graph G = reader.read(path);
+        expectEqual(G, reader.readStreaming(path));
+        expectEqual(G, reader.readCompressed(path, 50).toGraph());
+        EXPECT_EQ(G.numberOfNodes(), 311);
+
+        count numberOfEdges = 0;
+        const auto properties = reader.forEdgeBatches(
+            path,
+            [&](StreamingGraphReader::EdgeBatch batch) {
+                EXPECT_LE(batch.size(), 64);
+                numberOfEdges += batch.size();
+            },
+            64);
+        EXPECT_EQ(numberOfEdges, 401);
+        EXPECT_EQ(properties.numberOfNodes, 311);
+        EXPECT_TRUE(properties.weighted);
+        EXPECT_EQ(properties.directed, directed);
+
+        EdgeListReader mappingReader('\t', 0, "#", false, directed);
+        const Graph G2 = mappingReader.read(path);
+        const auto nodeMap = mappingReader.getNodeMap();
+        expectEqual(G2, mappingReader.readStreaming(path));
+        EXPECT_EQ(mappingReader.getNodeMap(), nodeMap);
+        expectEqual(G2, mappingReader.readCompressed(path).toGraph());
+    }
+    std::remove(path.c_str());
+}
+
+TEST_F(IOGTest, testKONECTGraphReaderStreamingMultipleEdges) {
+    const std::string path = "output/multiple.konect";
+    {
+        std::ofstream file(path);
+        file << "% sym multiweighted\n% 6 4\n";
+        file << "1 2 3.5\n2 1 1.5\n1 3 2\n3 3 4\n3 3 -1\n1 2 0.5\n";
+    }
+
+    for (const auto handling : {GraphReader::DISCARD_EDGES, GraphReader::SUM_WEIGHTS_UP,
+                                GraphReader::KEEP_MINIMUM_WEIGHT}) {
+        KONECTGraphReader reader(false, handling);
+        const Graph G = reader.read(path);
+        const Graph G2 = reader.readStreaming(path);
+        ASSERT_EQ(G2.numberOfNodes(), 4);
+        ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+        EXPECT_EQ(G2.numberOfSelfLoops(), 1);
+        G.forEdges([&](node u, node v, edgeweight w) { EXPECT_EQ(G2.weight(u, v), w); });
+
+        const CompressedGraph C = reader.readCompressed(path);
+        ASSERT_EQ(C.numberOfNodes(), 4);
+        ASSERT_EQ(C.numberOfEdges(), G.numberOfEdges());
+        EXPECT_EQ(C.numberOfSelfLoops(), 1);
+        G.forEdges([&](node u, node v, edgeweight w) { EXPECT_EQ(C.weight(u, v), w); });
+    }
+
+    KONECTGraphReader reader(false, GraphReader::SUM_WEIGHTS_UP);
+    EXPECT_EQ(reader.readStreaming(path).weight(0, 1), 5.5);
+    EXPECT_EQ(reader.readCompressed(path).weight(0, 1), 5.5);
+    std::remove(path.c_str());
+}
+
 TEST_F(IOGTest, testNetworkitBinaryTiny01) {
     METISGraphReader reader2;
     Graph G = reader2.read("input/tiny_01.graph");
@@ -1247,6 +1476,122 @@ TEST_F(IOGTest, testNetworkitWriterNonContinuousNodesIds) {
     });
 }
 
+TEST_F(IOGTest, testNetworkitBinaryCSRKonect) {
+    KONECTGraphReader reader2;
+    Graph G = reader2.read("input/foodweb-baydry.konect");
+    G.indexEdges();
+    NetworkitBinaryWriter writer;
+    writer.writeCSR(G, "output/binary_konect_csr");
+
+    NetworkitBinaryReader reader;
+    const CSRGraph C = reader.readCSR("output/binary_konect_csr");
+    EXPECT_EQ(C.isDirected(), true);
+    EXPECT_EQ(C.isWeighted(), true);
+    EXPECT_EQ(C.hasEdgeIds(), true);
+    ASSERT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    ASSERT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    ASSERT_EQ(C.upperEdgeIdBound(), G.upperEdgeIdBound());
+    G.forNodes([&](node u) {
+        ASSERT_EQ(C.degreeOut(u), G.degreeOut(u));
+        ASSERT_EQ(C.degreeIn(u), G.degreeIn(u));
+    });
+    std::vector<std::tuple<node, node, edgeweight, edgeid>> expected, actual;
+    G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+        expected.emplace_back(u, v, ew, eid);
+    });
+    C.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+        actual.emplace_back(u, v, ew, eid);
+    });
+    ASSERT_EQ(actual, expected);
+
+    Graph G2 = reader.read("output/binary_konect_csr");
+    EXPECT_EQ(G2.isDirected(), true);
+    EXPECT_EQ(G2.isWeighted(), true);
+    ASSERT_EQ(G2.numberOfNodes(), G.numberOfNodes());
+    ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+    G.forNodes([&](node u) {
+        G.forEdgesOf(u, [&](node v) {
+            ASSERT_TRUE(G2.hasEdge(u, v));
+            ASSERT_EQ(G.weight(u, v), G2.weight(u, v));
+            ASSERT_EQ(G.edgeId(u, v), G2.edgeId(u, v));
+        });
+    });
+    std::remove("output/binary_konect_csr");
+}
+
+TEST_F(IOGTest, testNetworkitBinaryCSRDeletedNodes) {
+    METISGraphReader reader2;
+    Graph G = reader2.read("input/jazz.graph");
+    G.removeNode(0);
+    G.removeNode(42);
+    G.addEdge(3, 3);
+    NetworkitBinaryWriter writer;
+    writer.writeCSR(G, "output/binary_jazz_csr");
+
+    NetworkitBinaryReader reader;
+    const CSRGraph C = reader.readCSR("output/binary_jazz_csr");
+    EXPECT_EQ(C.isDirected(), false);
+    EXPECT_EQ(C.isWeighted(), false);
+    EXPECT_FALSE(C.hasNode(0));
+    EXPECT_FALSE(C.hasNode(42));
+    ASSERT_EQ(C.upperNodeIdBound(), G.upperNodeIdBound());
+    ASSERT_EQ(C.numberOfNodes(), G.numberOfNodes());
+    ASSERT_EQ(C.numberOfEdges(), G.numberOfEdges());
+    ASSERT_EQ(C.numberOfSelfLoops(), G.numberOfSelfLoops());
+    G.forNodes([&](node u) {
+        ASSERT_EQ(C.degree(u), G.degree(u));
+        G.forEdgesOf(u, [&](node v) { ASSERT_TRUE(C.hasEdge(u, v)); });
+    });
+
+    Graph G2 = reader.read("output/binary_jazz_csr");
+    ASSERT_EQ(G2.numberOfNodes(), G.numberOfNodes());
+    ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+    ASSERT_EQ(G2.numberOfSelfLoops(), G.numberOfSelfLoops());
+    G.forNodes([&](node u) { G.forEdgesOf(u, [&](node v) { ASSERT_TRUE(G2.hasEdge(u, v)); }); });
+    std::remove("output/binary_jazz_csr");
+}
+
+TEST_F(IOGTest, testNetworkitBinaryCSRRejectsCorruptFile) {
+    Graph G = METISGraphReader{}.read("input/jazz.graph");
+    G.indexEdges();
+    const std::string path = "output/binary_jazz_csr_corrupt";
+    NetworkitBinaryWriter{}.writeCSR(G, path);
+    std::vector<uint8_t> data;
+    {
+        std::ifstream file(path, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    std::remove(path.c_str());
+
+    nkbg::CSRHeader header;
+    memcpy(&header, data.data(), sizeof(nkbg::CSRHeader));
+    EXPECT_EQ(NetworkitBinaryReader{}.readFromBuffer(data).numberOfEdges(), G.numberOfEdges());
+
+    // Writes the value at the byte offset into a copy of the file and expects the reader to fail.
+    auto expectRejected = [&](uint64_t offset, auto value) {
+        std::vector<uint8_t> corrupt = data;
+        memcpy(corrupt.data() + offset, &value, sizeof(value));
+        EXPECT_THROW(NetworkitBinaryReader{}.readFromBuffer(corrupt), std::runtime_error);
+    };
+    expectRejected(header.offsetOutTargets, static_cast<node>(header.nodes));
+    expectRejected(header.offsetOutIds, static_cast<edgeid>(header.upperEdgeIdBound));
+    expectRejected(header.offsetOutOffsets + sizeof(index), static_cast<index>(data.size()));
+    expectRejected(header.offsetOutOffsets + header.nodes * sizeof(index), index{0});
+
+    std::vector<uint8_t> truncated(data.begin(), data.begin() + header.offsetOutTargets);
+    EXPECT_THROW(NetworkitBinaryReader{}.readFromBuffer(truncated), std::runtime_error);
+}
+
+TEST_F(IOGTest, testNetworkitBinaryCSRRejectsCompressedFormat) {
+    METISGraphReader reader2;
+    Graph G = reader2.read("input/tiny_01.graph");
+    NetworkitBinaryWriter writer;
+    writer.write(G, "output/binary_tiny01");
+
+    NetworkitBinaryReader reader;
+    EXPECT_THROW(reader.readCSR("output/binary_tiny01"), std::runtime_error);
+}
+
 TEST_F(IOGTest, testMatrixMarketReaderUnweightedUndirected) {
     CSRMatrix csr = MatrixMarketReader{}.read("input/chesapeake.mtx");
     EXPECT_EQ(csr.numberOfRows(), 39);
@@ -1340,6 +1685,58 @@ TEST_F(IOGTest, testMatrixMarketReaderWeightedDirected) {
     });
 }
 
+TEST_F(IOGTest, testMTXGraphReaderLargeFile) {
+    // The file is large enough to be split into several chunks which are parsed in parallel.
+    Aux::Random::setSeed(42, false);
+    Graph G(ErdosRenyiGenerator(3000, 0.01, true).generate(), true, true);
+    G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real(-1.0, 1.0)); });
+
+    const std::string path = "output/large.mtx";
+    {
+        std::ofstream file(path);
+        file << std::setprecision(17);
+        file << "%%MatrixMarket matrix coordinate real general\n% comment\n";
+        file << G.numberOfNodes() << " " << G.numberOfNodes() << " " << G.numberOfEdges() << "\n";
+        G.forEdges([&](node u, node v, edgeweight w) {
+            file << u + 1 << " " << v + 1 << " " << w << "\n";
+        });
+    }
+
+    const Graph G2 = MTXGraphReader{}.read(path);
+    EXPECT_TRUE(G2.isWeighted());
+    EXPECT_TRUE(G2.isDirected());
+    ASSERT_EQ(G2.numberOfNodes(), G.numberOfNodes());
+    ASSERT_EQ(G2.numberOfEdges(), G.numberOfEdges());
+    G.forNodes([&](node u) {
+        ASSERT_EQ(G2.degreeIn(u), G.degreeIn(u));
+        ASSERT_NEAR(G2.weightedDegreeIn(u), G.weightedDegreeIn(u), 1e-9);
+    });
+    G.forEdges([&](node u, node v, edgeweight w) { ASSERT_EQ(G2.weight(u, v), w); });
+
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "% no comments after the size line\n";
+    }
+    EXPECT_THROW(MTXGraphReader{}.read(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST_F(IOGTest, testMTXGraphReaderInvalidNodeIndex) {
+    const std::string path = "output/invalid.mtx";
+    {
+        std::ofstream file(path);
+        file << "%%MatrixMarket matrix coordinate pattern general\n3 3 2\n1 2\nx 3\n";
+    }
+    std::string message;
+    try {
+        MTXGraphReader{}.read(path);
+    } catch (const std::runtime_error &e) {
+        message = e.what();
+    }
+    std::remove(path.c_str());
+    EXPECT_NE(message.find("(line 4)"), std::string::npos) << message;
+}
+
 TEST_F(IOGTest, testMatrixMarketReaderIntegerWeights) {
     CSRMatrix csr = MatrixMarketReader{}.read("input/Ragusa16.mtx");
     EXPECT_EQ(csr.numberOfRows(), 24);
@@ -0,0 +1,94 @@
+/*
+ * LanczosEigensolverGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <cmath>
+#include <numbers>
+
+#include <gtest/gtest.h>
+
+#include <networkit/algebraic/CSRMatrix.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/numerics/LanczosEigensolver.hpp>
+
+namespace NetworKit {
+
+class LanczosEigensolverGTest : public testing::Test {};
+
+TEST_F(LanczosEigensolverGTest, testPathGraph) {
+    // The eigenvalues of the path with n nodes are 2 cos(pi j / (n + 1)), j = 1, ..., n.
+    const count n = 200;
+    Graph G(n);
+    for (node u = 0; u + 1 < n; ++u)
+        G.addEdge(u, u + 1);
+    const CSRMatrix A = CSRMatrix::adjacencyMatrix(G);
+
+    Aux::Random::setSeed(42, false);
+    LanczosEigensolver<CSRMatrix> solver(A, 4, 1e-10);
+    solver.run();
+    EXPECT_TRUE(solver.hasConverged());
+
+    const auto &values = solver.eigenvalues();
+    ASSERT_EQ(values.size(), 4);
+    for (index j = 0; j < 4; ++j)
+        EXPECT_NEAR(values[j], 2.0 * std::cos(std::numbers::pi * (j + 1) / (n + 1)), 1e-8);
+
+    // The path is bipartite; the eigenvectors alternate in sign for the smallest eigenvalues,
+    // but the Perron vector is positive.
+    const Vector &perron = solver.eigenvectors()[0];
+    const double sign = perron[0] > 0 ? 1.0 : -1.0;
+    for (index i = 0; i < n; ++i)
+        EXPECT_GT(sign * perron[i], 0.0);
+}
+
+TEST_F(LanczosEigensolverGTest, testResiduals) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(1000, 0.01).generate();
+    const CSRMatrix A = CSRMatrix::laplacianMatrix(G);
+
+    LanczosEigensolver<CSRMatrix> solver(A, 5, 1e-10);
+    solver.run();
+    EXPECT_TRUE(solver.hasConverged());
+
+    const auto &values = solver.eigenvalues();
+    const auto &vectors = solver.eigenvectors();
+    for (index j = 0; j < 5; ++j) {
+        if (j > 0)
+            EXPECT_GE(values[j - 1], values[j]);
+        EXPECT_NEAR(vectors[j].length(), 1.0, 1e-12);
+        const Vector residual = A * vectors[j] - vectors[j] * values[j];
+        EXPECT_LE(residual.length(), 1e-8 * values[0]);
+        for (index i = 0; i < j; ++i)
+            EXPECT_NEAR(Vector::innerProduct(vectors[i], vectors[j]), 0.0, 1e-8);
+    }
+}
+
+TEST_F(LanczosEigensolverGTest, testSmallKrylovDimension) {
+    // The complete graph has the eigenvalue n - 1 once and -1 with multiplicity n - 1.
+    const count n = 50;
+    Graph G(n);
+    G.forNodePairs([&](node u, node v) { G.addEdge(u, v); });
+    const CSRMatrix A = CSRMatrix::adjacencyMatrix(G);
+
+    LanczosEigensolver<CSRMatrix> solver(A, 3);
+    solver.krylovDimension = 8;
+    solver.run();
+    EXPECT_TRUE(solver.hasConverged());
+
+    const auto &values = solver.eigenvalues();
+    EXPECT_NEAR(values[0], n - 1.0, 1e-8);
+    EXPECT_NEAR(values[1], -1.0, 1e-8);
+    EXPECT_NEAR(values[2], -1.0, 1e-8);
+}
+
+TEST_F(LanczosEigensolverGTest, testInvalidArguments) {
+    const CSRMatrix A = CSRMatrix::adjacencyMatrix(Graph(3));
+    EXPECT_THROW(LanczosEigensolver<CSRMatrix>(A, 0), std::runtime_error);
+    EXPECT_THROW(LanczosEigensolver<CSRMatrix>(A, 4), std::runtime_error);
+}
+
+} /* namespace NetworKit */
@@ -133,7 +133,7 @@ void ReachableNodes::runDirected() {
                     reachUWithoutLargestSCC[curCmp] += reachUWithoutLargestSCC[neighCmp];
 
                 reachUSCC[curCmp] += reachUSCC[neighCmp];
-                reachUSCC[curCmp] = std::min(reachUSCC[curCmp], G->upperNodeIdBound());
+                reachUSCC[curCmp] = std::min<count>(reachUSCC[curCmp], G->upperNodeIdBound());
                 reachesLargestSCC[curCmp] =
                     reachesLargestSCC[curCmp] || reachesLargestSCC[neighCmp];
             });
@@ -143,7 +143,7 @@ void ReachableNodes::runDirected() {
 
             reachLSCC[curCmp] += sccVec[curCmp].size();
             reachUSCC[curCmp] += sccVec[curCmp].size();
-            reachUSCC[curCmp] = std::min(reachUSCC[curCmp], G->upperNodeIdBound());
+            reachUSCC[curCmp] = std::min<count>(reachUSCC[curCmp], G->upperNodeIdBound());
         });
 
         G->parallelForNodes([&](node u) {
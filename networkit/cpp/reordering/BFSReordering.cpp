@@ -0,0 +1,60 @@
+/*
+ * BFSReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <stdexcept>
+
+#include <networkit/reordering/BFSReordering.hpp>
+
+namespace NetworKit {
+
+BFSReordering::BFSReordering(const Graph &G, node source) : NodeReordering(G), source(source) {
+    if (source != none && !G.hasNode(source))
+        throw std::runtime_error("The source is not a node of the graph");
+}
+
+void BFSReordering::run() {
+    node first = source;
+    if (first == none) {
+        count maxDegree = 0;
+        G->forNodes([&](node u) {
+            if (first == none || undirectedDegree(u) > maxDegree) {
+                first = u;
+                maxDegree = undirectedDegree(u);
+            }
+        });
+    }
+
+    std::vector<bool> visited(G->upperNodeIdBound(), false);
+    std::vector<node> order;
+    order.reserve(G->numberOfNodes());
+
+    // The order itself serves as BFS queue.
+    auto bfsFrom = [&](node s) {
+        index head = order.size();
+        visited[s] = true;
+        order.push_back(s);
+        while (head < order.size()) {
+            forUndirectedNeighborsOf(order[head++], [&](node v) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    order.push_back(v);
+                }
+            });
+        }
+    };
+
+    if (first != none)
+        bfsFrom(first);
+    G->forNodes([&](node u) {
+        if (!visited[u])
+            bfsFrom(u);
+    });
+
+    setOrder(std::move(order));
+    hasRun = true;
+}
+
+} // namespace NetworKit
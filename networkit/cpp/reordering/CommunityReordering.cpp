@@ -0,0 +1,63 @@
+/*
+ * CommunityReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <stdexcept>
+
+#include <networkit/community/PLM.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/reordering/CommunityReordering.hpp>
+
+namespace NetworKit {
+
+CommunityReordering::CommunityReordering(const Graph &G)
+    : NodeReordering(G), detectCommunities(true) {}
+
+CommunityReordering::CommunityReordering(const Graph &G, const Partition &communities)
+    : NodeReordering(G), communities(communities), detectCommunities(false) {
+    if (communities.numberOfElements() < G.upperNodeIdBound())
+        throw std::runtime_error("The partition does not contain every node of the graph");
+}
+
+void CommunityReordering::run() {
+    if (detectCommunities) {
+        // PLM is only defined on undirected graphs; edge directions do not matter for locality.
+        if (G->isDirected()) {
+            const Graph undirected = GraphTools::toUndirected(*G);
+            PLM plm(undirected);
+            plm.run();
+            communities = plm.getPartition();
+        } else {
+            PLM plm(*G);
+            plm.run();
+            communities = plm.getPartition();
+        }
+    }
+
+    // Rank the communities by their node with the smallest id, unassigned nodes come last.
+    std::vector<index> rank(communities.upperBound() + 1, none);
+    count numberOfCommunities = 0;
+    G->forNodes([&](node u) {
+        const index c = communities[u];
+        if (c != none && rank[c] == none)
+            rank[c] = numberOfCommunities++;
+    });
+    const index unassigned = numberOfCommunities;
+    auto rankOf = [&](node u) { return communities[u] == none ? unassigned : rank[communities[u]]; };
+
+    // Counting sort of the nodes by the rank of their community
+    std::vector<index> offsets(numberOfCommunities + 2, 0);
+    G->forNodes([&](node u) { ++offsets[rankOf(u) + 1]; });
+    for (index i = 1; i < offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+
+    std::vector<node> order(G->numberOfNodes());
+    G->forNodes([&](node u) { order[offsets[rankOf(u)]++] = u; });
+
+    setOrder(std::move(order));
+    hasRun = true;
+}
+
+} // namespace NetworKit
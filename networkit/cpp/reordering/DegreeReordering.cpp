@@ -0,0 +1,34 @@
+/*
+ * DegreeReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/reordering/DegreeReordering.hpp>
+
+namespace NetworKit {
+
+DegreeReordering::DegreeReordering(const Graph &G, bool decreasing)
+    : NodeReordering(G), decreasing(decreasing) {}
+
+void DegreeReordering::run() {
+    std::vector<count> degrees(G->upperNodeIdBound());
+    G->parallelForNodes([&](node u) { degrees[u] = G->degreeIn(u); });
+
+    std::vector<node> order;
+    order.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) { order.push_back(u); });
+
+    if (decreasing)
+        Aux::Parallel::stable_sort(order.begin(), order.end(),
+                                   [&](node u, node v) { return degrees[u] > degrees[v]; });
+    else
+        Aux::Parallel::stable_sort(order.begin(), order.end(),
+                                   [&](node u, node v) { return degrees[u] < degrees[v]; });
+
+    setOrder(std::move(order));
+    hasRun = true;
+}
+
+} // namespace NetworKit
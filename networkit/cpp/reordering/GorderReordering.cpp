@@ -0,0 +1,94 @@
+/*
+ * GorderReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include <tlx/container/d_ary_addressable_int_heap.hpp>
+
+#include <networkit/auxiliary/VectorComparator.hpp>
+#include <networkit/reordering/GorderReordering.hpp>
+
+namespace NetworKit {
+
+GorderReordering::GorderReordering(const Graph &G, count windowSize)
+    : NodeReordering(G), windowSize(windowSize) {
+    if (!windowSize)
+        throw std::runtime_error("The window size must be positive");
+}
+
+void GorderReordering::run() {
+    const count z = G->upperNodeIdBound();
+    const count n = G->numberOfNodes();
+    const auto hubThreshold = static_cast<count>(std::sqrt(static_cast<double>(n)));
+
+    // score[v] is the number of edges and shared in-neighbors between v and the window.
+    std::vector<count> score(z, 0);
+    std::vector<bool> placed(z, false);
+    tlx::d_ary_addressable_int_heap<node, 2, Aux::GreaterInVector<count>> heap{score};
+
+    std::vector<node> order;
+    order.reserve(n);
+    if (!n) {
+        setOrder(std::move(order));
+        hasRun = true;
+        return;
+    }
+
+    node first = none;
+    G->forNodes([&](node u) {
+        heap.push(u);
+        if (first == none || G->degreeIn(u) > G->degreeIn(first))
+            first = u;
+    });
+
+    auto place = [&](node u) {
+        heap.remove(u);
+        placed[u] = true;
+        order.push_back(u);
+    };
+
+    // Adds (increase = true) or removes u from the window.
+    auto updateWindow = [&](node u, bool increase) {
+        auto change = [&](node v) {
+            if (placed[v])
+                return;
+            if (increase)
+                ++score[v];
+            else
+                --score[v];
+            heap.update(v);
+        };
+
+        // Direct neighbors of u
+        G->forNeighborsOf(u, change);
+        if (G->isDirected())
+            G->forInNeighborsOf(u, change);
+
+        // Siblings of u, i.e., out-neighbors of the in-neighbors of u
+        G->forInNeighborsOf(u, [&](node w) {
+            if (G->degreeOut(w) > hubThreshold)
+                return;
+            G->forNeighborsOf(w, [&](node v) {
+                if (v != u)
+                    change(v);
+            });
+        });
+    };
+
+    place(first);
+    while (order.size() < n) {
+        updateWindow(order.back(), true);
+        if (order.size() > windowSize)
+            updateWindow(order[order.size() - windowSize - 1], false);
+        place(heap.top());
+    }
+
+    setOrder(std::move(order));
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,78 @@
+/*
+ * NodeReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include <networkit/reordering/NodeReordering.hpp>
+
+namespace NetworKit {
+
+NodeReordering::NodeReordering(const Graph &G) : G(&G) {}
+
+void NodeReordering::setOrder(std::vector<node> order) {
+    if (order.size() != G->numberOfNodes())
+        throw std::runtime_error("The order does not contain every node exactly once");
+
+    permutation.assign(G->upperNodeIdBound(), none);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(order.size()); ++i) {
+        assert(G->hasNode(order[i]));
+        permutation[order[i]] = static_cast<node>(i);
+    }
+    inversePermutation = std::move(order);
+}
+
+Graph NodeReordering::getReorderedGraph() const {
+    assureFinished();
+
+    const count n = inversePermutation.size();
+    const bool directed = G->isDirected();
+    Graph R(n, G->isWeighted(), directed);
+    if (G->hasEdgeIds())
+        R.indexEdges();
+
+    R.balancedParallelForNodes([&](node newU) {
+        const node u = inversePermutation[newU];
+        if (directed) {
+            R.preallocateDirected(newU, G->degreeOut(u), G->degreeIn(u));
+            G->forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                R.addPartialOutEdge(unsafe, newU, permutation[v], ew, eid);
+            });
+            G->forInEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                R.addPartialInEdge(unsafe, newU, permutation[v], ew, eid);
+            });
+        } else {
+            R.preallocateUndirected(newU, G->degree(u));
+            G->forEdgesOf(u, [&](node, node v, edgeweight ew, edgeid eid) {
+                R.addPartialEdge(unsafe, newU, permutation[v], ew, eid);
+            });
+        }
+    });
+
+    R.setEdgeCount(unsafe, G->numberOfEdges());
+    R.setNumberOfSelfLoops(unsafe, G->numberOfSelfLoops());
+    if (G->hasEdgeIds())
+        R.setUpperEdgeIdBound(unsafe, G->upperEdgeIdBound());
+
+    // Visiting the neighbors in the order of their ids is the access pattern the reordering
+    // optimizes for.
+    R.sortEdges();
+    return R;
+}
+
+Partition NodeReordering::mapToOriginal(const Partition &zeta) const {
+    assureFinished();
+    if (zeta.numberOfElements() != inversePermutation.size())
+        throw std::runtime_error("Expected a partition of the reordered graph");
+    Partition result(G->upperNodeIdBound());
+    G->parallelForNodes([&](node u) { result[u] = zeta[permutation[u]]; });
+    result.setUpperBound(zeta.upperBound());
+    return result;
+}
+
+} // namespace NetworKit
@@ -0,0 +1,107 @@
+/*
+ * RCMReordering.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/reordering/RCMReordering.hpp>
+
+namespace NetworKit {
+
+RCMReordering::RCMReordering(const Graph &G) : NodeReordering(G) {}
+
+void RCMReordering::run() {
+    const count z = G->upperNodeIdBound();
+    degrees.assign(z, 0);
+    G->parallelForNodes([&](node u) { degrees[u] = undirectedDegree(u); });
+    level.assign(z, none);
+
+    auto byDegree = [&](node u, node v) {
+        return degrees[u] < degrees[v] || (degrees[u] == degrees[v] && u < v);
+    };
+
+    // Every component is started from a pseudo-peripheral node, which is searched from the
+    // component's node of minimum degree.
+    std::vector<node> candidates;
+    candidates.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) { candidates.push_back(u); });
+    Aux::Parallel::sort(candidates.begin(), candidates.end(), byDegree);
+
+    std::vector<bool> visited(z, false);
+    std::vector<node> order;
+    order.reserve(G->numberOfNodes());
+
+    for (node candidate : candidates) {
+        if (visited[candidate])
+            continue;
+
+        const node start = pseudoPeripheralNode(candidate);
+        index head = order.size();
+        visited[start] = true;
+        order.push_back(start);
+
+        while (head < order.size()) {
+            const index firstNeighbor = order.size();
+            forUndirectedNeighborsOf(order[head++], [&](node v) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    order.push_back(v);
+                }
+            });
+            std::sort(order.begin() + firstNeighbor, order.end(), byDegree);
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+    setOrder(std::move(order));
+
+    degrees = {};
+    level = {};
+    hasRun = true;
+}
+
+node RCMReordering::pseudoPeripheralNode(node start) {
+    std::vector<node> queue;
+    count eccentricity = 0;
+    node current = start;
+
+    while (true) {
+        // Breadth-first search from current to compute its eccentricity.
+        queue.clear();
+        queue.push_back(current);
+        level[current] = 0;
+        for (index head = 0; head < queue.size(); ++head) {
+            const node u = queue[head];
+            forUndirectedNeighborsOf(u, [&](node v) {
+                if (level[v] == none) {
+                    level[v] = level[u] + 1;
+                    queue.push_back(v);
+                }
+            });
+        }
+
+        const count currentEccentricity = level[queue.back()];
+        node next = queue.back();
+        for (auto it = queue.rbegin(); it != queue.rend() && level[*it] == currentEccentricity;
+             ++it) {
+            if (degrees[*it] < degrees[next])
+                next = *it;
+        }
+
+        for (node u : queue)
+            level[u] = none;
+
+        // Stop as soon as the eccentricity does not increase anymore.
+        if (current != start && currentEccentricity <= eccentricity)
+            return current;
+        if (next == current)
+            return current;
+        eccentricity = currentEccentricity;
+        current = next;
+    }
+}
+
+} // namespace NetworKit
@@ -0,0 +1,114 @@
+/*
+ * ReorderingBenchmark.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/Timer.hpp>
+#include <networkit/centrality/PageRank.hpp>
+#include <networkit/community/PLM.hpp>
+#include <networkit/distance/BFS.hpp>
+#include <networkit/generators/HyperbolicGenerator.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/reordering/BFSReordering.hpp>
+#include <networkit/reordering/CommunityReordering.hpp>
+#include <networkit/reordering/DegreeReordering.hpp>
+#include <networkit/reordering/GorderReordering.hpp>
+#include <networkit/reordering/RCMReordering.hpp>
+
+namespace NetworKit {
+
+class ReorderingBenchmark : public testing::Test {
+protected:
+    // Hyperbolic graph with random node ids, i.e., without any locality in the input order
+    static Graph generateShuffledGraph() {
+        Aux::Random::setSeed(42, false);
+        const Graph G = HyperbolicGenerator(1000000, 16, 3).generate();
+        return GraphTools::getCompactedGraph(G, GraphTools::getRandomContinuousNodeIds(G));
+    }
+
+    // The BFSs start from the given sources, so that the original and the reordered graph are
+    // traversed from the same nodes.
+    static void runKernels(const Graph &G, const std::vector<node> &sources,
+                           const std::string &name) {
+        Aux::Timer timer;
+
+        timer.start();
+        PageRank pr(G);
+        pr.run();
+        timer.stop();
+        INFO("[", name, "] PageRank: ", timer.elapsedMilliseconds(), " ms");
+
+        timer.start();
+        for (const node source : sources) {
+            BFS bfs(G, source, false);
+            bfs.run();
+        }
+        timer.stop();
+        INFO("[", name, "] 10x BFS: ", timer.elapsedMilliseconds(), " ms");
+
+        timer.start();
+        PLM plm(G);
+        plm.run();
+        timer.stop();
+        INFO("[", name, "] PLM: ", timer.elapsedMilliseconds(), " ms");
+    }
+
+    static void benchReordering(const Graph &G, NodeReordering &reordering,
+                                const std::string &name) {
+        Aux::Timer timer;
+        timer.start();
+        reordering.run();
+        const Graph R = reordering.getReorderedGraph();
+        timer.stop();
+        INFO("[", name, "] reordering: ", timer.elapsedMilliseconds(), " ms");
+
+        std::vector<node> sources(10), reorderedSources(10);
+        for (node source = 0; source < 10; ++source) {
+            sources[source] = source;
+            reorderedSources[source] = reordering.getPermutation()[source];
+        }
+        runKernels(G, sources, "original");
+        runKernels(R, reorderedSources, name);
+    }
+};
+
+TEST_F(ReorderingBenchmark, benchDegreeReordering) {
+    const Graph G = generateShuffledGraph();
+    DegreeReordering reordering(G);
+    benchReordering(G, reordering, "degree");
+}
+
+TEST_F(ReorderingBenchmark, benchBFSReordering) {
+    const Graph G = generateShuffledGraph();
+    BFSReordering reordering(G);
+    benchReordering(G, reordering, "BFS");
+}
+
+TEST_F(ReorderingBenchmark, benchRCMReordering) {
+    const Graph G = generateShuffledGraph();
+    RCMReordering reordering(G);
+    benchReordering(G, reordering, "RCM");
+}
+
+TEST_F(ReorderingBenchmark, benchGorderReordering) {
+    const Graph G = generateShuffledGraph();
+    GorderReordering reordering(G);
+    benchReordering(G, reordering, "Gorder");
+}
+
+TEST_F(ReorderingBenchmark, benchCommunityReordering) {
+    const Graph G = generateShuffledGraph();
+    CommunityReordering reordering(G);
+    benchReordering(G, reordering, "community");
+}
+
+} // namespace NetworKit
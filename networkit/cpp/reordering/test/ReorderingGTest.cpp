@@ -0,0 +1,331 @@
+/*
+ * ReorderingGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/reordering/BFSReordering.hpp>
+#include <networkit/reordering/CommunityReordering.hpp>
+#include <networkit/reordering/DegreeReordering.hpp>
+#include <networkit/reordering/GorderReordering.hpp>
+#include <networkit/reordering/RCMReordering.hpp>
+
+namespace NetworKit {
+
+class ReorderingGTest : public testing::TestWithParam<std::pair<bool, bool>> {
+protected:
+    bool isWeighted() const noexcept { return GetParam().first; }
+    bool isDirected() const noexcept { return GetParam().second; }
+
+    // Random graph with some deleted nodes, a self-loop and random weights and edge ids
+    Graph generateGraph(count n, double p) const;
+
+    static std::vector<std::unique_ptr<NodeReordering>> allReorderings(const Graph &G);
+
+    static void checkReordering(const Graph &G, const NodeReordering &reordering);
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, ReorderingGTest,
+                         testing::Values(std::make_pair(false, false), std::make_pair(true, false),
+                                         std::make_pair(false, true), std::make_pair(true, true)));
+
+Graph ReorderingGTest::generateGraph(count n, double p) const {
+    Graph G = ErdosRenyiGenerator(n, p, isDirected()).generate();
+    if (isWeighted()) {
+        G = GraphTools::toWeighted(G);
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::real()); });
+    }
+    G.removeNode(3);
+    G.removeNode(n / 2);
+    G.addEdge(0, 0);
+    G.indexEdges();
+    return G;
+}
+
+std::vector<std::unique_ptr<NodeReordering>> ReorderingGTest::allReorderings(const Graph &G) {
+    std::vector<std::unique_ptr<NodeReordering>> reorderings;
+    reorderings.emplace_back(new DegreeReordering(G));
+    reorderings.emplace_back(new DegreeReordering(G, false));
+    reorderings.emplace_back(new BFSReordering(G));
+    if (G.hasNode(1))
+        reorderings.emplace_back(new BFSReordering(G, 1));
+    reorderings.emplace_back(new RCMReordering(G));
+    reorderings.emplace_back(new GorderReordering(G));
+    reorderings.emplace_back(new GorderReordering(G, 1));
+    reorderings.emplace_back(new CommunityReordering(G));
+    return reorderings;
+}
+
+void ReorderingGTest::checkReordering(const Graph &G, const NodeReordering &reordering) {
+    const auto &perm = reordering.getPermutation();
+    const auto &inv = reordering.getInversePermutation();
+    ASSERT_EQ(perm.size(), G.upperNodeIdBound());
+    ASSERT_EQ(inv.size(), G.numberOfNodes());
+
+    for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+        if (!G.hasNode(u)) {
+            EXPECT_EQ(perm[u], none);
+            continue;
+        }
+        ASSERT_LT(perm[u], inv.size());
+        EXPECT_EQ(inv[perm[u]], u);
+    }
+
+    const Graph R = reordering.getReorderedGraph();
+    EXPECT_EQ(R.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(R.upperNodeIdBound(), G.numberOfNodes());
+    EXPECT_EQ(R.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(R.numberOfSelfLoops(), G.numberOfSelfLoops());
+    EXPECT_EQ(R.isWeighted(), G.isWeighted());
+    EXPECT_EQ(R.isDirected(), G.isDirected());
+    EXPECT_EQ(R.hasEdgeIds(), G.hasEdgeIds());
+    EXPECT_TRUE(R.checkConsistency());
+
+    G.forEdges([&](node u, node v, edgeweight ew, edgeid eid) {
+        ASSERT_TRUE(R.hasEdge(perm[u], perm[v]));
+        EXPECT_EQ(R.weight(perm[u], perm[v]), ew);
+        EXPECT_EQ(R.edgeId(perm[u], perm[v]), eid);
+    });
+
+    R.forNodes([&](node u) {
+        EXPECT_EQ(R.degreeOut(u), G.degreeOut(inv[u]));
+        EXPECT_EQ(R.degreeIn(u), G.degreeIn(inv[u]));
+        EXPECT_TRUE(std::is_sorted(R.neighborRange(u).begin(), R.neighborRange(u).end()));
+    });
+}
+
+TEST_P(ReorderingGTest, testPermutations) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(200, 0.03);
+
+    for (auto &reordering : allReorderings(G)) {
+        reordering->run();
+        checkReordering(G, *reordering);
+    }
+}
+
+TEST_P(ReorderingGTest, testDisconnectedGraph) {
+    Graph G(20, isWeighted(), isDirected());
+    for (node u = 0; u < 8; ++u)
+        G.addEdge(u, u + 1);
+    G.addEdge(12, 15);
+    G.addEdge(15, 17);
+    G.removeNode(10);
+    G.indexEdges();
+
+    for (auto &reordering : allReorderings(G)) {
+        reordering->run();
+        checkReordering(G, *reordering);
+    }
+}
+
+TEST_P(ReorderingGTest, testEmptyGraph) {
+    const Graph G(0, isWeighted(), isDirected());
+
+    for (auto &reordering : allReorderings(G)) {
+        reordering->run();
+        EXPECT_TRUE(reordering->getPermutation().empty());
+        EXPECT_EQ(reordering->getReorderedGraph().numberOfNodes(), 0);
+    }
+}
+
+TEST_P(ReorderingGTest, testMapToOriginal) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(100, 0.05);
+    node source = 0;
+
+    std::vector<count> expected(G.upperNodeIdBound(), none);
+    Traversal::BFSfrom(G, source, [&](node u, count dist) { expected[u] = dist; });
+
+    for (auto &reordering : allReorderings(G)) {
+        reordering->run();
+        const Graph R = reordering->getReorderedGraph();
+
+        std::vector<count> distances(R.upperNodeIdBound(), none);
+        Traversal::BFSfrom(R, reordering->getPermutation()[source],
+                           [&](node u, count dist) { distances[u] = dist; });
+
+        EXPECT_EQ(reordering->mapToOriginal(distances, none), expected);
+    }
+}
+
+TEST_P(ReorderingGTest, testMapPartitionToOriginal) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(100, 0.05);
+
+    DegreeReordering reordering(G);
+    reordering.run();
+    const Graph R = reordering.getReorderedGraph();
+
+    Partition zeta(R.upperNodeIdBound());
+    zeta.setUpperBound(3);
+    R.forNodes([&](node u) { zeta[u] = u % 3; });
+
+    const Partition original = reordering.mapToOriginal(zeta);
+    EXPECT_EQ(original.numberOfElements(), G.upperNodeIdBound());
+    EXPECT_EQ(original.upperBound(), zeta.upperBound());
+    for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+        if (G.hasNode(u))
+            EXPECT_EQ(original[u], zeta[reordering.getPermutation()[u]]);
+        else
+            EXPECT_EQ(original[u], none);
+    }
+
+    EXPECT_THROW(reordering.mapToOriginal(Partition(G.upperNodeIdBound() + 1)),
+                 std::runtime_error);
+}
+
+TEST_P(ReorderingGTest, testDegreeReordering) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(200, 0.03);
+
+    for (bool decreasing : {true, false}) {
+        DegreeReordering reordering(G, decreasing);
+        reordering.run();
+        const auto &inv = reordering.getInversePermutation();
+        for (index i = 1; i < inv.size(); ++i) {
+            if (decreasing)
+                EXPECT_GE(G.degreeIn(inv[i - 1]), G.degreeIn(inv[i]));
+            else
+                EXPECT_LE(G.degreeIn(inv[i - 1]), G.degreeIn(inv[i]));
+        }
+    }
+}
+
+TEST_P(ReorderingGTest, testBFSReorderingLevels) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(200, 0.03);
+    if (G.isDirected())
+        return;
+
+    BFSReordering reordering(G, 0);
+    reordering.run();
+    EXPECT_EQ(reordering.getInversePermutation().front(), 0);
+
+    // Within the component of the source, the new ids are ordered by distance.
+    std::vector<count> distances(G.upperNodeIdBound(), none);
+    count reached = 0;
+    Traversal::BFSfrom(G, 0, [&](node u, count dist) {
+        distances[u] = dist;
+        ++reached;
+    });
+    const auto &inv = reordering.getInversePermutation();
+    for (index i = 1; i < reached; ++i)
+        EXPECT_LE(distances[inv[i - 1]], distances[inv[i]]);
+
+    EXPECT_THROW(BFSReordering(G, 3), std::runtime_error);
+}
+
+TEST_P(ReorderingGTest, testRCMReorderingPath) {
+    // A path with shuffled node ids; RCM recovers a bandwidth of 1.
+    const count n = 50;
+    std::vector<node> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    Aux::Random::setSeed(42, false);
+    std::shuffle(ids.begin(), ids.end(), Aux::Random::getURNG());
+
+    Graph G(n, isWeighted(), isDirected());
+    for (index i = 0; i + 1 < n; ++i)
+        G.addEdge(ids[i], ids[i + 1]);
+
+    RCMReordering reordering(G);
+    reordering.run();
+    const auto &perm = reordering.getPermutation();
+    G.forEdges([&](node u, node v) {
+        EXPECT_EQ(std::max(perm[u], perm[v]) - std::min(perm[u], perm[v]), 1);
+    });
+}
+
+TEST_P(ReorderingGTest, testRCMReducesBandwidth) {
+    Aux::Random::setSeed(42, false);
+    // Grid graph with shuffled ids
+    const count side = 20;
+    const count n = side * side;
+    std::vector<node> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::shuffle(ids.begin(), ids.end(), Aux::Random::getURNG());
+
+    Graph G(n, isWeighted(), isDirected());
+    for (index r = 0; r < side; ++r) {
+        for (index c = 0; c < side; ++c) {
+            if (c + 1 < side)
+                G.addEdge(ids[r * side + c], ids[r * side + c + 1]);
+            if (r + 1 < side)
+                G.addEdge(ids[r * side + c], ids[(r + 1) * side + c]);
+        }
+    }
+
+    RCMReordering reordering(G);
+    reordering.run();
+    const auto &perm = reordering.getPermutation();
+    count bandwidth = 0;
+    G.forEdges([&](node u, node v) {
+        bandwidth =
+            std::max<count>(bandwidth, std::max(perm[u], perm[v]) - std::min(perm[u], perm[v]));
+    });
+    // The bandwidth of the grid is side, RCM gets close to it.
+    EXPECT_LE(bandwidth, 2 * side);
+}
+
+TEST_P(ReorderingGTest, testCommunityReordering) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = generateGraph(200, 0.03);
+
+    Partition communities(G.upperNodeIdBound());
+    communities.setUpperBound(5);
+    G.forNodes([&](node u) { communities[u] = (u * 7) % 5; });
+    communities[7] = none;
+
+    CommunityReordering reordering(G, communities);
+    reordering.run();
+    checkReordering(G, reordering);
+
+    // Communities are contiguous and ordered by their smallest node, unassigned nodes are last.
+    const auto &inv = reordering.getInversePermutation();
+    EXPECT_EQ(inv.back(), 7);
+    std::vector<index> seen;
+    for (index i = 0; i + 1 < inv.size(); ++i) {
+        const index c = communities[inv[i]];
+        if (seen.empty() || seen.back() != c) {
+            EXPECT_EQ(std::find(seen.begin(), seen.end(), c), seen.end());
+            seen.push_back(c);
+        }
+    }
+    EXPECT_EQ(seen, std::vector<index>({0, 2, 4, 3, 1}));
+
+    EXPECT_THROW(CommunityReordering(G, Partition(G.upperNodeIdBound() - 1)), std::runtime_error);
+}
+
+TEST_P(ReorderingGTest, testGorderReorderingCliques) {
+    // Two interleaved cliques: Gorder places the nodes of each clique next to each other.
+    const count n = 20;
+    Graph G(n, isWeighted(), isDirected());
+    for (node u = 0; u < n; ++u) {
+        for (node v = u + 2; v < n; v += 2) {
+            G.addEdge(u, v);
+            if (isDirected())
+                G.addEdge(v, u);
+        }
+    }
+
+    GorderReordering reordering(G, 3);
+    reordering.run();
+    const auto &inv = reordering.getInversePermutation();
+    for (index i = 0; i < n; ++i)
+        EXPECT_EQ(inv[i] % 2 == inv[0] % 2, i < n / 2);
+
+    EXPECT_THROW(GorderReordering(G, 0), std::runtime_error);
+}
+
+} // namespace NetworKit
@@ -0,0 +1,118 @@
+/*
+ * BatchPersonalizedPageRank.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <algorithm>
+#include <omp.h>
+#include <stdexcept>
+
+#include <networkit/auxiliary/SignalHandling.hpp>
+#include <networkit/auxiliary/SparseVector.hpp>
+#include <networkit/scd/BatchPersonalizedPageRank.hpp>
+
+namespace NetworKit {
+
+BatchPersonalizedPageRank::BatchPersonalizedPageRank(const Graph &G, std::vector<node> seeds,
+                                                     count k, double alpha, double epsilon)
+    : G(&G), seeds(std::move(seeds)), k(k), alpha(alpha), epsilon(epsilon) {
+    if (G.isDirected())
+        throw std::runtime_error("BatchPersonalizedPageRank requires an undirected graph");
+    for (const node s : this->seeds)
+        if (!G.hasNode(s))
+            throw std::runtime_error("The seeds must be nodes of the graph");
+}
+
+void BatchPersonalizedPageRank::run() {
+    Aux::SignalHandler handler;
+    const count z = G->upperNodeIdBound();
+
+    // The volumes are shared by all seeds; weightedDegree() is linear in the degree.
+    std::vector<double> volume(z, 0.0);
+    G->parallelForNodes([&](node u) { volume[u] = G->weightedDegree(u, true); });
+
+    results.assign(seeds.size(), {});
+
+    // Per-thread state, reused for all seeds of a thread
+    struct PushState {
+        SparseVector<double> pr, residual;
+        std::vector<node> queue;
+        std::vector<std::pair<node, double>> candidates;
+    };
+    std::vector<PushState> states(omp_get_max_threads());
+
+    handler.assureRunning();
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index i = 0; i < static_cast<omp_index>(seeds.size()); ++i) {
+        if (!handler.isRunning())
+            continue;
+        auto &state = states[omp_get_thread_num()];
+        auto &pr = state.pr;
+        auto &residual = state.residual;
+        auto &queue = state.queue;
+        if (pr.upperBound() < z) {
+            pr.resize(z, 0.0);
+            residual.resize(z, 0.0);
+        }
+
+        auto addResidual = [&](node v, double mass) {
+            if (residual.indexIsUsed(v))
+                residual[v] += mass;
+            else
+                residual.insert(v, mass);
+        };
+
+        // Same push rule as ApproximatePageRank: the walk stays at u with probability 1/2.
+        const node seed = seeds[i];
+        residual.insert(seed, 1.0);
+        queue.assign(1, seed);
+        for (index head = 0; head < queue.size(); ++head) {
+            const node u = queue[head];
+            const double res = residual[u];
+            if (volume[u] == 0) {
+                // An isolated node keeps all of its mass
+                pr.insertOrSet(u, pr[u] + res);
+                residual[u] = 0.0;
+                continue;
+            }
+
+            G->forNeighborsOf(u, [&](node, const node v, const edgeweight w) {
+                const double mass = (1.0 - alpha) * res * w / (2.0 * volume[u]);
+                const double threshold = epsilon * volume[v];
+                // only activate v if its residual crosses the threshold
+                if (residual[v] < threshold && residual[v] + mass >= threshold)
+                    queue.push_back(v);
+                addResidual(v, mass);
+            });
+
+            pr.insertOrSet(u, pr[u] + alpha * res);
+            residual[u] = (1.0 - alpha) * res / 2;
+            if (residual[u] / volume[u] >= epsilon)
+                queue.push_back(u);
+        }
+
+        // Select the top k of the touched nodes
+        auto &candidates = state.candidates;
+        candidates.clear();
+        pr.forElements([&](node u, double score) {
+            if (score > 0)
+                candidates.emplace_back(u, score);
+        });
+        const auto byScore = [](const std::pair<node, double> &a,
+                                const std::pair<node, double> &b) {
+            return a.second > b.second || (a.second == b.second && a.first < b.first);
+        };
+        const auto last = candidates.begin() + std::min<count>(k, candidates.size());
+        std::partial_sort(candidates.begin(), last, candidates.end(), byScore);
+        results[i].assign(candidates.begin(), last);
+
+        pr.reset();
+        residual.reset();
+    }
+    handler.assureRunning();
+
+    hasRun = true;
+}
+
+} // namespace NetworKit
@@ -11,6 +11,7 @@
 #include <networkit/io/METISGraphReader.hpp>
 #include <networkit/io/SNAPGraphReader.hpp>
 #include <networkit/scd/ApproximatePageRank.hpp>
+#include <networkit/scd/BatchPersonalizedPageRank.hpp>
 #include <networkit/scd/CliqueDetect.hpp>
 #include <networkit/scd/CombinedSCD.hpp>
 #include <networkit/scd/GCE.hpp>
@@ -37,6 +38,40 @@ TEST_F(SelectiveCDGTest, testRunApproximatePageRank) {
     const auto prVector = apr.run(0);
 }
 
+TEST_F(SelectiveCDGTest, testBatchPersonalizedPageRank) {
+    SNAPGraphReader reader;
+    auto G = reader.read("./input/wiki-Vote.txt");
+    G.addNode(); // isolated seed
+
+    const count k = 10;
+    const double alpha = 0.4, epsilon = 1e-6;
+    std::vector<node> seeds{0, 5, 42, 100, 0, G.upperNodeIdBound() - 1};
+    BatchPersonalizedPageRank bppr(G, seeds, k, alpha, epsilon);
+    bppr.run();
+    const auto &topK = bppr.topK();
+    ASSERT_EQ(topK.size(), seeds.size());
+
+    for (index i = 0; i + 1 < seeds.size(); ++i) {
+        ApproximatePageRank apr(G, alpha, epsilon);
+        auto expected = apr.run(seeds[i]);
+        std::erase_if(expected, [](const auto &entry) { return entry.second <= 0; });
+        std::sort(expected.begin(), expected.end(), [](const auto &a, const auto &b) {
+            return a.second > b.second || (a.second == b.second && a.first < b.first);
+        });
+
+        ASSERT_EQ(topK[i].size(), std::min(k, expected.size()));
+        for (index j = 0; j < topK[i].size(); ++j)
+            EXPECT_NEAR(topK[i][j].second, expected[j].second, 1e-12);
+        for (index j = 1; j < topK[i].size(); ++j)
+            EXPECT_GE(topK[i][j - 1].second, topK[i][j].second);
+    }
+
+    // The isolated seed keeps all of its mass
+    ASSERT_EQ(topK.back().size(), 1);
+    EXPECT_EQ(topK.back()[0].first, seeds.back());
+    EXPECT_DOUBLE_EQ(topK.back()[0].second, 1.0);
+}
+
 TEST_F(SelectiveCDGTest, testRandomBFS) {
     Aux::Random::setSeed(32, false);
     METISGraphReader reader;
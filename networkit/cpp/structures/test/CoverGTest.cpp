@@ -112,7 +112,7 @@ TEST_F(CoverGTest, testSubsetSizesWithUnassignedElements) {
     for (index i = 0; i < n; i += 2) {
         c.toSingleton(i);
     }
-    std::vector<index> controlSet = {1, 1, 1, 1, 1};
+    std::vector<count> controlSet = {1, 1, 1, 1, 1};
     EXPECT_EQ(c.subsetSizes(), controlSet);
 }
 
@@ -122,7 +122,7 @@ TEST_F(CoverGTest, testSubsetSizesTrivial) {
     for (index i = 0; i < n; i++) {
         c.toSingleton(i);
     }
-    std::vector<index> controlSet = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+    std::vector<count> controlSet = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
     EXPECT_EQ(c.subsetSizes(), controlSet);
 }
 
@@ -135,7 +135,7 @@ TEST_F(CoverGTest, testSubsetSizesTrivial2) {
     for (index i = 1; i < n; i += 2) {
         c.addToSubset((i / 2) + 1, i);
     }
-    std::vector<index> controlSet = {2, 2, 2, 2, 2};
+    std::vector<count> controlSet = {2, 2, 2, 2, 2};
     EXPECT_EQ(c.subsetSizes(), controlSet);
 }
 
@@ -148,7 +148,7 @@ TEST_F(CoverGTest, testSubsetSizesAssignedToMultipleSubsets) {
     for (index i = 1; i < n; i += 2) {
         c.addToSubset(i, i);
     }
-    std::vector<index> controlSet = {2, 1, 2, 1, 2, 1, 2, 1, 2, 1};
+    std::vector<count> controlSet = {2, 1, 2, 1, 2, 1, 2, 1, 2, 1};
     EXPECT_EQ(c.subsetSizes(), controlSet);
 }
 
@@ -163,7 +163,7 @@ TEST_F(CoverGTest, testSubsetSizesAssignedToMultipleSubsets2) {
     for (index i = 0; i < n; i++) {
         c.addToSubset(i + 1, 0);
     }
-    std::vector<index> controlSet = {2, 2, 3, 2, 3, 2, 3, 2, 3, 2};
+    std::vector<count> controlSet = {2, 2, 3, 2, 3, 2, 3, 2, 3, 2};
     EXPECT_EQ(c.subsetSizes(), controlSet);
 }
 
@@ -204,7 +204,7 @@ TEST_F(CoverGTest, testMergeSubsetsAndGetMembers) {
     c.mergeSubsets(1, 3);
     c.mergeSubsets(5, 11);
     auto c11 = c.getMembers(11);
-    std::vector<index> controlSetSizes = {2, 2, 2, 3, 2, 3, 2, 6};
+    std::vector<count> controlSetSizes = {2, 2, 2, 3, 2, 3, 2, 6};
     // remaining subset IDs 2,4,6,7,8,9,10,12
     // their sizes          2,2,2,3,2,3,2,6
     std::set<index> controlSetMembers = {0, 1, 2, 3, 4, 5};
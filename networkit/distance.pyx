@@ -1211,6 +1211,119 @@ cdef class APSP(Algorithm):
 		"""
 		return (<_APSP*>(self._this)).getDistance(u, v)
 
+cdef extern from "<networkit/distance/BlockedAPSP.hpp>" namespace "NetworKit::BlockedAPSP":
+
+	cdef enum _Encoding "NetworKit::BlockedAPSP::Encoding":
+		UINT8,
+		UINT16,
+		UINT32,
+		FLOAT64,
+		AUTO
+
+class Encoding(object):
+	UINT8 = _Encoding.UINT8
+	UINT16 = _Encoding.UINT16
+	UINT32 = _Encoding.UINT32
+	FLOAT64 = _Encoding.FLOAT64
+	AUTO = _Encoding.AUTO
+
+cdef extern from "<networkit/distance/BlockedAPSP.hpp>":
+
+	cdef cppclass _BlockedAPSP "NetworKit::BlockedAPSP"(_Algorithm):
+		_BlockedAPSP(_Graph G) except +
+		_BlockedAPSP(string path) except +
+		edgeweight getDistance(node u, node v) except +
+		_Encoding getEncoding() except +
+		count numberOfNodes() except +
+		_Encoding encoding
+		count tileSize
+		count maxTileBytes
+		string outputPath
+
+cdef class BlockedAPSP(Algorithm):
+	"""
+	BlockedAPSP(G=None, outputPath=None, encoding=networkit.distance.Encoding.AUTO, tileSize=0, path=None)
+
+	All-Pairs Shortest-Paths with bounded memory. The sources are processed in tiles of
+	consecutive node ids; each tile is appended to a matrix file that is mapped into memory after
+	run(). The distances are stored with a narrow type, e.g., one byte per hop count for unweighted
+	graphs with small diameter. Unreachable pairs are stored as the largest value of the type.
+
+	Parameter :code:`encoding` can be one of the following:
+
+	- networkit.distance.Encoding.UINT8 (unweighted graphs only)
+	- networkit.distance.Encoding.UINT16 (unweighted graphs only)
+	- networkit.distance.Encoding.UINT32 (unweighted graphs only)
+	- networkit.distance.Encoding.FLOAT64
+	- networkit.distance.Encoding.AUTO
+
+	Parameters
+	----------
+	G : networkit.Graph, optional
+		The input graph.
+	outputPath : str, optional
+		Path of the matrix file written by run().
+	encoding : networkit.distance.Encoding, optional
+		Type of the stored distances. AUTO picks the smallest integer type that fits an upper bound
+		of the distances of unweighted graphs. Default: networkit.distance.Encoding.AUTO
+	tileSize : int, optional
+		Number of sources per tile; if 0, a tile takes at most 1 GiB. Default: 0
+	path : str, optional
+		Instead of a graph, the path of a matrix written by run(). The file is mapped into memory
+		and can be queried right away.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G = None, outputPath = None, encoding = Encoding.AUTO, tileSize = 0, path = None):
+		if G is not None:
+			self._G = G
+			self._this = new _BlockedAPSP(G._this)
+			(<_BlockedAPSP*>(self._this)).encoding = encoding
+			(<_BlockedAPSP*>(self._this)).tileSize = tileSize
+			if outputPath is not None:
+				(<_BlockedAPSP*>(self._this)).outputPath = stdstring(outputPath)
+		elif path is not None:
+			self._this = new _BlockedAPSP(stdstring(path))
+		else:
+			raise ValueError("Either a graph or the path of a matrix is required")
+
+	def __dealloc__(self):
+		self._G = None
+
+	def getDistance(self, node u, node v):
+		"""
+		getDistance(u, v)
+
+		Returns the length of the shortest path from source u to target v. Requires a matrix
+		file, i.e., outputPath must have been set.
+
+		Parameters
+		----------
+		u : node
+			Index of source node u.
+		v : node
+			Index of target node v.
+
+		Returns
+		-------
+		float
+			The distance from u to v.
+		"""
+		return (<_BlockedAPSP*>(self._this)).getDistance(u, v)
+
+	def getEncoding(self):
+		"""
+		getEncoding()
+
+		Returns the encoding of the stored distances (never AUTO).
+
+		Returns
+		-------
+		networkit.distance.Encoding
+			The encoding of the distances.
+		"""
+		return (<_BlockedAPSP*>(self._this)).getEncoding()
+
 cdef extern from "<networkit/distance/SPSP.hpp>":
 
 	cdef cppclass _SPSP "NetworKit::SPSP"(_Algorithm):
@@ -1221,10 +1334,11 @@ cdef extern from "<networkit/distance/SPSP.hpp>":
 		edgeweight getDistance(node u, node v) except +
 		void setSources(vector[node].iterator sourcesFirst, vector[node].iterator sourcesLast)
 		void setTargets(vector[node].iterator targetsFirst, vector[node].iterator targetsLast)
+		bool useDeltaStepping
 
 cdef class SPSP(Algorithm):
 	"""
-	SPSP(G, sources)
+	SPSP(G, sources, targets=[], useDeltaStepping=False)
 	
 	Some-Pairs Shortest-Paths algorithm (implemented running Dijkstra's algorithm from each source
 	node, or BFS if G is unweighted).
@@ -1236,15 +1350,22 @@ cdef class SPSP(Algorithm):
 		The graph.
 	sources : list(int)
 		Set of source nodes.
+	targets : list(int), optional
+		Set of target nodes. Default: []
+	useDeltaStepping : bool, optional
+		If True and G is weighted, the sources are processed one after the other, each with a
+		parallel DeltaStepping search. Faster if there are fewer sources than threads.
+		Default: False
 	"""
 	cdef Graph _G
 
-	def __cinit__(self, Graph G not None, vector[node] sources, vector[node] targets = []):
+	def __cinit__(self, Graph G not None, vector[node] sources, vector[node] targets = [], useDeltaStepping = False):
 		self._G = G
 		if not targets.empty():
 			self._this = new _SPSP(G._this, sources.begin(), sources.end(), targets.begin(), targets.end())
 		else:
 			self._this = new _SPSP(G._this, sources.begin(), sources.end())
+		(<_SPSP*>(self._this)).useDeltaStepping = useDeltaStepping
 
 	def __dealloc__(self):
 		self._G = None
@@ -1402,6 +1523,41 @@ cdef class Dijkstra(SSSP):
 		self._G = G
 		self._this = new _Dijkstra(G._this, source, storePaths, storeNodesSortedByDistance, target)
 
+cdef extern from "<networkit/distance/DeltaStepping.hpp>":
+
+	cdef cppclass _DeltaStepping "NetworKit::DeltaStepping"(_SSSP):
+		_DeltaStepping(_Graph G, node source, bool_t storePaths, bool_t storeNodesSortedByDistance, node target) except +
+		edgeweight delta
+
+cdef class DeltaStepping(SSSP):
+	"""
+	DeltaStepping(G, source, storePaths=True, storeNodesSortedByDistance=False, target=None, delta=0.0)
+
+	Parallel SSSP algorithm for graphs with non-negative edge weights. The nodes are kept in buckets
+	of width delta according to their tentative distances; the edges of all nodes of the current
+	bucket are relaxed in parallel. Returns the same distances, predecessors and numbers of paths as
+	Dijkstra.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The graph.
+	source : int
+		The source node of the search.
+	storePaths : bool, optional
+		Controls whether to store paths and number of paths. Default: True
+	storeNodesSortedByDistance : bool, optional
+		Controls whether to store nodes sorted by distance. Default: False
+	target: int or None, optional
+		Terminate search when the bucket of the target has been processed. In default-mode, this target is set to None.
+	delta : float, optional
+		Width of the buckets. If 0, it is chosen as the maximum edge weight divided by the average degree. Default: 0.0
+	"""
+	def __cinit__(self, Graph G, source, storePaths=True, storeNodesSortedByDistance=False, node target=none, edgeweight delta=0.0):
+		self._G = G
+		self._this = new _DeltaStepping(G._this, source, storePaths, storeNodesSortedByDistance, target)
+		(<_DeltaStepping*>(self._this)).delta = delta
+
 cdef extern from "<networkit/distance/MultiTargetBFS.hpp>":
 	cdef cppclass _MultiTargetBFS "NetworKit::MultiTargetBFS"(_STSP):
 		_MultiTargetBFS(_Graph G, node source, vector[node].iterator targetsFirst, vector[node].iterator targetsLast) except +
@@ -1721,28 +1877,40 @@ cdef extern from "<networkit/distance/PrunedLandmarkLabeling.hpp>":
 
 	cdef cppclass _PrunedLandmarkLabeling "NetworKit::PrunedLandmarkLabeling"(_Algorithm):
 		_PrunedLandmarkLabeling(_Graph G) except +
+		_PrunedLandmarkLabeling(string path) except +
 		count query(node u, node v) except +
+		count numberOfLabels() except +
+		void save(string path) except +
 
 cdef class PrunedLandmarkLabeling(Algorithm):
 	"""
-	PrunedLandmarkLabeling(G)
+	PrunedLandmarkLabeling(G=None, path=None)
 
 	Pruned Landmark Labeling algorithm based on the paper "Fast exact shortest-path distance
 	queries on large networks by pruned landmark labeling" from Akiba et al., ACM SIGMOD 2013.
 	The algorithm computes distance labels by performing pruned breadth-first searches from each
 	vertex. Labels are used to quickly retrieve shortest-path distances between node pairs.
+	The labels are computed in parallel.
 	Note: this algorithm only works for unweighted graphs.
 
 	Parameters
 	----------
-	G : networkit.Graph
+	G : networkit.Graph, optional
 		The input graph.
+	path : str, optional
+		Instead of a graph, the path of an index written by save(). The file is mapped into
+		memory and can be queried right away.
 	"""
 	cdef Graph _G
 
-	def __cinit__(self, Graph G):
-		self._G = G
-		self._this = new _PrunedLandmarkLabeling(G._this)
+	def __cinit__(self, Graph G = None, path = None):
+		if G is not None:
+			self._G = G
+			self._this = new _PrunedLandmarkLabeling(G._this)
+		elif path is not None:
+			self._this = new _PrunedLandmarkLabeling(stdstring(path))
+		else:
+			raise ValueError("Either a graph or the path of an index is required")
 
 	def __dealloc__(self):
 		self._G = None
@@ -1767,6 +1935,205 @@ cdef class PrunedLandmarkLabeling(Algorithm):
 		"""
 		return (<_PrunedLandmarkLabeling*>(self._this)).query(u, v)
 
+	def numberOfLabels(self):
+		"""
+		numberOfLabels()
+
+		Returns the total number of labels of all nodes.
+
+		Returns
+		-------
+		int
+			The number of labels.
+		"""
+		return (<_PrunedLandmarkLabeling*>(self._this)).numberOfLabels()
+
+	def save(self, path):
+		"""
+		save(path)
+
+		Writes the index to a file that can be loaded with PrunedLandmarkLabeling(path=path).
+
+		Parameters
+		----------
+		path : str
+			Path of the index file.
+		"""
+		(<_PrunedLandmarkLabeling*>(self._this)).save(stdstring(path))
+
+
+cdef extern from "<networkit/distance/ContractionHierarchy.hpp>":
+
+	cdef cppclass _ContractionHierarchy "NetworKit::ContractionHierarchy"(_Algorithm):
+		_ContractionHierarchy(_Graph G, bool_t hubLabels) except +
+		_ContractionHierarchy(string path) except +
+		edgeweight distance(node u, node v) except +
+		bool_t hasHubLabels() except +
+		index rank(node u) except +
+		count numberOfShortcuts() except +
+		count numberOfLabels() except +
+		void save(string path) except +
+
+cdef class ContractionHierarchy(Algorithm):
+	"""
+	ContractionHierarchy(G=None, hubLabels=False, path=None)
+
+	Preprocessing-based index for point-to-point shortest-path queries on weighted graphs,
+	based on "Exact Routing in Large Road Networks Using Contraction Hierarchies" from
+	Geisberger et al., Transportation Science 2012. Independent sets of nodes are contracted in
+	parallel. Queries are answered by ContractionHierarchyQuery or, if hub labels have been
+	extracted, by distance().
+
+	Parameters
+	----------
+	G : networkit.Graph, optional
+		The input graph. Edge weights must be non-negative.
+	hubLabels : bool, optional
+		If True, run() also extracts hub labels from the hierarchy. Default: False
+	path : str, optional
+		Instead of a graph, the path of an index written by save(). The file is mapped into
+		memory and can be queried right away.
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G = None, bool_t hubLabels = False, path = None):
+		if G is not None:
+			self._G = G
+			self._this = new _ContractionHierarchy(G._this, hubLabels)
+		elif path is not None:
+			self._this = new _ContractionHierarchy(stdstring(path))
+		else:
+			raise ValueError("Either a graph or the path of an index is required")
+
+	def __dealloc__(self):
+		self._G = None
+
+	def distance(self, node u, node v):
+		"""
+		distance(u, v)
+
+		Returns the shortest-path distance from u to v with the hub labels.
+
+		Parameters
+		----------
+		u : node
+			Source node.
+		v : node
+			Target node.
+
+		Returns
+		-------
+		float
+			The shortest-path distance, or the maximum double value if v is not reachable from u.
+		"""
+		return (<_ContractionHierarchy*>(self._this)).distance(u, v)
+
+	def hasHubLabels(self):
+		"""
+		hasHubLabels()
+
+		Returns True iff the index contains hub labels.
+
+		Returns
+		-------
+		bool
+			True iff the index contains hub labels.
+		"""
+		return (<_ContractionHierarchy*>(self._this)).hasHubLabels()
+
+	def rank(self, node u):
+		"""
+		rank(u)
+
+		Returns the position of node u in the contraction order.
+
+		Parameters
+		----------
+		u : node
+			The node.
+
+		Returns
+		-------
+		int
+			The rank of u.
+		"""
+		return (<_ContractionHierarchy*>(self._this)).rank(u)
+
+	def numberOfShortcuts(self):
+		"""
+		numberOfShortcuts()
+
+		Returns the number of shortcut edges that have been added during the contraction.
+
+		Returns
+		-------
+		int
+			The number of shortcuts.
+		"""
+		return (<_ContractionHierarchy*>(self._this)).numberOfShortcuts()
+
+	def numberOfLabels(self):
+		"""
+		numberOfLabels()
+
+		Returns the total number of hub labels of all nodes.
+
+		Returns
+		-------
+		int
+			The number of labels.
+		"""
+		return (<_ContractionHierarchy*>(self._this)).numberOfLabels()
+
+	def save(self, path):
+		"""
+		save(path)
+
+		Writes the index to a file that can be loaded with ContractionHierarchy(path=path).
+
+		Parameters
+		----------
+		path : str
+			Path of the index file.
+		"""
+		(<_ContractionHierarchy*>(self._this)).save(stdstring(path))
+
+cdef extern from "<networkit/distance/ContractionHierarchyQuery.hpp>":
+	cdef cppclass _ContractionHierarchyQuery "NetworKit::ContractionHierarchyQuery"(_STSP):
+		_ContractionHierarchyQuery(_Graph G, _ContractionHierarchy ch, node source, node target, bool_t storePred) except +
+
+cdef class ContractionHierarchyQuery(STSP):
+	"""
+	ContractionHierarchyQuery(G, ch, source, target, storePred=True)
+
+	Source-target shortest path with a contraction hierarchy: a bidirectional Dijkstra search
+	that only relaxes edges to nodes of higher rank. The shortcuts of the path are unpacked
+	into edges of the graph.
+
+	Parameters:
+	-----------
+
+	G : networkit.Graph
+		The input graph.
+	ch : networkit.distance.ContractionHierarchy
+		Contraction hierarchy of G; it must have been run or loaded.
+	source : int
+		The source node.
+	target : int
+		The target node.
+	storePred : bool, optional
+		If True, the algorithm will also store the predecessors
+		and reconstruct a shortest path from source and target.
+	"""
+	cdef ContractionHierarchy _ch
+
+	def __cinit__(self, Graph G, ContractionHierarchy ch, node source, node target, bool_t storePred=True):
+		self._G = G
+		self._ch = ch
+		self._this = new _ContractionHierarchyQuery(G._this, dereference(<_ContractionHierarchy*>(ch._this)), source, target, storePred)
+
+	def __dealloc__(self):
+		self._ch = None
 
 cdef extern from "<networkit/distance/DynPrunedLandmarkLabeling.hpp>":
 
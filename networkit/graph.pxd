@@ -55,12 +55,15 @@ cdef extern from "<networkit/graph/Graph.hpp>":
 		node addNode() except +
 		node addNodes(node) except +
 		void removeNode(node u) except +
+		void removeNodes(vector[node] nodes) except +
 		bool_t hasNode(node u) except +
 		void restoreNode(node u) except +
 		bool_t addEdge(node u, node v, edgeweight w, bool_t checkMultiEdge) except +
+		void addEdges(vector[pair[node, node]] edges, vector[edgeweight] weights) except +
 		void setWeight(node u, node v, edgeweight w) except +
 		void increaseWeight(node u, node v, edgeweight w) except +
 		void removeEdge(node u, node v) except +
+		void removeEdges(vector[pair[node, node]] edges) except +
 		void removeAllEdges() except +
 		void removeSelfLoops() except +
 		void removeMultiEdges() except +
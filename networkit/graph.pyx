@@ -342,6 +342,19 @@ cdef class Graph:
 		"""
 		self._this.removeNode(u)
 
+	def removeNodes(self, nodes):
+		"""
+		removeNodes(nodes)
+
+		Remove several nodes and all their incident edges from the graph in parallel.
+
+		Parameters
+		----------
+		nodes : list(int)
+			Ids of the nodes to be removed, each node must occur at most once.
+		"""
+		self._this.removeNodes(nodes)
+
 	def restoreNode(self, u):
 		""" 
 		restoreNode(u)
@@ -481,15 +494,25 @@ cdef class Graph:
 			raise TypeError('invalid input format')
 
 		cdef int numEdges = len(row)
+		cdef vector[pair[node, node]] edges
+		cdef vector[edgeweight] weights
 
 		if addMissing:	
 			for i in range(numEdges):
 				# Calling Python interface of addEdge due to addMissing support. 
 				self.addEdge(row[i], col[i], data[i], addMissing, checkMultiEdge)
-		else:	
+		elif checkMultiEdge:
 			for i in range(numEdges):
 				# Calling Cython interface of addEdge directly for higher performance. 
 				self._this.addEdge(row[i], col[i], data[i], checkMultiEdge)
+		else:
+			# Without checks, all edges are inserted at once in parallel.
+			edges.reserve(numEdges)
+			weights.reserve(numEdges)
+			for i in range(numEdges):
+				edges.push_back(pair[node, node](row[i], col[i]))
+				weights.push_back(data[i])
+			self._this.addEdges(edges, weights)
 
 		return self
 
@@ -545,6 +568,21 @@ cdef class Graph:
 		self._this.removeEdge(u, v)
 		return self
 
+	def removeEdges(self, edges):
+		"""
+		removeEdges(edges)
+
+		Removes several edges from the graph in parallel. Each pair removes one edge.
+		If one of the edges does not exist, an exception is raised and the graph is not modified.
+
+		Parameters
+		----------
+		edges : list(tuple(int, int))
+			Edges to be removed.
+		"""
+		self._this.removeEdges(edges)
+		return self
+
 	def removeAllEdges(self):
 		"""
 		removeAllEdges()
@@ -95,6 +95,43 @@ class MultipleEdgesHandling:
 	SumWeightsUp = SUM_WEIGHTS_UP
 	KeepMinimumWeight = KEEP_MINIMUM_WEIGHT
 
+cdef extern from "<networkit/io/StreamingGraphReader.hpp>":
+
+	cdef cppclass _StreamingGraphReader "NetworKit::StreamingGraphReader"(_GraphReader):
+		_Graph readStreaming(string path) except + nogil
+
+cdef class StreamingGraphReader(GraphReader):
+	""" Abstract base class for edge list readers that support reading with bounded memory"""
+
+	def __init__(self, *args, **kwargs):
+		if type(self) == StreamingGraphReader:
+			raise RuntimeError("Error, you may not use StreamingGraphReader directly, use a sub-class instead")
+
+	def readStreaming(self, path):
+		"""
+		readStreaming(path)
+
+		Read graph given by path in two passes over the file: the first pass counts the degrees,
+		the second one fills the adjacency arrays. Peak memory stays close to the size of the
+		resulting graph.
+
+		Parameters
+		----------
+		path : str
+			Path string.
+
+		Returns
+		-------
+		networkit.Graph
+			The resulting graph.
+		"""
+		cdef string cpath = stdstring(path)
+		cdef _Graph result
+
+		with nogil:
+			result = move((<_StreamingGraphReader*>(self._this)).readStreaming(cpath))
+		return Graph(0).setThis(result)
+
 cdef extern from "<networkit/io/GraphWriter.hpp>":
 
 	cdef cppclass _GraphWriter "NetworKit::GraphWriter":
@@ -307,12 +344,12 @@ cdef class ThrillGraphBinaryWriter(GraphWriter):
 
 cdef extern from "<networkit/io/EdgeListReader.hpp>":
 
-	cdef cppclass _EdgeListReader "NetworKit::EdgeListReader"(_GraphReader):
+	cdef cppclass _EdgeListReader "NetworKit::EdgeListReader"(_StreamingGraphReader):
 		_EdgeListReader() except +
 		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool_t continuous, bool_t directed)
 		cmap[string,node] getNodeMap() except +
 
-cdef class EdgeListReader(GraphReader):
+cdef class EdgeListReader(StreamingGraphReader):
 	""" 
 	EdgeListReader(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False)
 
@@ -379,11 +416,11 @@ cdef class EdgeListReader(GraphReader):
 
 cdef extern from "<networkit/io/KONECTGraphReader.hpp>":
 
-	cdef cppclass _KONECTGraphReader "NetworKit::KONECTGraphReader"(_GraphReader):
+	cdef cppclass _KONECTGraphReader "NetworKit::KONECTGraphReader"(_StreamingGraphReader):
 		_KONECTGraphReader() except +
 		_KONECTGraphReader(bool_t remapNodes, _MultipleEdgesHandling handlingmethod)
 
-cdef class KONECTGraphReader(GraphReader):
+cdef class KONECTGraphReader(StreamingGraphReader):
 	""" 
 	KONECTGraphReader(remapNodes = False, handlingmethod = networkit.graphio.MultipleEdgesHandling.DISCARD_EDGES)
 
@@ -554,11 +591,11 @@ cdef class SNAPGraphWriter(GraphWriter):
 
 cdef extern from "<networkit/io/SNAPGraphReader.hpp>":
 
-	cdef cppclass _SNAPGraphReader "NetworKit::SNAPGraphReader"(_GraphReader):
+	cdef cppclass _SNAPGraphReader "NetworKit::SNAPGraphReader"(_StreamingGraphReader):
 		_SNAPGraphReader() except +
 		_SNAPGraphReader(bool_t directed, bool_t remapNodes, count nodeCount)
 
-cdef class SNAPGraphReader(GraphReader):
+cdef class SNAPGraphReader(StreamingGraphReader):
 	"""
 	SNAPGraphReader(directed = False, remapNodes = True, nodeCount = 0)
 
@@ -0,0 +1,231 @@
+# distutils: language=c++
+
+from libcpp.vector cimport vector
+from libcpp cimport bool as bool_t
+
+from .base cimport _Algorithm, Algorithm
+from .graph cimport _Graph, Graph
+from .structures cimport _Partition, Partition, count, index, node
+
+cdef extern from "<networkit/Globals.hpp>" namespace "NetworKit":
+
+	index _none "NetworKit::none"
+
+none = _none
+
+cdef extern from "<networkit/reordering/NodeReordering.hpp>":
+
+	cdef cppclass _NodeReordering "NetworKit::NodeReordering"(_Algorithm):
+		_NodeReordering(_Graph G) except +
+		vector[node] getPermutation() except +
+		vector[node] getInversePermutation() except +
+		_Graph getReorderedGraph() except +
+		vector[double] mapValuesToOriginal "mapToOriginal<double>"(vector[double] values, double defaultValue) except +
+		_Partition mapPartitionToOriginal "mapToOriginal"(_Partition zeta) except +
+
+cdef class NodeReordering(Algorithm):
+	"""
+	Abstract base class for algorithms that relabel the nodes of a graph to
+	improve the cache locality of graph traversals. The new node ids are
+	continuous, i.e., the reordered graph has no deleted nodes.
+	"""
+
+	cdef Graph _G
+
+	def __init__(self, *args, **kwargs):
+		if type(self) == NodeReordering:
+			raise RuntimeError("Error, you may not use NodeReordering directly, use a sub-class instead")
+
+	def __dealloc__(self):
+		self._G = None # just to be sure the graph is deleted
+
+	def getPermutation(self):
+		"""
+		getPermutation()
+
+		Returns the permutation as a list indexed by the original node ids.
+		Deleted nodes of the original graph are mapped to networkit.none.
+
+		Returns
+		-------
+		list(int)
+			The new id of every node.
+		"""
+		return (<_NodeReordering*>(self._this)).getPermutation()
+
+	def getInversePermutation(self):
+		"""
+		getInversePermutation()
+
+		Returns the inverse permutation as a list indexed by the new node ids.
+
+		Returns
+		-------
+		list(int)
+			The original id of every new node.
+		"""
+		return (<_NodeReordering*>(self._this)).getInversePermutation()
+
+	def getReorderedGraph(self):
+		"""
+		getReorderedGraph()
+
+		Returns a copy of the graph with the nodes relabeled according to the
+		permutation. Weights and edge ids are preserved.
+
+		Returns
+		-------
+		networkit.Graph
+			The reordered graph.
+		"""
+		return Graph().setThis((<_NodeReordering*>(self._this)).getReorderedGraph())
+
+	def mapToOriginal(self, values, defaultValue = 0.0):
+		"""
+		mapToOriginal(values, defaultValue = 0.0)
+
+		Maps per-node values or a partition computed on the reordered graph
+		back to the original graph.
+
+		Parameters
+		----------
+		values : list(float) or networkit.Partition
+			Values indexed by the new node ids, or a partition of the reordered graph.
+		defaultValue : float, optional
+			Value for the deleted nodes of the original graph. Ignored for partitions,
+			deleted nodes are not assigned to any subset. Default: 0.0
+
+		Returns
+		-------
+		list(float) or networkit.Partition
+			The values or the partition indexed by the original node ids.
+		"""
+		if isinstance(values, Partition):
+			return Partition().setThis((<_NodeReordering*>(self._this)).mapPartitionToOriginal((<Partition>values)._this))
+		return (<_NodeReordering*>(self._this)).mapValuesToOriginal(values, defaultValue)
+
+cdef extern from "<networkit/reordering/DegreeReordering.hpp>":
+
+	cdef cppclass _DegreeReordering "NetworKit::DegreeReordering"(_NodeReordering):
+		_DegreeReordering(_Graph G, bool_t decreasing) except +
+
+cdef class DegreeReordering(NodeReordering):
+	"""
+	DegreeReordering(G, decreasing=True)
+
+	Sorts the nodes by their (in-)degree. Placing the hubs next to each other
+	improves the locality of the accesses to their neighbors' data.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	decreasing : bool, optional
+		If true, the nodes with the highest degree get the smallest ids. Default: True
+	"""
+
+	def __cinit__(self, Graph G, decreasing = True):
+		self._G = G
+		self._this = new _DegreeReordering(G._this, decreasing)
+
+cdef extern from "<networkit/reordering/BFSReordering.hpp>":
+
+	cdef cppclass _BFSReordering "NetworKit::BFSReordering"(_NodeReordering):
+		_BFSReordering(_Graph G, node source) except +
+
+cdef class BFSReordering(NodeReordering):
+	"""
+	BFSReordering(G, source=networkit.none)
+
+	Numbers the nodes in the order in which a BFS visits them, ignoring edge
+	directions. Further components are traversed starting from their node
+	with the smallest id.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	source : int, optional
+		The first node of the BFS. If networkit.none, the node with the highest
+		degree is used. Default: networkit.none
+	"""
+
+	def __cinit__(self, Graph G, node source = _none):
+		self._G = G
+		self._this = new _BFSReordering(G._this, source)
+
+cdef extern from "<networkit/reordering/RCMReordering.hpp>":
+
+	cdef cppclass _RCMReordering "NetworKit::RCMReordering"(_NodeReordering):
+		_RCMReordering(_Graph G) except +
+
+cdef class RCMReordering(NodeReordering):
+	"""
+	RCMReordering(G)
+
+	Reverse Cuthill-McKee ordering: a BFS from a pseudo-peripheral node that
+	visits the neighbors in order of increasing degree, reversed afterwards.
+	Reduces the bandwidth of the adjacency matrix. Edge directions are ignored.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	"""
+
+	def __cinit__(self, Graph G):
+		self._G = G
+		self._this = new _RCMReordering(G._this)
+
+cdef extern from "<networkit/reordering/GorderReordering.hpp>":
+
+	cdef cppclass _GorderReordering "NetworKit::GorderReordering"(_NodeReordering):
+		_GorderReordering(_Graph G, count windowSize) except +
+
+cdef class GorderReordering(NodeReordering):
+	"""
+	GorderReordering(G, windowSize=5)
+
+	Greedy Gorder ordering by Wei et al.: repeatedly appends the node that
+	shares the most neighbors with the last windowSize placed nodes.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	windowSize : int, optional
+		Number of recently placed nodes considered by the score. Default: 5
+	"""
+
+	def __cinit__(self, Graph G, count windowSize = 5):
+		self._G = G
+		self._this = new _GorderReordering(G._this, windowSize)
+
+cdef extern from "<networkit/reordering/CommunityReordering.hpp>":
+
+	cdef cppclass _CommunityReordering "NetworKit::CommunityReordering"(_NodeReordering):
+		_CommunityReordering(_Graph G) except +
+		_CommunityReordering(_Graph G, _Partition communities) except +
+
+cdef class CommunityReordering(NodeReordering):
+	"""
+	CommunityReordering(G, communities=None)
+
+	Stores the nodes of each community next to each other. Communities are
+	ordered by their node with the smallest id; nodes that are not assigned to
+	any community are placed last.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The input graph.
+	communities : networkit.Partition, optional
+		A partition of the nodes. If None, the communities are detected with PLM. Default: None
+	"""
+
+	def __cinit__(self, Graph G, Partition communities = None):
+		self._G = G
+		if communities is None:
+			self._this = new _CommunityReordering(G._this)
+		else:
+			self._this = new _CommunityReordering(G._this, communities._this)
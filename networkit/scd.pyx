@@ -8,7 +8,7 @@ from libcpp.string cimport string
 from cython.operator import dereference
 
 from .base cimport _Algorithm, Algorithm
-from .structures cimport _Cover, Cover
+from .structures cimport _Cover, Cover, count
 from .helpers import stdstring
 
 cdef class SelectiveCommunityDetector:
@@ -128,6 +128,52 @@ cdef class ApproximatePageRank:
 		except TypeError:
 			return self._this.run(<node?>seeds)
 
+cdef extern from "<networkit/scd/BatchPersonalizedPageRank.hpp>":
+
+	cdef cppclass _BatchPersonalizedPageRank "NetworKit::BatchPersonalizedPageRank"(_Algorithm):
+		_BatchPersonalizedPageRank(_Graph G, vector[node] seeds, count k, double alpha, double epsilon) except +
+		vector[vector[pair[node, double]]] topK() except +
+
+cdef class BatchPersonalizedPageRank(Algorithm):
+	"""
+	BatchPersonalizedPageRank(G, seeds, k, alpha, epsilon=1e-12)
+
+	Computes approximate personalized PageRank vectors for many seeds in parallel
+	and keeps the k nodes with the highest scores per seed. Each vector is computed
+	as by ApproximatePageRank.
+
+	Parameters
+	----------
+	G : networkit.Graph
+		The undirected graph.
+	seeds : list(int)
+		The seed nodes.
+	k : int
+		The number of nodes with the highest scores that are kept per seed.
+	alpha : float
+		Loop probability of random walk.
+	epsilon: float, optional
+		Error tolerance. Default: 1e-12
+	"""
+	cdef Graph _G
+
+	def __cinit__(self, Graph G not None, vector[node] seeds, count k, double alpha, double epsilon=1e-12):
+		self._G = G
+		self._this = new _BatchPersonalizedPageRank(G._this, seeds, k, alpha, epsilon)
+
+	def topK(self):
+		"""
+		topK()
+
+		Returns, for every seed, the k nodes with the highest scores.
+
+		Returns
+		-------
+		list(list(tuple(int, float)))
+			For every seed, a list of pairs of nodes and scores sorted by decreasing score.
+		"""
+		return (<_BatchPersonalizedPageRank*>(self._this)).topK()
+
 cdef extern from "<networkit/scd/PageRankNibble.hpp>":
 
 	cdef cppclass _PageRankNibble "NetworKit::PageRankNibble"(_SelectiveCommunityDetector):
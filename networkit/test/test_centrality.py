@@ -77,6 +77,25 @@ class TestCentrality(unittest.TestCase):
 		self.assertAlmostEqual(CLL.centralization(), 1.22, 2)
 		self.assertEqual(CLL.maximum(), 28.0)
 
+	def testBetweennessSourceShards(self):
+		g = nk.generators.ErdosRenyiGenerator(100, 0.05).generate()
+		g.indexEdges()
+		reference = nk.centrality.Betweenness(g, True, True).run()
+		paths = []
+		for shard in range(3):
+			partial = nk.centrality.Betweenness(g, True, True)
+			partial.setSourceShard(shard, 3)
+			partial.run()
+			paths.append("output/betweenness_shard{}.bin".format(shard))
+			partial.writePartialScores(paths[-1])
+		scores, edgeScores = nk.centrality.Betweenness.mergePartialScores(paths)
+		for score, expected in zip(scores, reference.scores()):
+			self.assertAlmostEqual(score, expected)
+		for score, expected in zip(edgeScores, reference.edgeScores()):
+			self.assertAlmostEqual(score, expected)
+		with self.assertRaises(RuntimeError):
+			nk.centrality.Betweenness.mergePartialScores(paths[:2])
+
 	def testCloseness(self):
 		CL = nk.centrality.Closeness(self.L, True, nk.centrality.ClosenessVariant.GENERALIZED)
 		CL.run()
@@ -269,6 +288,15 @@ class TestCentrality(unittest.TestCase):
 		#test if lists have the same length
 		self.assertEqual(len(CL.ranking()),len(CLL.ranking()))
 
+	def testEigenvectorCentralityLanczos(self):
+		G = nk.readGraph("input/karate.graph", nk.Format.METIS)
+		reference = nk.centrality.EigenvectorCentrality(G, tol=1e-12).run().scores()
+		ev = nk.centrality.EigenvectorCentrality(G, tol=1e-12,
+			strategy=nk.centrality.EigenvectorStrategy.LANCZOS)
+		self.assertEqual(ev.strategy, nk.centrality.EigenvectorStrategy.LANCZOS)
+		for score, expected in zip(ev.run().scores(), reference):
+			self.assertAlmostEqual(score, expected, 6)
+
 	def testEstimateBetweeness(self):
 		CL = nk.centrality.EstimateBetweenness(self.L, 50)
 		CL.run()
@@ -439,6 +467,15 @@ class TestCentrality(unittest.TestCase):
 		#test if lists have the same length
 		self.assertEqual(len(CL.ranking()),len(CLL.ranking()))
 
+	def testKatzCentralityConjugateGradient(self):
+		G = nk.readGraph("input/karate.graph", nk.Format.METIS)
+		reference = nk.centrality.KatzCentrality(G, tol=1e-12).run().scores()
+		katz = nk.centrality.KatzCentrality(G, tol=1e-12,
+			strategy=nk.centrality.KatzStrategy.CONJUGATE_GRADIENT)
+		self.assertEqual(katz.strategy, nk.centrality.KatzStrategy.CONJUGATE_GRADIENT)
+		for score, expected in zip(katz.run().scores(), reference):
+			self.assertAlmostEqual(score, expected, 6)
+
 	def testLaplacianCentrality(self):
 		LC = nk.centrality.LaplacianCentrality(self.L)
 		LC.run()
@@ -491,6 +528,58 @@ class TestCentrality(unittest.TestCase):
 		self.assertLessEqual(CL.numberOfIterations(), maxIters)
 		self.assertLessEqual(CLL.numberOfIterations(), maxIters)
 	
+	def testPageRankStrategies(self):
+		reference = nk.centrality.PageRank(self.L, tol=1e-12).run().scores()
+		for strategy in [nk.centrality.Strategy.GAUSS_SEIDEL, nk.centrality.Strategy.RESIDUAL_PUSH]:
+			pr = nk.centrality.PageRank(self.L, tol=1e-12)
+			pr.strategy = strategy
+			self.assertEqual(pr.strategy, strategy)
+			for score, expected in zip(pr.run().scores(), reference):
+				self.assertAlmostEqual(score, expected, 6)
+
+		personalization = [0.0] * self.L.upperNodeIdBound()
+		personalization[0] = 1.0
+		pr = nk.centrality.PageRank(self.L)
+		pr.setPersonalization(personalization)
+		pr.run()
+		self.assertEqual(pr.ranking()[0][0], 0)
+
+	def testDynPageRank(self):
+		nk.setSeed(42, False)
+		G = nk.generators.ErdosRenyiGenerator(100, 0.1).generate()
+		dyn = nk.centrality.DynPageRank(G, tol=1e-12)
+		dyn.run()
+
+		u, v = nk.graphtools.randomEdge(G)
+		x = next(x for x in G.iterNodes() if x != u and not G.hasEdge(u, x))
+		G.removeEdge(u, v)
+		G.addEdge(u, x)
+		dyn.updateBatch([
+			nk.dynamics.GraphEvent(nk.dynamics.GraphEventType.EDGE_REMOVAL, u, v, 1.0),
+			nk.dynamics.GraphEvent(nk.dynamics.GraphEventType.EDGE_ADDITION, u, x, 1.0)])
+
+		reference = nk.centrality.PageRank(G, tol=1e-12).run().scores()
+		for score, expected in zip(dyn.scores(), reference):
+			self.assertAlmostEqual(score, expected, 8)
+
+	def testDynCoreDecomposition(self):
+		nk.setSeed(42, False)
+		G = nk.generators.ErdosRenyiGenerator(100, 0.1).generate()
+		dyn = nk.centrality.DynCoreDecomposition(G)
+		dyn.run()
+
+		u, v = nk.graphtools.randomEdge(G)
+		x = next(x for x in G.iterNodes() if x != u and not G.hasEdge(u, x))
+		G.removeEdge(u, v)
+		G.addEdge(u, x)
+		dyn.updateBatch([
+			nk.dynamics.GraphEvent(nk.dynamics.GraphEventType.EDGE_REMOVAL, u, v, 1.0),
+			nk.dynamics.GraphEvent(nk.dynamics.GraphEventType.EDGE_ADDITION, u, x, 1.0)])
+
+		reference = nk.centrality.CoreDecomposition(G).run()
+		self.assertListEqual(dyn.scores(), reference.scores())
+		self.assertEqual(dyn.maxCoreNumber(), reference.maxCoreNumber())
+
 	def testPermanenceCentrality(self):
 		part=nk.structures.Partition(9)
 		part.addToSubset(0, 1)
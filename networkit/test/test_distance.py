@@ -2,6 +2,7 @@
 import numpy as np
 import os
 import random
+import tempfile
 import unittest
 
 import networkit as nk
@@ -255,6 +256,15 @@ class TestDistance(unittest.TestCase):
 					for distList in dists:
 						self.assertEqual(len(distList), nTargets)
 
+	def testSPSPDeltaStepping(self):
+		for g in self.genERGraphs():
+			sources = [0, 42]
+			spsp = nk.distance.SPSP(g, sources)
+			spsp.run()
+			deltaStepping = nk.distance.SPSP(g, sources, useDeltaStepping=True)
+			deltaStepping.run()
+			np.testing.assert_allclose(spsp.getDistances(), deltaStepping.getDistances())
+
 	def testMultiTargetSTSP(self):
 		for g in self.genERGraphs():
 			source = nk.graphtools.randomNode(g)
@@ -323,6 +333,91 @@ class TestDistance(unittest.TestCase):
 					else:
 						self.assertEqual(pll.query(u, v), int(apsp.getDistance(u, v)))
 
+	def testPrunedLandmarkLabelingSaveLoad(self):
+		g = nk.generators.ErdosRenyiGenerator(100, 0.05, True).generate()
+		pll = nk.distance.PrunedLandmarkLabeling(g)
+		pll.run()
+
+		with tempfile.TemporaryDirectory() as tmpdir:
+			path = os.path.join(tmpdir, "pll_index.bin")
+			pll.save(path)
+			loaded = nk.distance.PrunedLandmarkLabeling(path=path)
+			self.assertEqual(loaded.numberOfLabels(), pll.numberOfLabels())
+			for u in g.iterNodes():
+				for v in g.iterNodes():
+					self.assertEqual(loaded.query(u, v), pll.query(u, v))
+			del loaded
+
+	def testDeltaStepping(self):
+		for g in self.genERGraphs():
+			for delta in [0.0, 0.1, 10.0]:
+				for source in [0, 42]:
+					dij = nk.distance.Dijkstra(g, source, True, True)
+					dij.run()
+					ds = nk.distance.DeltaStepping(g, source, True, True, delta=delta)
+					ds.run()
+					for u in g.iterNodes():
+						self.assertAlmostEqual(ds.distance(u), dij.distance(u))
+						self.assertEqual(ds.numberOfPaths(u), dij.numberOfPaths(u))
+						self.assertEqual(set(ds.getPredecessors(u)), set(dij.getPredecessors(u)))
+					self.assertEqual(len(ds.getNodesSortedByDistance()), len(dij.getNodesSortedByDistance()))
+
+	def testBlockedAPSP(self):
+		for g in self.genERGraphs():
+			apsp = nk.distance.APSP(g)
+			apsp.run()
+
+			with tempfile.TemporaryDirectory() as tmpdir:
+				path = os.path.join(tmpdir, "apsp_matrix.bin")
+				blocked = nk.distance.BlockedAPSP(g, outputPath=path, tileSize=30)
+				blocked.run()
+				if g.isWeighted():
+					self.assertEqual(blocked.getEncoding(), nk.distance.Encoding.FLOAT64)
+				loaded = nk.distance.BlockedAPSP(path=path)
+				for u in g.iterNodes():
+					for v in g.iterNodes():
+						self.assertAlmostEqual(blocked.getDistance(u, v), apsp.getDistance(u, v))
+						self.assertAlmostEqual(loaded.getDistance(u, v), apsp.getDistance(u, v))
+				del blocked
+				del loaded
+
+	def testContractionHierarchy(self):
+		for g in self.genERGraphs():
+			for hubLabels in [False, True]:
+				ch = nk.distance.ContractionHierarchy(g, hubLabels)
+				ch.run()
+				self.assertEqual(ch.hasHubLabels(), hubLabels)
+
+				for source in g.iterNodes():
+					dij = nk.distance.Dijkstra(g, source, False)
+					dij.run()
+					for target in g.iterNodes():
+						query = nk.distance.ContractionHierarchyQuery(g, ch, source, target, False)
+						query.run()
+						self.assertAlmostEqual(query.getDistance(), dij.distance(target))
+						if hubLabels:
+							self.assertAlmostEqual(ch.distance(source, target), dij.distance(target))
+
+	def testContractionHierarchySaveLoad(self):
+		g = nk.generators.ErdosRenyiGenerator(100, 0.05, True).generate()
+		ch = nk.distance.ContractionHierarchy(g, True)
+		ch.run()
+
+		with tempfile.TemporaryDirectory() as tmpdir:
+			path = os.path.join(tmpdir, "ch_index.bin")
+			ch.save(path)
+			loaded = nk.distance.ContractionHierarchy(path=path)
+			self.assertEqual(loaded.numberOfShortcuts(), ch.numberOfShortcuts())
+			self.assertEqual(loaded.numberOfLabels(), ch.numberOfLabels())
+			for u in g.iterNodes():
+				query = nk.distance.ContractionHierarchyQuery(g, loaded, u, 0)
+				query.run()
+				self.assertEqual(query.getDistance(), ch.distance(u, 0))
+				for v in g.iterNodes():
+					self.assertEqual(loaded.distance(u, v), ch.distance(u, v))
+			del query
+			del loaded
+
 	def testDynPrunedLandmarkLabeling(self):
 		# 0       3
 		#  \     / \
@@ -445,6 +445,28 @@ class TestGraph(unittest.TestCase):
 				self.assertEqual(G.numberOfEdges(), 0)
 				G.forNodePairs(lambda u, v: self.assertFalse(G.hasEdge(u, v)))
 
+	def testRemoveEdges(self):
+		for directed in [True, False]:
+			for weighted in [True, False]:
+				G = self.getSmallGraph(weighted, directed)
+				nEdges = G.numberOfEdges()
+				edges = list(G.iterEdges())[:nEdges // 2]
+				G.removeEdges(edges)
+				self.assertEqual(G.numberOfEdges(), nEdges - len(edges))
+				for u, v in edges:
+					self.assertFalse(G.hasEdge(u, v))
+
+	def testRemoveNodes(self):
+		for directed in [True, False]:
+			for weighted in [True, False]:
+				G = self.getSmallGraph(weighted, directed)
+				nNodes = G.numberOfNodes()
+				G.removeNodes([0, 2])
+				self.assertEqual(G.numberOfNodes(), nNodes - 2)
+				self.assertFalse(G.hasNode(0))
+				self.assertFalse(G.hasNode(2))
+				G.forEdges(lambda u, v, w, eid: self.assertTrue(u not in [0, 2] and v not in [0, 2]))
+
 	def testRemoveSelfLoops(self):
 		for directed in [True, False]:
 			for weighted in [True, False]:
@@ -88,6 +88,19 @@ class TestMTXGraphReader(unittest.TestCase):
         self.assertTrue(graph.hasEdge(16, 3))
 
 
+class TestStreamingGraphReader(unittest.TestCase):
+    def testReadStreaming(self):
+        reader = nk.graphio.KONECTGraphReader()
+        graph = reader.read("input/foodweb-baydry.konect")
+        graph2 = reader.readStreaming("input/foodweb-baydry.konect")
+        self.assertEqual(graph.numberOfNodes(), graph2.numberOfNodes())
+        self.assertEqual(graph.numberOfEdges(), graph2.numberOfEdges())
+        self.assertTrue(graph2.isDirected())
+        self.assertTrue(graph2.isWeighted())
+        for u, v, w in graph.iterEdgesWeights():
+            self.assertEqual(graph2.weight(u, v), w)
+
+
 class TestGraphIO(unittest.TestCase):
 
     def checkStatic(self, graph, graph2):
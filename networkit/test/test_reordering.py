@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+import unittest
+
+import networkit as nk
+
+class TestReordering(unittest.TestCase):
+
+	def getReorderings(self, G):
+		return [nk.reordering.DegreeReordering(G), nk.reordering.BFSReordering(G),
+			nk.reordering.RCMReordering(G), nk.reordering.GorderReordering(G),
+			nk.reordering.CommunityReordering(G)]
+
+	def testPermutation(self):
+		for directed in [False, True]:
+			G = nk.generators.ErdosRenyiGenerator(100, 0.05, directed).generate()
+			G.removeNode(5)
+			for reordering in self.getReorderings(G):
+				reordering.run()
+				perm = reordering.getPermutation()
+				inv = reordering.getInversePermutation()
+				self.assertEqual(len(perm), G.upperNodeIdBound())
+				self.assertEqual(len(inv), G.numberOfNodes())
+				self.assertEqual(perm[5], nk.none)
+				for u in G.iterNodes():
+					self.assertEqual(inv[perm[u]], u)
+
+				R = reordering.getReorderedGraph()
+				self.assertEqual(R.numberOfNodes(), G.numberOfNodes())
+				self.assertEqual(R.numberOfEdges(), G.numberOfEdges())
+				for u, v in G.iterEdges():
+					self.assertTrue(R.hasEdge(perm[u], perm[v]))
+
+	def testMapToOriginal(self):
+		G = nk.generators.ErdosRenyiGenerator(100, 0.05).generate()
+		G.removeNode(5)
+		reordering = nk.reordering.RCMReordering(G).run()
+		R = reordering.getReorderedGraph()
+
+		expected = nk.centrality.DegreeCentrality(G).run().scores()
+		scores = nk.centrality.DegreeCentrality(R).run().scores()
+		self.assertEqual(reordering.mapToOriginal(scores, -1.0), expected[:5] + [-1.0] + expected[6:])
+
+		zeta = nk.community.PLM(R).run().getPartition()
+		original = reordering.mapToOriginal(zeta)
+		perm = reordering.getPermutation()
+		for u in G.iterNodes():
+			self.assertEqual(original[u], zeta[perm[u]])
+
+	def testCommunityReorderingWithPartition(self):
+		G = nk.generators.ErdosRenyiGenerator(50, 0.1).generate()
+		zeta = nk.Partition(G.upperNodeIdBound())
+		zeta.setUpperBound(2)
+		for u in G.iterNodes():
+			zeta[u] = u % 2
+		inv = nk.reordering.CommunityReordering(G, zeta).run().getInversePermutation()
+		self.assertEqual(inv, list(range(0, 50, 2)) + list(range(1, 50, 2)))
+
+if __name__ == "__main__":
+	unittest.main()
@@ -24,6 +24,22 @@ class TestSCD(unittest.TestCase):
 			self.assertTrue(u in result2)
 			self.assertAlmostEqual(score, result2[u])
 
+	def testBatchPersonalizedPageRank(self):
+		epsilon = 1e-12
+		seeds = [0, 20, 0]
+		k = 5
+		bppr = nk.scd.BatchPersonalizedPageRank(self.G, seeds, k, 0.1, epsilon)
+		bppr.run()
+		topK = bppr.topK()
+
+		self.assertEqual(len(topK), len(seeds))
+		for seed, top in zip(seeds, topK):
+			expected = sorted(nk.scd.ApproximatePageRank(self.G, 0.1, epsilon).run(seed),
+				key=lambda entry: (-entry[1], entry[0]))
+			self.assertEqual(len(top), k)
+			for (_, score), (_, expectedScore) in zip(top, expected):
+				self.assertAlmostEqual(score, expectedScore)
+
 	def testSCD(self):
 		nk.setSeed(42, False)
 		seed = 20